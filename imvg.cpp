@@ -1,104 +1,1500 @@
 ﻿#include "imvg.h"
+#include "imvg_simd.h"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 
-IvgPath::IvgPath()
+#define IVG_PI 3.14159265358979323846
+#define IVG_REORDER_CELL_SIZE 64
+#define IVG_CONVEX_MAX_VERTICES 32
+
+static std::atomic<uint64_t> path_version_counter{ 0 };
+static std::atomic<uint64_t> draw_list_id_counter{ 0 };
+
+static inline IvgV2 IvgArcPoint(const IvgV2& c, const IvgV2& r, float cos_rot, float sin_rot, float cos_a, float sin_a)
+{
+    float x = r.x * cos_a;
+    float y = r.y * sin_a;
+    return IvgV2(c.x + x * cos_rot - y * sin_rot, c.y + x * sin_rot + y * cos_rot);
+}
+
+// Endpoint to center parameterization, see SVG 1.1 implementation notes (F.6.5). The arc always takes the small
+// sweep in the positive angle direction. `angle` is the rotation of the ellipse x-axis. Writes the ArcTo command
+// coordinates and returns false if the arc degenerates to a line.
+static bool IvgArcEndpointToCenter(const IvgV2& p0, IvgCoord rh, IvgCoord rv, IvgCoord angle, const IvgV2& p1, IvgCoord* coords)
+{
+    float rx = std::abs(rh);
+    float ry = std::abs(rv);
+    if (rx == 0.0f || ry == 0.0f)
+        return false;
+
+    float x1 = p0.x;
+    float y1 = p0.y;
+    float cos_rot = std::cos(angle);
+    float sin_rot = std::sin(angle);
+    float dx2 = (x1 - p1.x) * 0.5f;
+    float dy2 = (y1 - p1.y) * 0.5f;
+    float x1p = cos_rot * dx2 + sin_rot * dy2;
+    float y1p = -sin_rot * dx2 + cos_rot * dy2;
+
+    float lambda = (x1p * x1p) / (rx * rx) + (y1p * y1p) / (ry * ry);
+    if (lambda > 1.0f) {
+        float s = std::sqrt(lambda);
+        rx *= s;
+        ry *= s;
+    }
+
+    float rx2 = rx * rx;
+    float ry2 = ry * ry;
+    float num = rx2 * ry2 - rx2 * y1p * y1p - ry2 * x1p * x1p;
+    float den = rx2 * y1p * y1p + ry2 * x1p * x1p;
+    float coef = den > 0.0f ? std::sqrt(IvgMax(num / den, 0.0f)) : 0.0f;
+    float cxp = coef * (rx * y1p / ry);
+    float cyp = coef * -(ry * x1p / rx);
+
+    float start_angle = std::atan2((y1p - cyp) / ry, (x1p - cxp) / rx);
+    float end_angle = std::atan2((-y1p - cyp) / ry, (-x1p - cxp) / rx);
+    if (end_angle < start_angle)
+        end_angle += (float)(2.0 * IVG_PI);
+
+    coords[0] = cos_rot * cxp - sin_rot * cyp + (x1 + p1.x) * 0.5f;
+    coords[1] = sin_rot * cxp + cos_rot * cyp + (y1 + p1.y) * 0.5f;
+    coords[2] = rx;
+    coords[3] = ry;
+    coords[4] = angle;
+    coords[5] = start_angle;
+    coords[6] = end_angle;
+    return true;
+}
+
+static inline bool IvgIsProjective(const IvgMat& mat)
+{
+    return mat.m[6] != 0.0f || mat.m[7] != 0.0f || mat.m[8] != 1.0f;
+}
+
+// Whether the polygon of count points, closed back to the first one, turns the same way at every vertex and goes
+// around only once. Collinear vertices are allowed, polygons without any area are not.
+static bool IvgIsConvex(const IvgV2* points, uint32_t count)
+{
+    float sign = 0.0f;
+    uint32_t x_flips = 0;
+    uint32_t y_flips = 0;
+    // Repeated points are skipped, the turns are measured between the edges around them
+    IvgV2 prev;
+    for (uint32_t i = count; i > 0; i--) {
+        prev = points[i == count ? 0 : i] - points[i - 1];
+        if (prev.x != 0.0f || prev.y != 0.0f)
+            break;
+    }
+    float prev_dx = prev.x;
+    float prev_dy = prev.y;
+    for (uint32_t i = 0; i < count; i++) {
+        IvgV2 edge = points[i + 1 == count ? 0 : i + 1] - points[i];
+        if (edge.x == 0.0f && edge.y == 0.0f)
+            continue;
+        float cross = prev.x * edge.y - prev.y * edge.x;
+        if (cross != 0.0f) {
+            if (sign * cross < 0.0f)
+                return false;
+            sign = cross;
+        }
+        // A simple convex run changes its direction at most twice on each axis
+        if (edge.x != 0.0f) {
+            x_flips += prev_dx * edge.x < 0.0f ? 1 : 0;
+            prev_dx = edge.x;
+        }
+        if (edge.y != 0.0f) {
+            y_flips += prev_dy * edge.y < 0.0f ? 1 : 0;
+            prev_dy = edge.y;
+        }
+        prev = edge;
+    }
+    return sign != 0.0f && x_flips <= 2 && y_flips <= 2;
+}
+
+// Polygons are classified from the points passed in, before they are transformed and emitted. Affine transforms keep
+// convex polygons convex, projective ones may not.
+static IvgCommandHeader IvgGetPolygonHeader(const IvgV2* points, uint32_t count, IvgTransformClass transform_class)
+{
+    if (count <= IVG_CONVEX_MAX_VERTICES && transform_class != IvgTransformClass_Projective && IvgIsConvex(points, count))
+        return IvgCommandHeader_DrawConvex;
+    return IvgCommandHeader_Draw;
+}
+
+// Curves are flattened before they are transformed, so the tolerance is divided by the largest scale of the matrix.
+// The longest column of the linear part is within a factor of sqrt(2) of it. Projective transforms use the scale at
+// the origin.
+static float IvgGetTransformScale(const IvgMat& mat)
+{
+    const float* m = mat.m;
+    float scale = std::sqrt(IvgMax(m[0] * m[0] + m[3] * m[3], m[1] * m[1] + m[4] * m[4]));
+    if (IvgIsProjective(mat) && m[8] != 0.0f)
+        scale /= std::abs(m[8]);
+    return scale > 0.0f && scale < FLT_MAX ? scale : 1.0f;
+}
+
+IvgPath::IvgPath() :
+    cmd_(nullptr),
+    coords_(nullptr),
+    cmd_size_(0),
+    cmd_capacity_(0),
+    coord_size_(0),
+    coord_capacity_(0),
+    version_(0)
+{
+}
+
+IvgPath::IvgPath(IvgPath&& path) :
+    cmd_(path.cmd_),
+    coords_(path.coords_),
+    cmd_size_(path.cmd_size_),
+    cmd_capacity_(path.cmd_capacity_),
+    coord_size_(path.coord_size_),
+    coord_capacity_(path.coord_capacity_),
+    start_point_(path.start_point_),
+    current_point_(path.current_point_),
+    version_(path.version_)
+{
+    path.cmd_ = nullptr;
+    path.coords_ = nullptr;
+    path.cmd_size_ = 0;
+    path.cmd_capacity_ = 0;
+    path.coord_size_ = 0;
+    path.coord_capacity_ = 0;
+    path.version_ = 0;
+}
+
+IvgPath::~IvgPath()
+{
+    IVG_FREE(cmd_);
+    IVG_FREE(coords_);
+}
+
+void IvgPath::MoveTo(IvgCoord x, IvgCoord y)
+{
+    IvgCoord coords[2] = { x, y };
+    _PushCommand(IvgPathCmd_MoveTo, coords, 2);
+    start_point_ = IvgV2(x, y);
+    current_point_ = start_point_;
+}
+
+void IvgPath::MoveTo(const IvgV2& p)
+{
+    MoveTo(p.x, p.y);
+}
+
+void IvgPath::LineTo(IvgCoord x, IvgCoord y)
+{
+    IvgCoord coords[2] = { x, y };
+    _PushCommand(IvgPathCmd_LineTo, coords, 2);
+    current_point_ = IvgV2(x, y);
+}
+
+void IvgPath::LineTo(const IvgV2& p)
+{
+    LineTo(p.x, p.y);
+}
+
+void IvgPath::QuadTo(IvgCoord x0, IvgCoord y0, IvgCoord x1, IvgCoord y1)
+{
+    IvgCoord coords[4] = { x0, y0, x1, y1 };
+    _PushCommand(IvgPathCmd_QuadTo, coords, 4);
+    current_point_ = IvgV2(x1, y1);
+}
+
+void IvgPath::QuadTo(const IvgV2& p0, const IvgV2& p1)
+{
+    QuadTo(p0.x, p0.y, p1.x, p1.y);
+}
+
+void IvgPath::CubicTo(IvgCoord x0, IvgCoord y0, IvgCoord x1, IvgCoord y1, IvgCoord x2, IvgCoord y2)
+{
+    IvgCoord coords[6] = { x0, y0, x1, y1, x2, y2 };
+    _PushCommand(IvgPathCmd_CubicTo, coords, 6);
+    current_point_ = IvgV2(x2, y2);
+}
+
+void IvgPath::CubicTo(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2)
+{
+    CubicTo(p0.x, p0.y, p1.x, p1.y, p2.x, p2.y);
+}
+
+void IvgPath::ArcTo(IvgCoord rh, IvgCoord rv, IvgCoord angle, IvgCoord end_x, IvgCoord end_y)
+{
+    if (current_point_.x == end_x && current_point_.y == end_y)
+        return;
+
+    IvgCoord coords[7];
+    if (!IvgArcEndpointToCenter(current_point_, rh, rv, angle, IvgV2(end_x, end_y), coords)) {
+        LineTo(end_x, end_y);
+        return;
+    }
+
+    _PushCommand(IvgPathCmd_ArcTo, coords, 7);
+    current_point_ = IvgV2(end_x, end_y);
+}
+
+void IvgPath::ArcTo(const IvgV2& r, IvgCoord angle, const IvgV2& end)
+{
+    ArcTo(r.x, r.y, angle, end.x, end.y);
+}
+
+void IvgPath::ArcTo(IvgCoord cx, IvgCoord cy, IvgCoord rh, IvgCoord rv, IvgCoord start_angle, IvgCoord end_angle)
+{
+    IvgCoord coords[7] = { cx, cy, rh, rv, 0.0f, start_angle, end_angle };
+    _PushCommand(IvgPathCmd_ArcTo, coords, 7);
+    current_point_ = IvgV2(cx + rh * std::cos(end_angle), cy + rv * std::sin(end_angle));
+}
+
+void IvgPath::ArcTo(const IvgV2& c, const IvgV2& r, IvgCoord start_angle, IvgCoord end_angle)
+{
+    ArcTo(c.x, c.y, r.x, r.y, start_angle, end_angle);
+}
+
+void IvgPath::Close()
+{
+    _PushCommand(IvgPathCmd_Close, nullptr, 0);
+    current_point_ = start_point_;
+}
+
+void IvgPath::Append(const IvgPath& path)
+{
+    Append(path.cmd_, path.cmd_size_, path.coords_, path.coord_size_);
+}
+
+void IvgPath::Append(const IvgPathCmd* cmd, uint32_t num_cmds, const IvgCoord* coords, uint32_t num_coords)
+{
+    if (num_cmds == 0)
+        return;
+    Reserve(IvgMax(cmd_size_ + num_cmds, cmd_capacity_), IvgMax(coord_size_ + num_coords, coord_capacity_));
+    std::memcpy(cmd_ + cmd_size_, cmd, num_cmds * sizeof(IvgPathCmd));
+    if (num_coords)
+        std::memcpy(coords_ + coord_size_, coords, num_coords * sizeof(IvgCoord));
+    cmd_size_ += num_cmds;
+    coord_size_ += num_coords;
+    version_ = 0;
+    _UpdateCurrentPoint(cmd, num_cmds, coords);
+}
+
+void IvgPath::Reserve(uint32_t cmd_capacity, uint32_t coord_capacity)
+{
+    if (cmd_capacity > cmd_capacity_) {
+        IvgPathCmd* new_cmd = (IvgPathCmd*)IVG_ALLOC((size_t)cmd_capacity * sizeof(IvgPathCmd));
+        IVG_ASSERT(new_cmd != nullptr && "Cannot allocate path command buffer");
+        if (cmd_)
+            std::memcpy(new_cmd, cmd_, cmd_size_ * sizeof(IvgPathCmd));
+        IVG_FREE(cmd_);
+        cmd_ = new_cmd;
+        cmd_capacity_ = cmd_capacity;
+    }
+
+    if (coord_capacity > coord_capacity_) {
+        IvgCoord* new_coords = (IvgCoord*)IVG_ALLOC((size_t)coord_capacity * sizeof(IvgCoord));
+        IVG_ASSERT(new_coords != nullptr && "Cannot allocate path coordinate buffer");
+        if (coords_)
+            std::memcpy(new_coords, coords_, coord_size_ * sizeof(IvgCoord));
+        IVG_FREE(coords_);
+        coords_ = new_coords;
+        coord_capacity_ = coord_capacity;
+    }
+}
+
+void IvgPath::ShrinkToFit()
+{
+    if (cmd_size_ < cmd_capacity_) {
+        IvgPathCmd* new_cmd = nullptr;
+        if (cmd_size_) {
+            new_cmd = (IvgPathCmd*)IVG_ALLOC((size_t)cmd_size_ * sizeof(IvgPathCmd));
+            IVG_ASSERT(new_cmd != nullptr && "Cannot allocate path command buffer");
+            std::memcpy(new_cmd, cmd_, cmd_size_ * sizeof(IvgPathCmd));
+        }
+        IVG_FREE(cmd_);
+        cmd_ = new_cmd;
+        cmd_capacity_ = cmd_size_;
+    }
+
+    if (coord_size_ < coord_capacity_) {
+        IvgCoord* new_coords = nullptr;
+        if (coord_size_) {
+            new_coords = (IvgCoord*)IVG_ALLOC((size_t)coord_size_ * sizeof(IvgCoord));
+            IVG_ASSERT(new_coords != nullptr && "Cannot allocate path coordinate buffer");
+            std::memcpy(new_coords, coords_, coord_size_ * sizeof(IvgCoord));
+        }
+        IVG_FREE(coords_);
+        coords_ = new_coords;
+        coord_capacity_ = coord_size_;
+    }
+}
+
+void IvgPath::Clone(IvgPath* path)
+{
+    IVG_ASSERT(path && "path must be a valid pointer");
+    path->Clear();
+    path->Append(*this);
+}
+
+void IvgPath::Clear()
+{
+    cmd_size_ = 0;
+    coord_size_ = 0;
+    version_ = 0;
+    start_point_ = IvgV2();
+    current_point_ = IvgV2();
+}
+
+void IvgPath::_PushCommand(IvgPathCmd cmd, const IvgCoord* coords, uint32_t num_coords)
+{
+    if (cmd_size_ == cmd_capacity_ || coord_size_ + num_coords > coord_capacity_) {
+        uint32_t cmd_capacity = cmd_capacity_;
+        uint32_t coord_capacity = coord_capacity_;
+        if (cmd_size_ == cmd_capacity_)
+            cmd_capacity = cmd_capacity_ ? cmd_capacity_ + cmd_capacity_ / 2 : 16;
+        if (coord_size_ + num_coords > coord_capacity_)
+            coord_capacity = IvgMax(coord_capacity_ ? coord_capacity_ + coord_capacity_ / 2 : 32, coord_size_ + num_coords);
+        Reserve(cmd_capacity, coord_capacity);
+    }
+    cmd_[cmd_size_++] = cmd;
+    for (uint32_t i = 0; i < num_coords; i++)
+        coords_[coord_size_ + i] = coords[i];
+    coord_size_ += num_coords;
+    version_ = 0;
+}
+
+void IvgPath::_UpdateCurrentPoint(const IvgPathCmd* cmd, uint32_t num_cmds, const IvgCoord* coords)
+{
+    for (uint32_t i = 0; i < num_cmds; i++) {
+        switch (cmd[i]) {
+            case IvgPathCmd_Close:
+                current_point_ = start_point_;
+                break;
+            case IvgPathCmd_MoveTo:
+                start_point_ = IvgV2(coords[0], coords[1]);
+                current_point_ = start_point_;
+                break;
+            case IvgPathCmd_LineTo:
+                current_point_ = IvgV2(coords[0], coords[1]);
+                break;
+            case IvgPathCmd_QuadTo:
+                current_point_ = IvgV2(coords[2], coords[3]);
+                break;
+            case IvgPathCmd_CubicTo:
+                current_point_ = IvgV2(coords[4], coords[5]);
+                break;
+            case IvgPathCmd_ArcTo:
+            {
+                float cos_rot = std::cos(coords[4]);
+                float sin_rot = std::sin(coords[4]);
+                current_point_ = IvgArcPoint(IvgV2(coords[0], coords[1]), IvgV2(coords[2], coords[3]), cos_rot, sin_rot,
+                                             std::cos(coords[6]), std::sin(coords[6]));
+                break;
+            }
+        }
+        coords += IvgGetPathCmdCoordCount(cmd[i]);
+    }
+}
+
+//
+
+static inline uint64_t IvgHashPathKey(uint64_t version, float tolerance)
+{
+    uint32_t tolerance_bits;
+    std::memcpy(&tolerance_bits, &tolerance, sizeof(float));
+    uint64_t h = version ^ ((uint64_t)tolerance_bits << 32);
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    return h;
+}
+
+IvgPathCache::~IvgPathCache()
+{
+    Clear();
+}
+
+IvgPathCacheEntry* IvgPathCache::Find(uint64_t version, float tolerance)
+{
+    if (index_.Size == 0)
+        return nullptr;
+    uint32_t mask = (uint32_t)index_.Size - 1;
+    uint32_t slot = (uint32_t)IvgHashPathKey(version, tolerance) & mask;
+    while (index_.Data[slot] != -1) {
+        IvgPathCacheEntry& entry = entries_.Data[index_.Data[slot]];
+        if (entry.version == version && entry.tolerance == tolerance) {
+            entry.last_used_frame = frame_;
+            stats_.hits++;
+            return &entry;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return nullptr;
+}
+
+IvgPathCacheEntry* IvgPathCache::Insert(uint64_t version, float tolerance, const IvgV2* vertices, uint32_t vtx_count, const IvgRect& bounds)
+{
+    size_t size = (size_t)vtx_count * sizeof(IvgV2) + sizeof(IvgPathCacheEntry);
+    if (size > budget_)
+        return nullptr;
+
+    IvgPathCacheEntry entry;
+    entry.version = version;
+    entry.tolerance = tolerance;
+    entry.last_used_frame = frame_;
+    entry.vtx_count = vtx_count;
+    entry.vertices = nullptr;
+    entry.bounds = bounds;
+    if (vtx_count) {
+        entry.vertices = (IvgV2*)IVG_ALLOC((size_t)vtx_count * sizeof(IvgV2));
+        IVG_ASSERT(entry.vertices != nullptr && "Cannot allocate path cache entry");
+        std::memcpy(entry.vertices, vertices, (size_t)vtx_count * sizeof(IvgV2));
+    }
+    entries_.push_back(entry);
+    stats_.memory_used += size;
+    stats_.num_entries = (uint32_t)entries_.Size;
+
+    // Keep the load factor at or below 50%
+    if ((uint32_t)entries_.Size * 2 > (uint32_t)index_.Size) {
+        _RebuildIndex();
+    }
+    else {
+        uint32_t mask = (uint32_t)index_.Size - 1;
+        uint32_t slot = (uint32_t)IvgHashPathKey(version, tolerance) & mask;
+        while (index_.Data[slot] != -1)
+            slot = (slot + 1) & mask;
+        index_.Data[slot] = entries_.Size - 1;
+    }
+
+    return &entries_.back();
+}
+
+void IvgPathCache::Trim()
+{
+    if (stats_.memory_used <= budget_)
+        return;
+
+    // Evict least recently used entries until the cache fits in the budget again
+    std::sort(entries_.begin(), entries_.end(), [](const IvgPathCacheEntry& a, const IvgPathCacheEntry& b) {
+        return a.last_used_frame > b.last_used_frame;
+    });
+
+    while (!entries_.empty() && stats_.memory_used > budget_) {
+        IvgPathCacheEntry& entry = entries_.back();
+        stats_.memory_used -= (size_t)entry.vtx_count * sizeof(IvgV2) + sizeof(IvgPathCacheEntry);
+        stats_.evictions++;
+        IVG_FREE(entry.vertices);
+        entries_.pop_back();
+    }
+
+    stats_.num_entries = (uint32_t)entries_.Size;
+    _RebuildIndex();
+}
+
+void IvgPathCache::Clear()
+{
+    for (int i = 0; i < entries_.Size; i++)
+        IVG_FREE(entries_.Data[i].vertices);
+    entries_.clear();
+    index_.clear();
+    stats_.memory_used = 0;
+    stats_.num_entries = 0;
+}
+
+void IvgPathCache::_RebuildIndex()
+{
+    uint32_t size = 16;
+    while (size < (uint32_t)entries_.Size * 2)
+        size *= 2;
+    index_.resize((int)size);
+    std::memset(index_.Data, 0xFF, size * sizeof(int32_t));
+
+    uint32_t mask = size - 1;
+    for (int i = 0; i < entries_.Size; i++) {
+        const IvgPathCacheEntry& entry = entries_.Data[i];
+        uint32_t slot = (uint32_t)IvgHashPathKey(entry.version, entry.tolerance) & mask;
+        while (index_.Data[slot] != -1)
+            slot = (slot + 1) & mask;
+        index_.Data[slot] = i;
+    }
+}
+
+//
+
+IvgDrawList::~IvgDrawList()
+{
+    IVG_FREE(vtx_buf_);
+    IVG_FREE(cmd_buf_);
+}
+
+void IvgDrawList::Clear()
+{
+    IVG_FREE(vtx_buf_);
+    IVG_FREE(cmd_buf_);
+    vtx_buf_ = nullptr;
+    vtx_count_ = 0;
+    cmd_buf_ = nullptr;
+    cmd_size_ = 0;
+    bounds_ = IvgRect();
+    id_ = 0;
+}
+
+//
+
+// Strokes are emitted as closed contours tracing the boundary of the union of the segment quads, joins and caps.
+// Every piece has the same orientation and the inner side of a join passes through the joint itself, so the
+// winding number of the outline is the number of pieces covering a point and the stroke renders correctly with
+// the nonzero rule without removing self-intersections.
+struct IvgStroker
+{
+    IvgContext* ctx;
+    IvgStrokeJoin join;
+    IvgStrokeCap cap;
+    float miter_limit;
+    float tolerance;
+
+    inline void Push(const IvgV2& p) { ctx->_PushPoint(p.x, p.y); }
+
+    // Largest angle an arc of the given radius can span per segment while staying within tolerance
+    float MaxArcStep(float radius) const
+    {
+        float x = IvgClamp(1.0f - tolerance / radius, -1.0f, 1.0f);
+        return 2.0f * std::acos(x);
+    }
+
+    // Emits the inner points of the arc around c starting at direction from and spanning sweep radians
+    void Arc(const IvgV2& c, const IvgV2& from, float sweep, float radius, float max_step)
+    {
+        uint32_t n = IvgCurveSegmentCount(std::abs(sweep) / max_step);
+        float step = sweep / (float)n;
+        float cos_step = std::cos(step);
+        float sin_step = std::sin(step);
+        IvgV2 v = from;
+        for (uint32_t i = 1; i < n; i++) {
+            v = IvgV2(v.x * cos_step - v.y * sin_step, v.x * sin_step + v.y * cos_step);
+            Push(c + v * radius);
+        }
+    }
+
+    // Emits the outline around the joint p between the offset points p + a * w and p + b * w of the incoming and
+    // outgoing segment, travelling in direction dir on the incoming segment. min_len is the length of the shorter
+    // segment. When the offset lines intersect within tolerance of the join a single vertex replaces both points.
+    void Join(const IvgV2& p, const IvgV2& a, const IvgV2& b, const IvgV2& dir, float w, float max_step, float min_len)
+    {
+        if (w == 0.0f) {
+            Push(p);
+            return;
+        }
+
+        // |a + b| is 2 * cos(theta / 2), theta being the turning angle. The offset lines intersect at distance
+        // w / cos(theta / 2) from the joint, w * tan(theta / 2) away from the joint along both segments.
+        IvgV2 m = a + b;
+        float cos2_half = (m.x * m.x + m.y * m.y) * 0.25f;
+        float cos_half = std::sqrt(cos2_half);
+        IvgV2 start = p + a * w;
+        IvgV2 end = p + b * w;
+        if (b.x * dir.x + b.y * dir.y < 0.0f) {
+            // Inner side. The detour through the joint is only needed when the segments are too short for their
+            // offset lines to meet.
+            if (w * std::sqrt(1.0f - cos2_half) <= min_len * cos_half) {
+                Push(p + m * (w / (2.0f * cos2_half)));
+            }
+            else {
+                Push(start);
+                Push(p);
+                Push(end);
+            }
+            return;
+        }
+
+        // Outer side. The miter tip is used as well when it is within tolerance of the bevel.
+        bool miter = join == IvgStrokeJoin_Miter && cos_half * miter_limit >= 1.0f;
+        if (miter || w * (1.0f - cos2_half) <= tolerance * cos_half) {
+            Push(p + m * (w / (2.0f * cos2_half)));
+            return;
+        }
+
+        Push(start);
+        if (join == IvgStrokeJoin_None) {
+            Push(p);
+        }
+        else if (join == IvgStrokeJoin_Round) {
+            // Sweep around the outside, towards the travel direction
+            float angle = std::atan2(std::abs(a.x * b.y - a.y * b.x), a.x * b.x + a.y * b.y);
+            if (dir.x * a.y - dir.y * a.x > 0.0f)
+                angle = -angle;
+            Arc(p, a, angle, w, max_step);
+        }
+        Push(end);
+    }
+
+    // Emits the cap at p from the side where the outline arrives to the other side, including the last point.
+    // n and d are the normal and direction of the segment, the cap bulges towards -d at the start of the polyline.
+    void Cap(const IvgV2& p, const IvgV2& n, const IvgV2& d, float wl, float wr, bool start)
+    {
+        IvgV2 from = start ? p - n * wr : p + n * wl;
+        IvgV2 to = start ? p + n * wl : p - n * wr;
+        IvgV2 e = start ? -d : d;
+        float hw = (wl + wr) * 0.5f;
+        IvgV2 c = p + n * ((wl - wr) * 0.5f);
+        switch (cap) {
+            case IvgStrokeCap_Round: {
+                IvgV2 u = (from - c) / hw;
+                float sweep = (u.x * e.y - u.y * e.x) >= 0.0f ? (float)IVG_PI : -(float)IVG_PI;
+                Arc(c, u, sweep, hw, MaxArcStep(hw));
+                break;
+            }
+            case IvgStrokeCap_Square:
+                Push(from + e * hw);
+                Push(to + e * hw);
+                break;
+            case IvgStrokeCap_Triangle:
+                Push(c + e * hw);
+                break;
+            default:
+                break;
+        }
+        Push(to);
+    }
+};
+
+//
+
+IvgContext::IvgContext()
+{
+    flatten_kernel_ = IvgGetFlattenKernel(IvgGetSupportedSimdLevel());
+    transform_kernel_ = IvgGetTransformKernel(IvgGetSupportedSimdLevel());
+}
+
+IvgContext::~IvgContext()
+{
+    IVG_FREE(vtx_buf_);
+    IVG_FREE(cmd_buf_);
+}
+
+void IvgContext::Begin()
+{
+    vtx_offset_ = 0;
+    cmd_offset_ = 0;
+    draw_lists_.shrink(0);
+    instances_.shrink(0);
+    imm_active_ = false;
+    path_cache_.frame_++;
+}
+
+void IvgContext::End()
+{
+    if (reorder_draws_)
+        _ReorderDraws();
+    path_cache_.Trim();
+}
+
+enum IvgReorderKind
+{
+    IvgReorderKind_Fill,
+    IvgReorderKind_Stroke,
+    IvgReorderKind_Rect,
+    IvgReorderKind_Convex,
+    IvgReorderKind_Barrier, // Instanced draws and draw lists, kept in place
+};
+
+// Places every fill and stroke in the earliest batch of its kind that comes after the batches of every draw recorded
+// before it and overlapping it, then rewrites the commands batch by batch with the draw state and clip rect of each
+// draw. Overlaps are tested conservatively on a grid of cells, which keeps the cost linear in the area of the draws.
+void IvgContext::_ReorderDraws()
+{
+    reorder_stats_ = IvgReorderStats{};
+    if (cmd_offset_ == 0 || fb_width_ == 0 || fb_height_ == 0)
+        return;
+
+    const uint32_t none = ~0u;
+    uint32_t draw_state = none;
+    uint32_t clip = none;
+    uint32_t prev_kind = none;
+    bool has_state = true;
+    reorder_items_.resize(0);
+    IvgCmdBufPtr cmd_ptr{ cmd_buf_ };
+    IvgByte* cmd_end = cmd_buf_ + cmd_offset_;
+    while (cmd_ptr.cmd_bytes != cmd_end) {
+        uint32_t offset = (uint32_t)(cmd_ptr.cmd_bytes - cmd_buf_);
+        uint32_t kind;
+        switch (cmd_ptr.cmd_data->header) {
+            case IvgCommandHeader_SetDrawState:
+                draw_state = offset;
+                cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+                continue;
+            case IvgCommandHeader_SetClipRect:
+                clip = offset;
+                cmd_ptr.cmd_bytes += sizeof(IvgSetClipRectCmd);
+                continue;
+            case IvgCommandHeader_Draw:
+            case IvgCommandHeader_DrawCurves:
+                kind = IvgReorderKind_Fill;
+                cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+                break;
+            case IvgCommandHeader_DrawRect:
+                kind = IvgReorderKind_Rect;
+                cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+                break;
+            case IvgCommandHeader_DrawConvex:
+                kind = IvgReorderKind_Convex;
+                cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+                break;
+            case IvgCommandHeader_Stroke:
+                kind = IvgReorderKind_Stroke;
+                cmd_ptr.cmd_bytes += sizeof(IvgStrokeCmd);
+                break;
+            case IvgCommandHeader_DrawInstances:
+                kind = IvgReorderKind_Barrier;
+                cmd_ptr.cmd_bytes += sizeof(IvgDrawInstancesCmd);
+                break;
+            case IvgCommandHeader_DrawList:
+                kind = IvgReorderKind_Barrier;
+                cmd_ptr.cmd_bytes += sizeof(IvgDrawListCmd);
+                break;
+            default:
+                IVG_ASSERT(false && "Unexpected command");
+                return;
+        }
+
+        // Draws recorded before the first state commands rely on the backend defaults, which cannot be restored
+        has_state = has_state && draw_state != none && clip != none;
+        if (kind != prev_kind || kind == IvgReorderKind_Barrier)
+            reorder_stats_.batches_before++;
+        prev_kind = kind;
+        reorder_items_.push_back(IvgReorderItem{ offset, draw_state, clip, kind, 0 });
+    }
+
+    uint32_t num_items = (uint32_t)reorder_items_.Size;
+    reorder_stats_.num_draws = num_items;
+    reorder_stats_.batches_after = reorder_stats_.batches_before;
+    if (!has_state || num_items < 2)
+        return;
+
+    // Every cell keeps the last batch of each kind of the draws touching it
+    int32_t cols = (int32_t)((fb_width_ + IVG_REORDER_CELL_SIZE - 1) / IVG_REORDER_CELL_SIZE);
+    int32_t rows = (int32_t)((fb_height_ + IVG_REORDER_CELL_SIZE - 1) / IVG_REORDER_CELL_SIZE);
+    const int32_t num_kinds = IvgReorderKind_Barrier;
+    reorder_grid_.resize(cols * rows * num_kinds);
+    for (int32_t& cell : reorder_grid_)
+        cell = -1;
+    for (IvgVector<int32_t>& batches : reorder_batches_)
+        batches.resize(0);
+    int32_t num_batches = 0;
+    int32_t first_batch = 0;
+    for (IvgReorderItem& item : reorder_items_) {
+        if (item.kind == IvgReorderKind_Barrier) {
+            item.batch = (uint32_t)num_batches;
+            first_batch = ++num_batches;
+            continue;
+        }
+
+        const IvgBackendCommand* command = (const IvgBackendCommand*)(cmd_buf_ + item.cmd);
+        const IvgRect& rect = item.kind == IvgReorderKind_Stroke ? command->stroke.rect : command->draw.rect;
+        int32_t x0 = IvgClamp((int32_t)std::floor(rect.min.x) / IVG_REORDER_CELL_SIZE, 0, cols - 1);
+        int32_t y0 = IvgClamp((int32_t)std::floor(rect.min.y) / IVG_REORDER_CELL_SIZE, 0, rows - 1);
+        int32_t x1 = IvgClamp(((int32_t)std::ceil(rect.max.x) - 1) / IVG_REORDER_CELL_SIZE, x0, cols - 1);
+        int32_t y1 = IvgClamp(((int32_t)std::ceil(rect.max.y) - 1) / IVG_REORDER_CELL_SIZE, y0, rows - 1);
+        int32_t min_batch = first_batch;
+        for (int32_t y = y0; y <= y1; y++) {
+            for (int32_t x = x0; x <= x1; x++) {
+                const int32_t* cell = reorder_grid_.Data + (y * cols + x) * num_kinds;
+                for (int32_t kind = 0; kind < num_kinds; kind++)
+                    min_batch = IvgMax(min_batch, kind == (int32_t)item.kind ? cell[kind] : cell[kind] + 1);
+            }
+        }
+
+        IvgVector<int32_t>& batches = reorder_batches_[item.kind];
+        const int32_t* batch = std::lower_bound(batches.begin(), batches.end(), min_batch);
+        if (batch == batches.end()) {
+            batches.push_back(num_batches++);
+            batch = &batches.back();
+        }
+        item.batch = (uint32_t)*batch;
+        for (int32_t y = y0; y <= y1; y++) {
+            for (int32_t x = x0; x <= x1; x++) {
+                int32_t* cell = reorder_grid_.Data + (y * cols + x) * num_kinds;
+                cell[item.kind] = IvgMax(cell[item.kind], *batch);
+            }
+        }
+    }
+
+    if ((uint32_t)num_batches >= reorder_stats_.batches_before)
+        return;
+    reorder_stats_.batches_after = (uint32_t)num_batches;
+
+    // Stable counting sort of the draws by batch
+    reorder_offsets_.resize(num_batches + 1);
+    for (uint32_t& offset : reorder_offsets_)
+        offset = 0;
+    for (const IvgReorderItem& item : reorder_items_)
+        reorder_offsets_[item.batch + 1]++;
+    for (int32_t i = 0; i < num_batches; i++)
+        reorder_offsets_[i + 1] += reorder_offsets_[i];
+    reorder_order_.resize((int)num_items);
+    for (uint32_t i = 0; i < num_items; i++)
+        reorder_order_[reorder_offsets_[reorder_items_[i].batch]++] = i;
+
+    // State commands are repeated wherever the previous draw had a different one
+    reorder_cmds_.resize(0);
+    auto append = [&](uint32_t offset, uint32_t size) {
+        int pos = reorder_cmds_.Size;
+        reorder_cmds_.resize(pos + (int)size);
+        std::memcpy(reorder_cmds_.Data + pos, cmd_buf_ + offset, size);
+    };
+    uint32_t current_state = none;
+    uint32_t current_clip = none;
+    for (uint32_t index : reorder_order_) {
+        const IvgReorderItem& item = reorder_items_[index];
+        if (item.draw_state != current_state)
+            append(item.draw_state, sizeof(IvgSetDrawStateCmd));
+        if (item.clip != current_clip)
+            append(item.clip, sizeof(IvgSetClipRectCmd));
+        current_state = item.draw_state;
+        current_clip = item.clip;
+
+        const IvgBackendCommand* command = (const IvgBackendCommand*)(cmd_buf_ + item.cmd);
+        switch (command->header) {
+            case IvgCommandHeader_Stroke:
+                append(item.cmd, sizeof(IvgStrokeCmd));
+                break;
+            case IvgCommandHeader_DrawInstances:
+                append(item.cmd, sizeof(IvgDrawInstancesCmd));
+                break;
+            case IvgCommandHeader_DrawList:
+                // The list leaves its own draw state and clip rect behind
+                append(item.cmd, sizeof(IvgDrawListCmd));
+                current_state = none;
+                current_clip = none;
+                break;
+            default:
+                append(item.cmd, sizeof(IvgDrawCmd));
+                break;
+        }
+    }
+
+    cmd_offset_ = 0;
+    _ReserveCommandBytes((uint32_t)reorder_cmds_.Size);
+    std::memcpy(cmd_buf_, reorder_cmds_.Data, (size_t)reorder_cmds_.Size);
+    cmd_offset_ = (uint32_t)reorder_cmds_.Size;
+}
+
+// Rounds the flattening tolerance down to a power of two so small changes in the transform scale keep hitting the
+// same path cache entries. Paths are never flattened coarser than requested, at most twice as fine.
+float IvgContext::_QuantizeTolerance(float tolerance)
+{
+    if (!(tolerance > 0.0f) || !std::isfinite(tolerance))
+        return tolerance;
+    int exponent;
+    std::frexp(tolerance, &exponent);
+    return std::ldexp(0.5f, exponent);
+}
+
+void IvgContext::SetSimdLevel(IvgSimdLevel level)
+{
+    flatten_kernel_ = IvgGetFlattenKernel(IvgMin(level, IvgGetSupportedSimdLevel()));
+    transform_kernel_ = IvgGetTransformKernel(IvgMin(level, IvgGetSupportedSimdLevel()));
+}
+
+void IvgContext::SetTransformMatrix(const IvgMat& mat)
+{
+    const float* m = mat.m;
+    transform_ = mat;
+    if (IvgIsProjective(mat))
+        transform_class_ = IvgTransformClass_Projective;
+    else if (m[1] != 0.0f || m[3] != 0.0f)
+        transform_class_ = IvgTransformClass_Affine;
+    else if (m[0] != 1.0f || m[4] != 1.0f)
+        transform_class_ = IvgTransformClass_ScaleTranslate;
+    else if (m[2] != 0.0f || m[5] != 0.0f)
+        transform_class_ = IvgTransformClass_Translate;
+    else
+        transform_class_ = IvgTransformClass_Identity;
+    transform_scale_ = IvgGetTransformScale(mat);
+    flatten_tolerance_ = _QuantizeTolerance(tessellation_tolerance_ / transform_scale_);
+}
+
+void IvgContext::StrokeRect(const IvgV2& min_bb, const IvgV2& max_bb)
+{
+    IvgV2 points[4] = { min_bb, IvgV2(max_bb.x, min_bb.y), max_bb, IvgV2(min_bb.x, max_bb.y) };
+    const IvgV2* input = _TransformStrokeInput(points, 4);
+    if (_UseAnalyticStroke()) {
+        _EmitAnalyticStroke(input, 4, true);
+        return;
+    }
+    uint32_t current_offset = vtx_offset_;
+    IvgSubpathState subpath{};
+    _ResetFillRect();
+    _StrokePolyline(subpath, input, 4, true);
+    _EmitStrokeCommand(current_offset);
+}
+
+void IvgContext::StrokeLine(const IvgV2& p0, const IvgV2& p1)
+{
+    IvgV2 points[2] = { p0, p1 };
+    const IvgV2* input = _TransformStrokeInput(points, 2);
+    if (_UseAnalyticStroke()) {
+        _EmitAnalyticStroke(input, 2, false);
+        return;
+    }
+    uint32_t current_offset = vtx_offset_;
+    IvgSubpathState subpath{};
+    _ResetFillRect();
+    _StrokePolyline(subpath, input, 2, false);
+    _EmitStrokeCommand(current_offset);
+}
+
+void IvgContext::StrokeTriangle(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2)
+{
+    IvgV2 points[3] = { p0, p1, p2 };
+    const IvgV2* input = _TransformStrokeInput(points, 3);
+    if (_UseAnalyticStroke()) {
+        _EmitAnalyticStroke(input, 3, true);
+        return;
+    }
+    uint32_t current_offset = vtx_offset_;
+    IvgSubpathState subpath{};
+    _ResetFillRect();
+    _StrokePolyline(subpath, input, 3, true);
+    _EmitStrokeCommand(current_offset);
+}
+
+void IvgContext::StrokePolyline(const IvgV2* points, const uint32_t count)
+{
+    IVG_ASSERT(points && "points must be a valid pointer");
+    const IvgV2* input = _TransformStrokeInput(points, count);
+    if (_UseAnalyticStroke()) {
+        _EmitAnalyticStroke(input, count, false);
+        return;
+    }
+    uint32_t current_offset = vtx_offset_;
+    IvgSubpathState subpath{};
+    _ResetFillRect();
+    _StrokePolyline(subpath, input, count, false);
+    _EmitStrokeCommand(current_offset);
+}
+
+void IvgContext::FillRect(const IvgV2& min_bb, const IvgV2& max_bb)
+{
+    _ResetFillRect();
+    _ReserveVertices(5);
+    uint32_t current_offset = vtx_offset_;
+    IvgV2* vtx = vtx_buf_ + current_offset;
+    vtx[0] = { min_bb.x, min_bb.y };
+    vtx[1] = { max_bb.x, min_bb.y };
+    vtx[2] = { max_bb.x, max_bb.y };
+    vtx[3] = { min_bb.x, max_bb.y };
+    vtx[4] = { min_bb.x, min_bb.y };
+    vtx_offset_ += 5;
+    fill_rect_.min = min_bb;
+    fill_rect_.max = max_bb;
+    _TransformVertices(current_offset);
+    // Transforms without rotation or skew keep the rect axis-aligned
+    bool axis_aligned = transform_class_ <= IvgTransformClass_ScaleTranslate;
+    _EmitDrawCommand(current_offset, 4, axis_aligned ? IvgCommandHeader_DrawRect : IvgCommandHeader_Draw);
+}
+
+void IvgContext::FillTriangle(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2)
+{
+    const IvgV2 points[3] = { p0, p1, p2 };
+    IvgCommandHeader header = IvgGetPolygonHeader(points, 3, transform_class_);
+    uint32_t current_offset = vtx_offset_;
+    _ResetFillRect();
+    _ReserveVertices(4);
+    _PushPointUnchecked(p0.x, p0.y);
+    _PushPointUnchecked(p1.x, p1.y);
+    _PushPointUnchecked(p2.x, p2.y);
+    _PushPointUnchecked(p0.x, p0.y);
+    _TransformVertices(current_offset);
+    _EmitDrawCommand(current_offset, 3, header);
+}
+
+void IvgContext::FillPolygon(const IvgV2* points, const uint32_t count)
+{
+    IVG_ASSERT(points && "points must be a valid pointer");
+    IVG_ASSERT(count > 2 && "There must be at least 3 points");
+    IvgCommandHeader header = IvgGetPolygonHeader(points, count, transform_class_);
+    uint32_t current_offset = vtx_offset_;
+    _ResetFillRect();
+    _ReserveVertices(count + 1);
+    for (uint32_t i = 0; i < count; i++) {
+        const IvgV2& point = points[i];
+        _PushPointUnchecked(point.x, point.y);
+    }
+    _PushPointUnchecked(points[0].x, points[0].y);
+    _TransformVertices(current_offset);
+    _EmitDrawCommand(current_offset, count, header);
+}
+
+void IvgContext::FillPath(const IvgPath& path)
+{
+    if (path.cmd_size_ == 0)
+        return;
+
+    if (_UseCurveFill()) {
+        _FillCurvePath(&path, path.cmd_, path.coords_, path.cmd_size_);
+        return;
+    }
+
+    if (path_cache_.budget_ == 0) {
+        FillPathBuffer(path.cmd_, path.coords_, path.cmd_size_);
+        return;
+    }
+
+    if (path.version_ == 0)
+        path.version_ = path_version_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    // Entries hold the path before the transform, the flattening tolerance covers the scale of the transform
+    uint32_t current_offset = vtx_offset_;
+    IvgPathCacheEntry* entry = path_cache_.Find(path.version_, flatten_tolerance_);
+    if (entry) {
+        if (entry->vtx_count < 3)
+            return;
+        _ReserveVertices(entry->vtx_count);
+        _ResetFillRect();
+        if (transform_class_ == IvgTransformClass_Identity) {
+            std::memcpy(vtx_buf_ + vtx_offset_, entry->vertices, entry->vtx_count * sizeof(IvgV2));
+            _ExpandFillRect(entry->bounds);
+        }
+        else {
+            transform_kernel_->transform[transform_class_](&transform_, entry->vertices, entry->vtx_count,
+                                                           vtx_buf_ + vtx_offset_, &fill_rect_);
+        }
+        vtx_offset_ += entry->vtx_count;
+        _EmitDrawCommand(current_offset, entry->vtx_count - 1);
+        return;
+    }
+
+    // Flatten with empty bounds so the cached bounds only contain the path itself
+    path_cache_.stats_.misses++;
+    fill_rect_.min = IvgV2(FLT_MAX, FLT_MAX);
+    fill_rect_.max = IvgV2(-FLT_MAX, -FLT_MAX);
+    _FlattenPath(path.cmd_, path.cmd_size_, path.coords_);
+    uint32_t count = vtx_offset_ - current_offset;
+    IvgRect bounds = fill_rect_;
+    if (count < 3) {
+        path_cache_.Insert(path.version_, flatten_tolerance_, nullptr, 0, bounds);
+        vtx_offset_ = current_offset;
+        return;
+    }
+
+    path_cache_.Insert(path.version_, flatten_tolerance_, vtx_buf_ + current_offset, count, bounds);
+    _ResetFillRect();
+    _ExpandFillRect(bounds);
+    _TransformVertices(current_offset);
+    _EmitDrawCommand(current_offset, count - 1);
+}
+
+void IvgContext::FillPathBuffer(const IvgPathCmd* cmd, const IvgCoord* coord, uint32_t num_commands)
+{
+    if (num_commands == 0)
+        return;
+    IVG_ASSERT(cmd && coord && "cmd and coord must be a valid pointer");
+    if (_UseCurveFill()) {
+        _FillCurvePath(nullptr, cmd, coord, num_commands);
+        return;
+    }
+
+    uint32_t current_offset = vtx_offset_;
+    _ResetFillRect();
+    _FlattenPath(cmd, num_commands, coord);
+    uint32_t count = vtx_offset_ - current_offset;
+    if (count < 3) {
+        // Nothing to fill
+        vtx_offset_ = current_offset;
+        return;
+    }
+    _TransformVertices(current_offset);
+    _EmitDrawCommand(current_offset, count - 1);
+}
+
+void IvgContext::DrawPathInstances(const IvgPath& path, const IvgMat* transforms, const IvgPaint* paints, uint32_t count)
+{
+    IVG_ASSERT(transforms && paints && "transforms and paints must be a valid pointer");
+    if (path.cmd_size_ == 0 || count == 0)
+        return;
+
+    // Draw lists are replayed with a translation and clip the instance regions would not follow, and the instances
+    // are only transformed by affine matrices. Fall back to one fill per instance for both, and for backends that
+    // cannot draw instances.
+    float scale = 0.0f;
+    bool fallback = recording_list_ != nullptr || !(backend_features_ & IvgBackendFeatures_Instances);
+    for (uint32_t i = 0; i < count && !fallback; i++) {
+        IvgMat mat = transform_ * transforms[i];
+        fallback = IvgIsProjective(mat);
+        scale = IvgMax(scale, IvgGetTransformScale(mat));
+    }
+
+    if (fallback) {
+        IvgMat transform = transform_;
+        const IvgPaint* paint = paint_;
+        for (uint32_t i = 0; i < count; i++) {
+            SetTransformMatrix(transform * transforms[i]);
+            SetPaint(&paints[i]);
+            FillPath(path);
+        }
+        SetTransformMatrix(transform);
+        paint_ = paint;
+        state_update_flags |= DrawStateUpdate;
+        return;
+    }
+
+    // Flatten once in path space, fine enough for the largest instance
+    float flatten_tolerance = flatten_tolerance_;
+    flatten_tolerance_ = _QuantizeTolerance(tessellation_tolerance_ / scale);
+    uint32_t current_offset = vtx_offset_;
+    IvgRect bounds;
+    uint32_t vtx_count = _AppendPathVertices(path, bounds);
+    flatten_tolerance_ = flatten_tolerance;
+    if (vtx_count == 0)
+        return;
+
+    IvgV2 corners[4] = { bounds.min, IvgV2(bounds.max.x, bounds.min.y), bounds.max, IvgV2(bounds.min.x, bounds.max.y) };
+    uint32_t instance_offset = (uint32_t)instances_.Size;
+    uint32_t region_size = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        IvgMat mat = transform_ * transforms[i];
+        IvgRect rect(IvgV2(FLT_MAX, FLT_MAX), IvgV2(-FLT_MAX, -FLT_MAX));
+        for (const IvgV2& corner : corners) {
+            IvgV2 p = IvgTransformPoint(mat, corner);
+            rect.min.x = IvgMin(rect.min.x, p.x);
+            rect.min.y = IvgMin(rect.min.y, p.y);
+            rect.max.x = IvgMax(rect.max.x, p.x);
+            rect.max.y = IvgMax(rect.max.y, p.y);
+        }
+        rect.min.x = IvgMax(rect.min.x, clip_rect_.min.x);
+        rect.min.y = IvgMax(rect.min.y, clip_rect_.min.y);
+        rect.max.x = IvgMin(rect.max.x, clip_rect_.max.x);
+        rect.max.y = IvgMin(rect.max.y, clip_rect_.max.y);
+
+        // Same rounding as _EmitDrawCommand, instances outside the clip rect are dropped
+        int32_t min_x = (int32_t)rect.min.x;
+        int32_t min_y = (int32_t)rect.min.y;
+        int32_t max_x = (int32_t)std::ceil(rect.max.x);
+        int32_t max_y = (int32_t)std::ceil(rect.max.y);
+        if (max_x <= min_x || max_y <= min_y)
+            continue;
+
+        IvgPathInstance instance;
+        instance.rect = rect;
+        std::memcpy(instance.transform, mat.m, sizeof(instance.transform));
+        instance.color = paints[i].color_ptr_[0];
+        instance.region_offset = region_size;
+        instances_.push_back(instance);
+        region_size += (uint32_t)(max_x - min_x) * (uint32_t)(max_y - min_y);
+    }
+
+    uint32_t instance_count = (uint32_t)instances_.Size - instance_offset;
+    if (instance_count == 0) {
+        vtx_offset_ = current_offset;
+        return;
+    }
+
+    // Instances carry their own color, only the clip rect is needed
+    _EmitClipRectCommand();
+    IvgDrawInstancesCmd* cmd = _AllocateCommand<IvgDrawInstancesCmd>();
+    cmd->header = IvgCommandHeader_DrawInstances;
+    cmd->vtx_offset = current_offset;
+    cmd->vtx_count = vtx_count - 1;
+    cmd->instance_offset = instance_offset;
+    cmd->instance_count = instance_count;
+    cmd->region_size = region_size;
+    cmd->fill_mode = fill_mode_;
+}
+
+void IvgContext::BeginPath()
 {
+    // Drop the vertices of a path that was built but never drawn
+    if (imm_active_ && !imm_drawn_ && vtx_offset_ == imm_vtx_end_)
+        vtx_offset_ = imm_vtx_start_;
+
+    imm_subpath_ = IvgSubpathState();
+    imm_spans_.shrink(0);
+    imm_bounds_ = IvgRect(IvgV2(FLT_MAX, FLT_MAX), IvgV2(-FLT_MAX, -FLT_MAX));
+    imm_vtx_start_ = vtx_offset_;
+    imm_vtx_end_ = vtx_offset_;
+    imm_active_ = true;
+    imm_drawn_ = false;
 }
 
-IvgPath::IvgPath(IvgPath&& path)
+void IvgContext::MoveTo(IvgCoord x, IvgCoord y)
 {
+    _BeginImmCommand();
+    _EndImmSubpath(false);
+    imm_subpath_.start = IvgV2(x, y);
+    imm_subpath_.current = imm_subpath_.start;
+    imm_subpath_.has_start = true;
+    _EndImmCommand();
 }
 
-IvgPath::~IvgPath()
+void IvgContext::MoveTo(const IvgV2& p)
 {
+    MoveTo(p.x, p.y);
 }
 
-//
+void IvgContext::LineTo(IvgCoord x, IvgCoord y)
+{
+    _BeginImmCommand();
+    _BeginSubpath(imm_subpath_);
+    _PushPoint(x, y);
+    imm_subpath_.current = IvgV2(x, y);
+    _EndImmCommand();
+}
 
-IvgContext::IvgContext()
+void IvgContext::LineTo(const IvgV2& p)
 {
+    LineTo(p.x, p.y);
 }
 
-IvgContext::~IvgContext()
+void IvgContext::QuadTo(IvgCoord x0, IvgCoord y0, IvgCoord x1, IvgCoord y1)
 {
+    _BeginImmCommand();
+    _BeginSubpath(imm_subpath_);
+    _FlattenQuad(imm_subpath_.current, IvgV2(x0, y0), IvgV2(x1, y1));
+    imm_subpath_.current = IvgV2(x1, y1);
+    _EndImmCommand();
 }
 
-void IvgContext::Begin()
+void IvgContext::QuadTo(const IvgV2& p0, const IvgV2& p1)
 {
-    vtx_offset_ = 0;
-    cmd_offset_ = 0;
+    QuadTo(p0.x, p0.y, p1.x, p1.y);
 }
 
-void IvgContext::End()
+void IvgContext::CubicTo(IvgCoord x0, IvgCoord y0, IvgCoord x1, IvgCoord y1, IvgCoord x2, IvgCoord y2)
 {
+    _BeginImmCommand();
+    _BeginSubpath(imm_subpath_);
+    _FlattenCubic(imm_subpath_.current, IvgV2(x0, y0), IvgV2(x1, y1), IvgV2(x2, y2));
+    imm_subpath_.current = IvgV2(x2, y2);
+    _EndImmCommand();
 }
 
-void IvgContext::StrokeRect(const IvgV2& min_bb, const IvgV2& max_bb)
+void IvgContext::CubicTo(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2)
 {
+    CubicTo(p0.x, p0.y, p1.x, p1.y, p2.x, p2.y);
 }
 
-void IvgContext::StrokeLine(const IvgV2& p0, const IvgV2& p1)
+void IvgContext::ArcTo(IvgCoord rh, IvgCoord rv, IvgCoord angle, IvgCoord end_x, IvgCoord end_y)
 {
+    IvgV2 end(end_x, end_y);
+    if (imm_active_ && imm_subpath_.current == end)
+        return;
+
+    IvgCoord coords[7];
+    if (!IvgArcEndpointToCenter(imm_active_ ? imm_subpath_.current : IvgV2(), rh, rv, angle, end, coords)) {
+        LineTo(end_x, end_y);
+        return;
+    }
+
+    _BeginImmCommand();
+    _FlattenArcCommand(imm_subpath_, coords);
+    // Land exactly on the requested end point
+    imm_subpath_.current = end;
+    _EndImmCommand();
 }
 
-void IvgContext::StrokeTriangle(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2)
+void IvgContext::ArcTo(const IvgV2& r, IvgCoord angle, const IvgV2& end)
 {
+    ArcTo(r.x, r.y, angle, end.x, end.y);
 }
 
-void IvgContext::StrokePolyline(const IvgV2* points, const uint32_t count)
+void IvgContext::ArcTo(IvgCoord cx, IvgCoord cy, IvgCoord rh, IvgCoord rv, IvgCoord start_angle, IvgCoord end_angle)
 {
+    IvgCoord coords[7] = { cx, cy, rh, rv, 0.0f, start_angle, end_angle };
+    _BeginImmCommand();
+    _FlattenArcCommand(imm_subpath_, coords);
+    _EndImmCommand();
 }
 
-void IvgContext::FillRect(const IvgV2& min_bb, const IvgV2& max_bb)
+void IvgContext::ArcTo(const IvgV2& c, const IvgV2& r, IvgCoord start_angle, IvgCoord end_angle)
 {
-    _ResetFillRect();
-    _ReserveVertices(5);
-    uint32_t current_offset = vtx_offset_;
-    IvgV2* vtx = vtx_buf_ + current_offset;
-    vtx[0] = { min_bb.x, min_bb.y };
-    vtx[1] = { max_bb.x, min_bb.y };
-    vtx[2] = { max_bb.x, max_bb.y };
-    vtx[3] = { min_bb.x, max_bb.y };
-    vtx[4] = { min_bb.x, min_bb.y };
-    vtx_offset_ += 5;
-    fill_rect_.min = min_bb;
-    fill_rect_.max = max_bb;
-    _EmitDrawCommand(current_offset, 4);
+    ArcTo(c.x, c.y, r.x, r.y, start_angle, end_angle);
 }
 
-void IvgContext::FillTriangle(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2)
+void IvgContext::ClosePath()
 {
-    uint32_t current_offset = vtx_offset_;
-    _ResetFillRect();
-    _ReserveVertices(4);
-    _PushPointUnchecked(p0.x, p0.y);
-    _PushPointUnchecked(p1.x, p1.y);
-    _PushPointUnchecked(p2.x, p2.y);
-    _PushPointUnchecked(p0.x, p0.y);
-    _EmitDrawCommand(current_offset, 3);
+    if (!imm_active_)
+        return;
+    _BeginImmCommand();
+    _EndImmSubpath(true);
+    _EndImmCommand();
 }
 
-void IvgContext::FillPolygon(const IvgV2* points, const uint32_t count)
+void IvgContext::FillPath(bool preserve_path)
 {
-    IVG_ASSERT(points && "points must be a valid pointer");
-    IVG_ASSERT(count > 2 && "There must be at least 3 points");
+    if (!imm_active_)
+        return;
+
+    if (imm_subpath_.open) {
+        _BeginImmCommand();
+        _EndImmSubpath(false);
+        _EndImmCommand();
+    }
+
+    // A preserved path keeps its vertex run and is drawn again from the same vertices
+    uint32_t count = imm_vtx_end_ - imm_vtx_start_;
+    if (count >= 3) {
+        _ResetFillRect();
+        _ExpandFillRect(imm_bounds_);
+        if (_EmitDrawCommand(imm_vtx_start_, count - 1))
+            imm_drawn_ = true;
+    }
+
+    if (!preserve_path) {
+        if (!imm_drawn_ && vtx_offset_ == imm_vtx_end_)
+            vtx_offset_ = imm_vtx_start_;
+        imm_active_ = false;
+    }
+}
+
+void IvgContext::StrokePath(bool preserve_path)
+{
+    if (!imm_active_)
+        return;
+
+    if (imm_subpath_.open) {
+        _BeginImmCommand();
+        _EndImmSubpath(false);
+        _EndImmCommand();
+    }
+
+    if (_UseAnalyticStroke()) {
+        // The subpath polylines are compacted over the path itself when it is not needed anymore. Writing never
+        // overtakes reading, so this works in place.
+        bool reuse_path = !preserve_path && !imm_drawn_ && imm_vtx_end_ == vtx_offset_;
+        if (reuse_path)
+            vtx_offset_ = imm_vtx_start_;
+        else
+            _ReserveVertices(imm_vtx_end_ - imm_vtx_start_);
+        for (int i = 0; i < imm_spans_.Size; i++) {
+            const IvgSubpathSpan& span = imm_spans_.Data[i];
+            _EmitAnalyticStroke(vtx_buf_ + imm_vtx_start_ + span.first, span.end - span.first, span.closed);
+        }
+        if (!preserve_path)
+            imm_active_ = false;
+        return;
+    }
+
+    // The outline is built from the flattened subpaths and appended after the path
     uint32_t current_offset = vtx_offset_;
+    IvgSubpathState subpath{};
     _ResetFillRect();
-    _ReserveVertices(count + 1);
-    for (uint32_t i = 0; i < count; i++) {
-        const IvgV2& point = points[i];
-        _PushPointUnchecked(point.x, point.y);
+    for (int i = 0; i < imm_spans_.Size; i++) {
+        const IvgSubpathSpan& span = imm_spans_.Data[i];
+        _StrokePolyline(subpath, vtx_buf_ + imm_vtx_start_ + span.first, span.end - span.first, span.closed);
     }
-    _PushPointUnchecked(points[0].x, points[0].y);
-    _EmitDrawCommand(current_offset, count);
+
+    if (!preserve_path) {
+        if (!imm_drawn_ && imm_vtx_end_ == current_offset) {
+            // The path itself is not needed anymore, move the outline over it
+            uint32_t count = vtx_offset_ - current_offset;
+            std::memmove(vtx_buf_ + imm_vtx_start_, vtx_buf_ + current_offset, count * sizeof(IvgV2));
+            current_offset = imm_vtx_start_;
+            vtx_offset_ = current_offset + count;
+        }
+        imm_active_ = false;
+    }
+    _EmitStrokeCommand(current_offset);
 }
 
-void IvgContext::FillPath(const IvgPath& path)
+void IvgContext::BeginDrawList(IvgDrawList* list)
 {
+    IVG_ASSERT(list && "list must be a valid pointer");
+    IVG_ASSERT(!recording_list_ && "Draw lists cannot be nested");
+    recording_list_ = list;
+    list_vtx_start_ = vtx_offset_;
+    list_cmd_start_ = cmd_offset_;
+    // The list must not depend on state emitted before it, nor on the damage rect of this frame
+    _UpdateClipRect();
+    state_update_flags |= DrawStateUpdate;
 }
 
-void IvgContext::FillPathBuffer(const IvgPathCmd* cmd, const IvgCoord* coord, uint32_t num_commands)
+void IvgContext::EndDrawList()
+{
+    IVG_ASSERT(recording_list_ && "BeginDrawList must be called first");
+    IvgDrawList* list = recording_list_;
+    uint32_t vtx_count = vtx_offset_ - list_vtx_start_;
+    uint32_t cmd_size = cmd_offset_ - list_cmd_start_;
+    list->Clear();
+
+    if (cmd_size != 0) {
+        list->vtx_buf_ = (IvgV2*)IVG_ALLOC((size_t)IvgMax(vtx_count, 1u) * sizeof(IvgV2));
+        list->cmd_buf_ = (IvgByte*)IVG_ALLOC(cmd_size);
+        IVG_ASSERT(list->vtx_buf_ != nullptr && list->cmd_buf_ != nullptr && "Cannot allocate draw list");
+        std::memcpy(list->vtx_buf_, vtx_buf_ + list_vtx_start_, vtx_count * sizeof(IvgV2));
+        std::memcpy(list->cmd_buf_, cmd_buf_ + list_cmd_start_, cmd_size);
+        list->vtx_count_ = vtx_count;
+        list->cmd_size_ = cmd_size;
+
+        // Make vertex offsets relative to the list and gather the bounds of every draw
+        IvgRect bounds(IvgV2(FLT_MAX, FLT_MAX), IvgV2(-FLT_MAX, -FLT_MAX));
+        IvgCmdBufPtr cmd_ptr{ list->cmd_buf_ };
+        IvgByte* cmd_end = list->cmd_buf_ + cmd_size;
+        while (cmd_ptr.cmd_bytes != cmd_end) {
+            IvgBackendCommand* command = cmd_ptr.cmd_data;
+            switch (command->header) {
+                case IvgCommandHeader_SetDrawState:
+                    cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+                    break;
+                case IvgCommandHeader_SetClipRect:
+                    cmd_ptr.cmd_bytes += sizeof(IvgSetClipRectCmd);
+                    break;
+                case IvgCommandHeader_Draw:
+                case IvgCommandHeader_DrawCurves:
+                case IvgCommandHeader_DrawRect:
+                case IvgCommandHeader_DrawConvex:
+                    command->draw.vtx_offset -= list_vtx_start_;
+                    bounds.min.x = IvgMin(bounds.min.x, command->draw.rect.min.x);
+                    bounds.min.y = IvgMin(bounds.min.y, command->draw.rect.min.y);
+                    bounds.max.x = IvgMax(bounds.max.x, command->draw.rect.max.x);
+                    bounds.max.y = IvgMax(bounds.max.y, command->draw.rect.max.y);
+                    cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+                    break;
+                case IvgCommandHeader_Stroke:
+                    command->stroke.vtx_offset -= list_vtx_start_;
+                    bounds.min.x = IvgMin(bounds.min.x, command->stroke.rect.min.x);
+                    bounds.min.y = IvgMin(bounds.min.y, command->stroke.rect.min.y);
+                    bounds.max.x = IvgMax(bounds.max.x, command->stroke.rect.max.x);
+                    bounds.max.y = IvgMax(bounds.max.y, command->stroke.rect.max.y);
+                    cmd_ptr.cmd_bytes += sizeof(IvgStrokeCmd);
+                    break;
+                default:
+                    IVG_ASSERT(false && "Unexpected command in draw list");
+                    cmd_ptr.cmd_bytes = cmd_end;
+                    break;
+            }
+        }
+
+        if (bounds.min.x <= bounds.max.x)
+            list->bounds_ = bounds;
+    }
+
+    list->id_ = draw_list_id_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    vtx_offset_ = list_vtx_start_;
+    cmd_offset_ = list_cmd_start_;
+    recording_list_ = nullptr;
+    _UpdateClipRect();
+    state_update_flags |= DrawStateUpdate;
+}
+
+void IvgContext::DrawList(const IvgDrawList& list, const IvgV2& translation)
 {
+    IVG_ASSERT(!recording_list_ && "Draw lists cannot be replayed while recording");
+    if (list.cmd_size_ == 0)
+        return;
+
+    // Cull lists that lie entirely outside the clip rect
+    IvgRect bounds(list.bounds_.min + translation, list.bounds_.max + translation);
+    if (bounds.min.x >= clip_rect_.max.x || bounds.min.y >= clip_rect_.max.y ||
+        bounds.max.x <= clip_rect_.min.x || bounds.max.y <= clip_rect_.min.y)
+        return;
+
+    IvgDrawListCmd* cmd = _AllocateCommand<IvgDrawListCmd>();
+    cmd->header = IvgCommandHeader_DrawList;
+    cmd->list_index = (uint32_t)draw_lists_.Size;
+    cmd->translation = translation;
+    cmd->clip = clip_rect_;
+    draw_lists_.push_back(&list);
+
+    // The list leaves its own draw state and clip rect behind
+    state_update_flags |= DrawStateUpdate | ClipRectUpdate;
 }
 
 void IvgContext::_ReserveVertices(uint32_t count)
@@ -106,7 +1502,7 @@ void IvgContext::_ReserveVertices(uint32_t count)
     uint32_t new_size = vtx_offset_ + count;
     if (new_size <= vtx_count_)
         return;
-    uint32_t capacity = vtx_count_ ? vtx_count_ + vtx_count_ / 2 : 256;
+    uint32_t capacity = IvgMax(vtx_count_ ? vtx_count_ + vtx_count_ / 2 : 256, new_size);
     IvgV2* new_vtx_buf = (IvgV2*)IVG_ALLOC((size_t)capacity * sizeof(IvgV2));
     IVG_ASSERT(new_vtx_buf != nullptr && "Cannot allocate vertex buffer");
     if (vtx_buf_)
@@ -121,7 +1517,7 @@ void IvgContext::_ReserveCommandBytes(uint32_t size)
     uint32_t new_size = cmd_offset_ + size;
     if (new_size <= cmd_size_)
         return;
-    uint32_t capacity = cmd_size_ ? cmd_size_ + cmd_size_ / 2 : 256;
+    uint32_t capacity = IvgMax(cmd_size_ ? cmd_size_ + cmd_size_ / 2 : 256, new_size);
     IvgByte* new_cmd_buf = (IvgByte*)IVG_ALLOC((size_t)capacity);
     IVG_ASSERT(new_cmd_buf != nullptr && "Cannot allocate command buffer");
     if (cmd_buf_)
@@ -131,7 +1527,679 @@ void IvgContext::_ReserveCommandBytes(uint32_t size)
     cmd_buf_ = new_cmd_buf;
 }
 
-void IvgContext::_EmitDrawCommand(uint32_t vtx_offset, uint32_t vtx_count)
+// The flattening functions below emit every point of the curve except the first one, which is the current point.
+void IvgContext::_FlattenQuad(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2)
+{
+    IvgCurveBatch batch;
+    batch.x[0][0] = p0.x; batch.y[0][0] = p0.y;
+    batch.x[1][0] = p1.x; batch.y[1][0] = p1.y;
+    batch.x[2][0] = p2.x; batch.y[2][0] = p2.y;
+    batch.count = 1;
+    _FlattenCurveBatch(IvgPathCmd_QuadTo, &batch);
+}
+
+void IvgContext::_FlattenCubic(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2, const IvgV2& p3)
+{
+    IvgCurveBatch batch;
+    batch.x[0][0] = p0.x; batch.y[0][0] = p0.y;
+    batch.x[1][0] = p1.x; batch.y[1][0] = p1.y;
+    batch.x[2][0] = p2.x; batch.y[2][0] = p2.y;
+    batch.x[3][0] = p3.x; batch.y[3][0] = p3.y;
+    batch.count = 1;
+    _FlattenCurveBatch(IvgPathCmd_CubicTo, &batch);
+}
+
+void IvgContext::_FlattenCurveBatch(IvgPathCmd type, IvgCurveBatch* batch)
+{
+    const IvgFlattenKernel* kernel = flatten_kernel_;
+    uint32_t count;
+    IvgV2* end;
+    if (type == IvgPathCmd_QuadTo) {
+        count = kernel->quad_segment_count(batch, flatten_tolerance_);
+        _ReserveVertices(count);
+        end = kernel->emit_quad(batch, vtx_buf_ + vtx_offset_, &fill_rect_);
+    }
+    else {
+        count = kernel->cubic_segment_count(batch, flatten_tolerance_);
+        _ReserveVertices(count);
+        end = kernel->emit_cubic(batch, vtx_buf_ + vtx_offset_, &fill_rect_);
+    }
+    IVG_ASSERT(end == vtx_buf_ + vtx_offset_ + count);
+    vtx_offset_ += count;
+}
+
+void IvgContext::_FlattenArc(const IvgV2& c, const IvgV2& r, float rotation, float start_angle, float end_angle)
+{
+    // The sagitta of a circular segment spanning angle a is radius * (1 - cos(a / 2))
+    float radius = IvgMax(std::abs(r.x), std::abs(r.y));
+    float sweep = end_angle - start_angle;
+    float x = IvgClamp(1.0f - flatten_tolerance_ / radius, -1.0f, 1.0f);
+    float max_step = 2.0f * std::acos(x);
+    uint32_t n = IvgCurveSegmentCount(std::abs(sweep) / max_step);
+    float cos_rot = std::cos(rotation);
+    float sin_rot = std::sin(rotation);
+
+    // Rotate the angle incrementally in double precision to avoid calling cos/sin for every point
+    double step = (double)sweep / (double)n;
+    double cos_step = std::cos(step);
+    double sin_step = std::sin(step);
+    double cos_a = std::cos((double)start_angle);
+    double sin_a = std::sin((double)start_angle);
+    _ReserveVertices(n);
+    for (uint32_t i = 1; i < n; i++) {
+        double tmp = cos_a * cos_step - sin_a * sin_step;
+        sin_a = sin_a * cos_step + cos_a * sin_step;
+        cos_a = tmp;
+        IvgV2 p = IvgArcPoint(c, r, cos_rot, sin_rot, (float)cos_a, (float)sin_a);
+        _PushPointUnchecked(p.x, p.y);
+    }
+    IvgV2 p = IvgArcPoint(c, r, cos_rot, sin_rot, std::cos(end_angle), std::sin(end_angle));
+    _PushPointUnchecked(p.x, p.y);
+}
+
+void IvgContext::_FlattenArcCommand(IvgSubpathState& subpath, const IvgCoord* coords)
+{
+    IvgV2 c(coords[0], coords[1]);
+    IvgV2 r(coords[2], coords[3]);
+    float cos_rot = std::cos(coords[4]);
+    float sin_rot = std::sin(coords[4]);
+    IvgV2 arc_start = IvgArcPoint(c, r, cos_rot, sin_rot, std::cos(coords[5]), std::sin(coords[5]));
+    if (!subpath.has_start) {
+        // Arc without a starting point begins a new subpath at its start point
+        subpath.start = arc_start;
+        subpath.current = arc_start;
+    }
+    _BeginSubpath(subpath);
+    if (arc_start != subpath.current)
+        _PushPoint(arc_start.x, arc_start.y);
+    _FlattenArc(c, r, coords[4], coords[5], coords[6]);
+    subpath.current = IvgArcPoint(c, r, cos_rot, sin_rot, std::cos(coords[6]), std::sin(coords[6]));
+}
+
+void IvgContext::_FlattenPath(const IvgPathCmd* cmd, uint32_t num_cmds, const IvgCoord* coords)
+{
+    // Runs of consecutive curves of the same type are collected in a batch so the flattening kernel can process
+    // several of them at once.
+    IvgSubpathState subpath{};
+    IvgCurveBatch batch;
+    IvgPathCmd batch_type = IvgPathCmd_QuadTo;
+    batch.count = 0;
+
+    auto flush_batch = [&]() {
+        if (batch.count == 0)
+            return;
+        _FlattenCurveBatch(batch_type, &batch);
+        batch.count = 0;
+    };
+
+    auto push_curve = [&](IvgPathCmd type, const IvgCoord* coords, uint32_t num_points) {
+        if (batch.count == IVG_CURVE_BATCH_SIZE || (batch.count != 0 && batch_type != type))
+            flush_batch();
+        uint32_t k = batch.count++;
+        batch.x[0][k] = subpath.current.x;
+        batch.y[0][k] = subpath.current.y;
+        for (uint32_t i = 0; i < num_points; i++) {
+            batch.x[i + 1][k] = coords[i * 2];
+            batch.y[i + 1][k] = coords[i * 2 + 1];
+        }
+        batch_type = type;
+    };
+
+    for (uint32_t i = 0; i < num_cmds; i++) {
+        switch (cmd[i]) {
+            case IvgPathCmd_Close:
+                flush_batch();
+                _EndSubpath(subpath);
+                break;
+            case IvgPathCmd_MoveTo:
+                flush_batch();
+                _EndSubpath(subpath);
+                subpath.start = IvgV2(coords[0], coords[1]);
+                subpath.current = subpath.start;
+                subpath.has_start = true;
+                break;
+            case IvgPathCmd_LineTo:
+            {
+                IvgV2 p(coords[0], coords[1]);
+                flush_batch();
+                _BeginSubpath(subpath);
+                _PushPoint(p.x, p.y);
+                subpath.current = p;
+                break;
+            }
+            case IvgPathCmd_QuadTo:
+                _BeginSubpath(subpath);
+                push_curve(IvgPathCmd_QuadTo, coords, 2);
+                subpath.current = IvgV2(coords[2], coords[3]);
+                break;
+            case IvgPathCmd_CubicTo:
+                _BeginSubpath(subpath);
+                push_curve(IvgPathCmd_CubicTo, coords, 3);
+                subpath.current = IvgV2(coords[4], coords[5]);
+                break;
+            case IvgPathCmd_ArcTo:
+                flush_batch();
+                _FlattenArcCommand(subpath, coords);
+                break;
+        }
+        coords += IvgGetPathCmdCoordCount(cmd[i]);
+    }
+
+    flush_batch();
+    _EndSubpath(subpath);
+}
+
+// All subpaths are flattened into a single closed vertex run. Every subpath after the first one is connected to the
+// first point (anchor) of the path with a pair of opposite edges which cancel each other out in the coverage buffer.
+void IvgContext::_BeginSubpath(IvgSubpathState& subpath)
+{
+    if (subpath.open)
+        return;
+    _ReserveVertices(1);
+    if (!subpath.has_anchor) {
+        subpath.anchor = subpath.start;
+        subpath.has_anchor = true;
+        _PushPointUnchecked(subpath.start.x, subpath.start.y);
+    }
+    else if (subpath.start != subpath.anchor) {
+        _PushPointUnchecked(subpath.start.x, subpath.start.y);
+    }
+    subpath.first_vertex = vtx_offset_ - 1;
+    subpath.has_start = true;
+    subpath.open = true;
+}
+
+void IvgContext::_EndSubpath(IvgSubpathState& subpath)
+{
+    if (subpath.open) {
+        _ReserveVertices(2);
+        if (subpath.current != subpath.start)
+            _PushPointUnchecked(subpath.start.x, subpath.start.y);
+        if (subpath.start != subpath.anchor)
+            _PushPointUnchecked(subpath.anchor.x, subpath.anchor.y);
+        subpath.open = false;
+    }
+    subpath.current = subpath.start;
+}
+
+// Fills a path with quadratic segments instead of flattened edges. Runs are cached in path space under the negated
+// tolerance so they never collide with flattened runs of the same path.
+void IvgContext::_FillCurvePath(const IvgPath* path, const IvgPathCmd* cmd, const IvgCoord* coords, uint32_t num_cmds)
+{
+    const IvgV2* run;
+    uint32_t count;
+    if (path && path_cache_.budget_ != 0) {
+        if (path->version_ == 0)
+            path->version_ = path_version_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+        IvgPathCacheEntry* entry = path_cache_.Find(path->version_, -flatten_tolerance_);
+        if (!entry) {
+            path_cache_.stats_.misses++;
+            _BuildCurvePath(cmd, num_cmds, coords);
+            IvgRect bounds(IvgV2(FLT_MAX, FLT_MAX), IvgV2(-FLT_MAX, -FLT_MAX));
+            for (int i = 0; i < curve_path_.Size; i++) {
+                const IvgV2& p = curve_path_.Data[i];
+                bounds.min.x = IvgMin(bounds.min.x, p.x);
+                bounds.min.y = IvgMin(bounds.min.y, p.y);
+                bounds.max.x = IvgMax(bounds.max.x, p.x);
+                bounds.max.y = IvgMax(bounds.max.y, p.y);
+            }
+            uint32_t size = curve_path_.Size < 3 ? 0 : (uint32_t)curve_path_.Size;
+            entry = path_cache_.Insert(path->version_, -flatten_tolerance_, curve_path_.Data, size, bounds);
+        }
+        run = entry ? entry->vertices : curve_path_.Data;
+        count = entry ? entry->vtx_count : (uint32_t)curve_path_.Size;
+    }
+    else {
+        _BuildCurvePath(cmd, num_cmds, coords);
+        run = curve_path_.Data;
+        count = (uint32_t)curve_path_.Size;
+    }
+
+    if (count < 3)
+        return;
+
+    // Transform before splitting, affine transforms keep quadratic segments quadratic but not monotonic in x
+    if (transform_class_ != IvgTransformClass_Identity) {
+        IvgRect bounds;
+        curve_input_.resize((int)count);
+        transform_kernel_->transform[transform_class_](&transform_, run, count, curve_input_.Data, &bounds);
+        run = curve_input_.Data;
+    }
+
+    // Every segment is split at most once
+    uint32_t current_offset = vtx_offset_;
+    _ResetFillRect();
+    _ReserveVertices(count * 2);
+    _PushPointUnchecked(run[0].x, run[0].y);
+    for (uint32_t i = 1; i + 1 < count; i += 2)
+        _PushCurveSegment(run[i - 1], run[i], run[i + 1]);
+    _EmitDrawCommand(current_offset, (vtx_offset_ - current_offset) / 2, IvgCommandHeader_DrawCurves);
+}
+
+// Builds the quadratic run of a path into curve_path_. Subpaths are joined through the first point of the path like
+// in _FlattenPath, lines are stored as segments with their midpoint as control point.
+void IvgContext::_BuildCurvePath(const IvgPathCmd* cmd, uint32_t num_cmds, const IvgCoord* coords)
+{
+    IvgVector<IvgV2>& run = curve_path_;
+    IvgV2 anchor;
+    IvgV2 start;
+    IvgV2 current;
+    bool has_anchor = false;
+    bool has_start = false;
+    bool open = false;
+    run.resize(0);
+
+    auto line_to = [&](const IvgV2& p) {
+        run.push_back((current + p) * 0.5f);
+        run.push_back(p);
+        current = p;
+    };
+
+    auto quad_to = [&](const IvgV2& c, const IvgV2& p) {
+        run.push_back(c);
+        run.push_back(p);
+        current = p;
+    };
+
+    auto begin_subpath = [&]() {
+        if (open)
+            return;
+        if (!has_anchor) {
+            anchor = start;
+            has_anchor = true;
+            run.push_back(start);
+        }
+        else if (start != anchor) {
+            current = anchor;
+            line_to(start);
+        }
+        current = start;
+        open = true;
+    };
+
+    auto end_subpath = [&]() {
+        if (open) {
+            if (current != start)
+                line_to(start);
+            if (start != anchor)
+                line_to(anchor);
+            open = false;
+        }
+        current = start;
+    };
+
+    for (uint32_t i = 0; i < num_cmds; i++) {
+        switch (cmd[i]) {
+            case IvgPathCmd_Close:
+                end_subpath();
+                break;
+            case IvgPathCmd_MoveTo:
+                end_subpath();
+                start = IvgV2(coords[0], coords[1]);
+                current = start;
+                has_start = true;
+                break;
+            case IvgPathCmd_LineTo:
+                begin_subpath();
+                line_to(IvgV2(coords[0], coords[1]));
+                break;
+            case IvgPathCmd_QuadTo:
+                begin_subpath();
+                quad_to(IvgV2(coords[0], coords[1]), IvgV2(coords[2], coords[3]));
+                break;
+            case IvgPathCmd_CubicTo:
+            {
+                // The distance between a cubic split into n pieces and the quadratics through the ends of each piece
+                // is at most sqrt(3) / 36 * |p3 - 3 p2 + 3 p1 - p0| / n^3
+                IvgV2 p0 = current;
+                IvgV2 p1(coords[0], coords[1]);
+                IvgV2 p2(coords[2], coords[3]);
+                IvgV2 p3(coords[4], coords[5]);
+                IvgV2 d = p3 - p2 * 3.0f + p1 * 3.0f - p0;
+                float err = std::sqrt(d.x * d.x + d.y * d.y) * 0.0481125224f / flatten_tolerance_;
+                uint32_t n = IvgCurveSegmentCount(std::cbrt(err));
+                begin_subpath();
+                float dt = 1.0f / (float)n;
+                IvgV2 prev = p0;
+                IvgV2 prev_d = (p1 - p0) * (3.0f * dt);
+                for (uint32_t k = 1; k <= n; k++) {
+                    float t = k == n ? 1.0f : (float)k * dt;
+                    float mt = 1.0f - t;
+                    IvgV2 p = k == n ? p3 : p0 * (mt * mt * mt) + p1 * (3.0f * mt * mt * t) + p2 * (3.0f * mt * t * t) + p3 * (t * t * t);
+                    IvgV2 pd = ((p1 - p0) * (mt * mt) + (p2 - p1) * (2.0f * mt * t) + (p3 - p2) * (t * t)) * (3.0f * dt);
+                    // Control point of the quadratic matching the piece, (3 (c1 + c2) - (p0 + p3)) / 4
+                    quad_to((prev + p) * 0.5f + (prev_d - pd) * 0.25f, p);
+                    prev = p;
+                    prev_d = pd;
+                }
+                break;
+            }
+            case IvgPathCmd_ArcTo:
+            {
+                IvgV2 c(coords[0], coords[1]);
+                IvgV2 r(coords[2], coords[3]);
+                float cos_rot = std::cos(coords[4]);
+                float sin_rot = std::sin(coords[4]);
+                IvgV2 arc_start = IvgArcPoint(c, r, cos_rot, sin_rot, std::cos(coords[5]), std::sin(coords[5]));
+                if (!has_start) {
+                    start = arc_start;
+                    current = arc_start;
+                    has_start = true;
+                }
+                begin_subpath();
+                if (arc_start != current)
+                    line_to(arc_start);
+
+                // A quadratic through the ends of an arc spanning 2a, with its control point where the tangents
+                // meet, bulges out by radius * ((cos(a) + 1 / cos(a)) / 2 - 1) which is about radius * a^4 / 8
+                float radius = IvgMax(std::abs(r.x), std::abs(r.y));
+                float sweep = coords[6] - coords[5];
+                float max_half_step = IvgMin(std::sqrt(std::sqrt(8.0f * flatten_tolerance_ / radius)), (float)IVG_PI * 0.25f);
+                uint32_t n = IvgCurveSegmentCount(std::abs(sweep) * 0.5f / max_half_step);
+                float step = sweep / (float)n;
+                float scale = 1.0f / std::cos(step * 0.5f);
+                for (uint32_t k = 1; k <= n; k++) {
+                    float a = coords[5] + step * (float)k;
+                    float mid = a - step * 0.5f;
+                    IvgV2 ctrl = IvgArcPoint(c, r, cos_rot, sin_rot, std::cos(mid) * scale, std::sin(mid) * scale);
+                    quad_to(ctrl, IvgArcPoint(c, r, cos_rot, sin_rot, std::cos(a), std::sin(a)));
+                }
+                break;
+            }
+        }
+        coords += IvgGetPathCmdCoordCount(cmd[i]);
+    }
+    end_subpath();
+}
+
+// Pushes the control and end point of a quadratic segment, split where it turns around in x
+void IvgContext::_PushCurveSegment(const IvgV2& p0, const IvgV2& c, const IvgV2& p1)
+{
+    float d = p0.x - 2.0f * c.x + p1.x;
+    float t = d != 0.0f ? (p0.x - c.x) / d : 0.0f;
+    if (t > 0.0f && t < 1.0f) {
+        IvgV2 c0 = p0 + (c - p0) * t;
+        IvgV2 c1 = c + (p1 - c) * t;
+        IvgV2 m = c0 + (c1 - c0) * t;
+        // The tangent is vertical at the split, keep both halves monotonic despite rounding
+        c0.x = m.x;
+        c1.x = m.x;
+        _PushPointUnchecked(c0.x, c0.y);
+        _PushPointUnchecked(m.x, m.y);
+        _PushPointUnchecked(c1.x, c1.y);
+    }
+    else {
+        _PushPointUnchecked(c.x, c.y);
+    }
+    _PushPointUnchecked(p1.x, p1.y);
+}
+
+void IvgContext::_BeginImmCommand()
+{
+    if (!imm_active_) {
+        BeginPath();
+    }
+    else if (vtx_offset_ != imm_vtx_end_) {
+        // Other draw calls were recorded after a preserved path, move the path behind them so it stays contiguous
+        uint32_t count = imm_vtx_end_ - imm_vtx_start_;
+        _ReserveVertices(count);
+        std::memcpy(vtx_buf_ + vtx_offset_, vtx_buf_ + imm_vtx_start_, count * sizeof(IvgV2));
+        imm_vtx_start_ = vtx_offset_;
+        vtx_offset_ += count;
+        imm_vtx_end_ = vtx_offset_;
+    }
+    imm_cmd_start_ = vtx_offset_;
+    fill_rect_ = imm_bounds_;
+}
+
+void IvgContext::_EndImmCommand()
+{
+    // Record the polyline of a subpath opened by this command for stroking
+    if (imm_subpath_.open && (imm_spans_.empty() || imm_spans_.back().end != 0))
+        imm_spans_.push_back({ imm_subpath_.first_vertex - imm_vtx_start_, 0, false });
+
+    // The subpath state stays in path space, only the vertices emitted by this command are transformed
+    if (transform_class_ != IvgTransformClass_Identity) {
+        fill_rect_ = imm_bounds_;
+        IvgV2* vertices = vtx_buf_ + imm_cmd_start_;
+        transform_kernel_->transform[transform_class_](&transform_, vertices, vtx_offset_ - imm_cmd_start_, vertices, &fill_rect_);
+    }
+    imm_vtx_end_ = vtx_offset_;
+    imm_bounds_ = fill_rect_;
+}
+
+void IvgContext::_EndImmSubpath(bool closed)
+{
+    if (imm_subpath_.open) {
+        IvgSubpathSpan& span = imm_spans_.back();
+        span.end = vtx_offset_ - imm_vtx_start_;
+        span.closed = closed;
+    }
+    _EndSubpath(imm_subpath_);
+}
+
+void IvgContext::_StrokePolyline(IvgSubpathState& subpath, const IvgV2* points, uint32_t count, bool closed)
+{
+    // Copy the points without repeats first, they may live in vtx_buf_ which moves while the outline is emitted
+    stroke_points_.resize((int)count + 1);
+    IvgV2* pts = stroke_points_.Data;
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (n == 0 || points[i] != pts[n - 1])
+            pts[n++] = points[i];
+    }
+    if (closed && n > 1 && pts[n - 1] == pts[0])
+        n--;
+    if (n < 2 || stroke_width_ <= 0.0f)
+        return;
+
+    // Unit normals and lengths of all segments in one pass without dependencies between iterations. The closing
+    // segment of a closed polyline wraps around through the extra point.
+    uint32_t num_segments = closed ? n : n - 1;
+    pts[n] = pts[0];
+    stroke_normals_.resize((int)num_segments);
+    stroke_lengths_.resize((int)num_segments);
+    IvgV2* normals = stroke_normals_.Data;
+    float* lengths = stroke_lengths_.Data;
+    for (uint32_t i = 0; i < num_segments; i++) {
+        float dx = pts[i + 1].x - pts[i].x;
+        float dy = pts[i + 1].y - pts[i].y;
+        float len = std::sqrt(dx * dx + dy * dy);
+        float inv_len = 1.0f / len;
+        normals[i] = IvgV2(-dy * inv_len, dx * inv_len);
+        lengths[i] = len;
+    }
+
+    // Width on the left (+normal) and right (-normal) side of the polyline
+    float wl = stroke_width_ * 0.5f;
+    float wr = wl;
+    if (stroke_offset_ != IvgStrokeOffset_Center) {
+        bool inside_left = true;
+        if (closed) {
+            float area = 0.0f;
+            for (uint32_t i = 0; i < n; i++)
+                area += pts[i].x * pts[i + 1].y - pts[i + 1].x * pts[i].y;
+            inside_left = area > 0.0f;
+        }
+        bool left = inside_left == (stroke_offset_ == IvgStrokeOffset_Inside);
+        wl = left ? stroke_width_ : 0.0f;
+        wr = left ? 0.0f : stroke_width_;
+    }
+
+    IvgStroker stroker{ this, stroke_join_, stroke_cap_, miter_limit_, tessellation_tolerance_ };
+    float step_l = stroker.MaxArcStep(wl);
+    float step_r = stroker.MaxArcStep(wr);
+    auto dir = [](const IvgV2& n) { return IvgV2(n.y, -n.x); };
+    _ReserveVertices(num_segments * 2 + 8);
+
+    if (!closed) {
+        // Single contour: start cap, left side forward, end cap, right side backward
+        uint32_t last = num_segments - 1;
+        subpath.start = pts[0] - normals[0] * wr;
+        _BeginSubpath(subpath);
+        stroker.Cap(pts[0], normals[0], dir(normals[0]), wl, wr, true);
+        for (uint32_t i = 0; i < last; i++) {
+            stroker.Join(pts[i + 1], normals[i], normals[i + 1], dir(normals[i]), wl, step_l,
+                         IvgMin(lengths[i], lengths[i + 1]));
+        }
+        stroker.Push(pts[n - 1] + normals[last] * wl);
+        stroker.Cap(pts[n - 1], normals[last], dir(normals[last]), wl, wr, false);
+        for (uint32_t i = last; i > 0; i--) {
+            stroker.Join(pts[i], -normals[i], -normals[i - 1], -dir(normals[i]), wr, step_r,
+                         IvgMin(lengths[i], lengths[i - 1]));
+        }
+        subpath.current = vtx_buf_[vtx_offset_ - 1];
+        _EndSubpath(subpath);
+        return;
+    }
+
+    // Closed polylines have one contour per side, starting in the middle of the first segment
+    subpath.start = (pts[0] + pts[1]) * 0.5f + normals[0] * wl;
+    _BeginSubpath(subpath);
+    for (uint32_t i = 0; i < num_segments; i++) {
+        uint32_t next = i + 1 == num_segments ? 0 : i + 1;
+        stroker.Join(pts[i + 1], normals[i], normals[next], dir(normals[i]), wl, step_l,
+                     IvgMin(lengths[i], lengths[next]));
+    }
+    subpath.current = vtx_buf_[vtx_offset_ - 1];
+    _EndSubpath(subpath);
+
+    subpath.start = (pts[0] + pts[1]) * 0.5f - normals[0] * wr;
+    _BeginSubpath(subpath);
+    for (uint32_t k = 0; k < num_segments; k++) {
+        uint32_t i = k == 0 ? 0 : num_segments - k;
+        uint32_t prev = i == 0 ? num_segments - 1 : i - 1;
+        stroker.Join(pts[i], -normals[i], -normals[prev], -dir(normals[i]), wr, step_r,
+                     IvgMin(lengths[i], lengths[prev]));
+    }
+    subpath.current = vtx_buf_[vtx_offset_ - 1];
+    _EndSubpath(subpath);
+}
+
+void IvgContext::_EmitStrokeCommand(uint32_t vtx_offset)
+{
+    uint32_t count = vtx_offset_ - vtx_offset;
+    if (count < 3) {
+        vtx_offset_ = vtx_offset;
+        return;
+    }
+
+    // Overlapping pieces of the outline only add up under the nonzero rule
+    IvgFillMode fill_mode = fill_mode_;
+    if (fill_mode != IvgFillMode_NonZero)
+        SetFillMode(IvgFillMode_NonZero);
+    _EmitDrawCommand(vtx_offset, count - 1);
+    if (fill_mode != IvgFillMode_NonZero)
+        SetFillMode(fill_mode);
+}
+
+void IvgContext::_EmitAnalyticStroke(const IvgV2* points, uint32_t count, bool closed)
+{
+    // Copy the points without repeats, zero length segments have no direction
+    _ReserveVertices(count);
+    uint32_t current_offset = vtx_offset_;
+    IvgV2* dst = vtx_buf_ + current_offset;
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (n == 0 || points[i] != dst[n - 1])
+            dst[n++] = points[i];
+    }
+    if (closed && n > 2 && dst[n - 1] == dst[0])
+        n--;
+    if (n < 2 || stroke_width_ <= 0.0f)
+        return;
+
+    // Miter tips reach miter_limit half widths from the joint, square caps reach sqrt(2) half widths
+    float reach = stroke_width_ * 0.5f * (stroke_join_ == IvgStrokeJoin_Miter ? IvgMax(miter_limit_, 1.5f) : 1.5f) + 1.0f;
+    IvgRect rect(IvgV2(FLT_MAX, FLT_MAX), IvgV2(-FLT_MAX, -FLT_MAX));
+    for (uint32_t i = 0; i < n; i++) {
+        rect.min.x = IvgMin(rect.min.x, dst[i].x);
+        rect.min.y = IvgMin(rect.min.y, dst[i].y);
+        rect.max.x = IvgMax(rect.max.x, dst[i].x);
+        rect.max.y = IvgMax(rect.max.y, dst[i].y);
+    }
+    rect.min.x = IvgMax(rect.min.x - reach, clip_rect_.min.x);
+    rect.min.y = IvgMax(rect.min.y - reach, clip_rect_.min.y);
+    rect.max.x = IvgMin(rect.max.x + reach, clip_rect_.max.x);
+    rect.max.y = IvgMin(rect.max.y + reach, clip_rect_.max.y);
+    if (rect.min.x >= rect.max.x || rect.min.y >= rect.max.y)
+        return;
+
+    vtx_offset_ += n;
+    _EmitStateCommands();
+    IvgStrokeCmd* cmd = _AllocateCommand<IvgStrokeCmd>();
+    cmd->header = IvgCommandHeader_Stroke;
+    cmd->vtx_offset = current_offset;
+    cmd->vtx_count = n;
+    cmd->join = (uint8_t)stroke_join_;
+    cmd->cap = (uint8_t)stroke_cap_;
+    cmd->closed = closed ? 1 : 0;
+    cmd->reserved = 0;
+    cmd->width = stroke_width_;
+    cmd->miter_limit = miter_limit_;
+    cmd->rect = rect;
+}
+
+// Transforms the vertices emitted since vtx_offset in place and replaces the fill rect with their bounds
+void IvgContext::_TransformVertices(uint32_t vtx_offset)
+{
+    if (transform_class_ == IvgTransformClass_Identity)
+        return;
+    _ResetFillRect();
+    IvgV2* vertices = vtx_buf_ + vtx_offset;
+    transform_kernel_->transform[transform_class_](&transform_, vertices, vtx_offset_ - vtx_offset, vertices, &fill_rect_);
+}
+
+// Appends the path flattened in path space at the current flattening tolerance, going through the path cache when it
+// is enabled. Returns the number of vertices, or 0 with nothing appended when there is nothing to fill.
+uint32_t IvgContext::_AppendPathVertices(const IvgPath& path, IvgRect& bounds)
+{
+    uint32_t current_offset = vtx_offset_;
+    bool use_cache = path_cache_.budget_ != 0;
+    if (use_cache) {
+        if (path.version_ == 0)
+            path.version_ = path_version_counter.fetch_add(1, std::memory_order_relaxed) + 1;
+        IvgPathCacheEntry* entry = path_cache_.Find(path.version_, flatten_tolerance_);
+        if (entry) {
+            if (entry->vtx_count < 3)
+                return 0;
+            _ReserveVertices(entry->vtx_count);
+            std::memcpy(vtx_buf_ + vtx_offset_, entry->vertices, entry->vtx_count * sizeof(IvgV2));
+            vtx_offset_ += entry->vtx_count;
+            bounds = entry->bounds;
+            return entry->vtx_count;
+        }
+        path_cache_.stats_.misses++;
+    }
+
+    fill_rect_.min = IvgV2(FLT_MAX, FLT_MAX);
+    fill_rect_.max = IvgV2(-FLT_MAX, -FLT_MAX);
+    _FlattenPath(path.cmd_, path.cmd_size_, path.coords_);
+    uint32_t count = vtx_offset_ - current_offset;
+    bounds = fill_rect_;
+    if (count < 3) {
+        if (use_cache)
+            path_cache_.Insert(path.version_, flatten_tolerance_, nullptr, 0, bounds);
+        vtx_offset_ = current_offset;
+        return 0;
+    }
+    if (use_cache)
+        path_cache_.Insert(path.version_, flatten_tolerance_, vtx_buf_ + current_offset, count, bounds);
+    return count;
+}
+
+// Stroke widths are in pixels, so strokes are built from the transformed points
+const IvgV2* IvgContext::_TransformStrokeInput(const IvgV2* points, uint32_t count)
+{
+    if (transform_class_ == IvgTransformClass_Identity)
+        return points;
+    IvgRect bounds;
+    stroke_input_.resize((int)count);
+    transform_kernel_->transform[transform_class_](&transform_, points, count, stroke_input_.Data, &bounds);
+    return stroke_input_.Data;
+}
+
+void IvgContext::_EmitStateCommands()
 {
     IVG_ASSERT(paint_ != nullptr && "Paint object must be set");
 
@@ -149,35 +2217,54 @@ void IvgContext::_EmitDrawCommand(uint32_t vtx_offset, uint32_t vtx_count)
         }
     }
 
-    if (state_update_flags & ClipRectUpdate) {
-        IvgSetClipRectCmd* cmd = _AllocateCommand<IvgSetClipRectCmd>();
-        cmd->header = IvgCommandHeader_SetClipRect;
-        cmd->x = (int32_t)clip_rect_.min.x;
-        cmd->y = (int32_t)clip_rect_.min.y;
-        cmd->w = (int32_t)std::ceil(clip_rect_.max.x - clip_rect_.min.x);
-        cmd->h = (int32_t)std::ceil(clip_rect_.max.y - clip_rect_.min.y);
-    }
+    _EmitClipRectCommand();
 
     if (state_update_flags & ColorStateUpdate) {
         // TODO
     }
+    state_update_flags = 0;
+}
+
+void IvgContext::_EmitClipRectCommand()
+{
+    if (!(state_update_flags & ClipRectUpdate))
+        return;
+    IvgSetClipRectCmd* cmd = _AllocateCommand<IvgSetClipRectCmd>();
+    cmd->header = IvgCommandHeader_SetClipRect;
+    cmd->x = (int32_t)clip_rect_.min.x;
+    cmd->y = (int32_t)clip_rect_.min.y;
+    cmd->w = (int32_t)std::ceil(clip_rect_.max.x - clip_rect_.min.x);
+    cmd->h = (int32_t)std::ceil(clip_rect_.max.y - clip_rect_.min.y);
+    state_update_flags &= ~ClipRectUpdate;
+}
 
+bool IvgContext::_EmitDrawCommand(uint32_t vtx_offset, uint32_t vtx_count, IvgCommandHeader header)
+{
     // Clip fill rect to clip rect
     fill_rect_.min.x = IvgMax(fill_rect_.min.x, clip_rect_.min.x);
     fill_rect_.min.y = IvgMax(fill_rect_.min.y, clip_rect_.min.y);
     fill_rect_.max.x = IvgMin(fill_rect_.max.x, clip_rect_.max.x);
     fill_rect_.max.y = IvgMin(fill_rect_.max.y, clip_rect_.max.y);
 
-    IvgDrawCmd* cmd = _AllocateCommand<IvgDrawCmd>();
+    // Draws outside the clip rect are dropped before they take any command or winding space. Their vertices are
+    // given back unless they belong to the immediate path, which may still be preserved for another draw.
     int32_t min_x = (int32_t)fill_rect_.min.x;
     int32_t min_y = (int32_t)fill_rect_.min.y;
     int32_t max_x = (int32_t)std::ceil(fill_rect_.max.x);
     int32_t max_y = (int32_t)std::ceil(fill_rect_.max.y);
-    cmd->header = IvgCommandHeader_Draw;
+    if (max_x <= min_x || max_y <= min_y) {
+        if (vtx_offset < vtx_offset_ && !(imm_active_ && vtx_offset == imm_vtx_start_))
+            vtx_offset_ = vtx_offset;
+        return false;
+    }
+
+    _EmitStateCommands();
+    IvgDrawCmd* cmd = _AllocateCommand<IvgDrawCmd>();
+    cmd->header = header;
     cmd->w = (uint32_t)(max_x - min_x);
     cmd->h = (uint32_t)(max_y - min_y);
     cmd->vtx_count = vtx_count;
     cmd->vtx_offset = vtx_offset;
     cmd->rect = fill_rect_;
-    state_update_flags = 0;
+    return true;
 }
@@ -32,6 +32,29 @@ enum IvgStrokeOffset
     IvgStrokeOffset_Outside,
 };
 
+enum IvgStrokeMode
+{
+    IvgStrokeMode_Outline,  // Strokes are expanded into outline polygons and filled
+    IvgStrokeMode_Analytic, // Raw polylines, coverage is computed from the distance to each segment on the GPU
+};
+
+enum IvgCurveMode
+{
+    IvgCurveMode_Flatten,   // Curves of filled paths are flattened into lines on the CPU
+    IvgCurveMode_Quadratic, // Quadratic segments, coverage is computed from the curves on the GPU
+};
+
+// Optional commands a backend can draw, see IvgContext::SetBackendFeatures. Draws needing a missing feature are
+// recorded with the commands every backend supports instead.
+enum IvgBackendFeatures
+{
+    IvgBackendFeatures_None = 0,
+    IvgBackendFeatures_AnalyticStroke = 1 << 0, // IvgCommandHeader_Stroke
+    IvgBackendFeatures_Curves = 1 << 1,         // IvgCommandHeader_DrawCurves
+    IvgBackendFeatures_Instances = 1 << 2,      // IvgCommandHeader_DrawInstances
+    IvgBackendFeatures_All = IvgBackendFeatures_AnalyticStroke | IvgBackendFeatures_Curves | IvgBackendFeatures_Instances,
+};
+
 enum IvgFillMode
 {
     IvgFillMode_NonZero,
@@ -45,6 +68,24 @@ enum IvgPaintType
     IvgPaintType_Radial,
 };
 
+enum IvgSimdLevel
+{
+    IvgSimdLevel_Scalar,
+    IvgSimdLevel_SSE2,
+    IvgSimdLevel_AVX2,
+};
+
+// Transforms are classified when they are set so points are transformed by the cheapest matching loop
+enum IvgTransformClass
+{
+    IvgTransformClass_Identity,
+    IvgTransformClass_Translate,
+    IvgTransformClass_ScaleTranslate,
+    IvgTransformClass_Affine,
+    IvgTransformClass_Projective,
+    IvgTransformClass_Count,
+};
+
 enum IvgPathCmd
 {
     IvgPathCmd_Close,
@@ -167,6 +208,28 @@ static inline IvgMat operator*(const IvgMat& a, const IvgMat& b)
     return ret;
 }
 
+// Points are column vectors, the translation is stored in m[2] and m[5]
+static inline IvgV2 IvgTransformPoint(const IvgMat& mat, const IvgV2& p)
+{
+    const float* m = mat.m;
+    float x = p.x * m[0] + p.y * m[1] + m[2];
+    float y = p.y * m[4] + p.x * m[3] + m[5];
+    if (m[6] == 0.0f && m[7] == 0.0f && m[8] == 1.0f)
+        return IvgV2(x, y);
+    float w = p.x * m[6] + p.y * m[7] + m[8];
+    return IvgV2(x / w, y / w);
+}
+
+static inline IvgMat IvgMatTranslate(float x, float y)
+{
+    return IvgMat(1.0f, 0.0f, x, 0.0f, 1.0f, y, 0.0f, 0.0f, 1.0f);
+}
+
+static inline IvgMat IvgMatScale(float x, float y)
+{
+    return IvgMat(x, 0.0f, 0.0f, 0.0f, y, 0.0f, 0.0f, 0.0f, 1.0f);
+}
+
 struct IvgColor
 {
     float r, g, b, a;
@@ -214,6 +277,21 @@ struct IvgPaint
     inline void PushGradientStop() {}
 };
 
+// Number of coordinates stored after each path command. ArcTo is always stored in center form:
+// cx, cy, rh, rv, rotation, start_angle, end_angle (angles in radians).
+static inline uint32_t IvgGetPathCmdCoordCount(IvgPathCmd cmd)
+{
+    switch (cmd) {
+        case IvgPathCmd_MoveTo: return 2;
+        case IvgPathCmd_LineTo: return 2;
+        case IvgPathCmd_QuadTo: return 4;
+        case IvgPathCmd_CubicTo: return 6;
+        case IvgPathCmd_ArcTo: return 7;
+        default: break;
+    }
+    return 0;
+}
+
 struct IvgPath
 {
     IvgPathCmd* cmd_;
@@ -221,6 +299,12 @@ struct IvgPath
     uint32_t cmd_size_;
     uint32_t cmd_capacity_;
     uint32_t coord_size_;
+    uint32_t coord_capacity_;
+    IvgV2 start_point_;
+    IvgV2 current_point_;
+    // Identifies the path content for the flattened geometry cache. Reset to 0 by every modification and assigned
+    // a new unique value when the path is drawn.
+    mutable uint64_t version_;
 
     IvgPath();
     IvgPath(IvgPath&& path);
@@ -246,6 +330,69 @@ struct IvgPath
     void Reserve(uint32_t cmd_capacity, uint32_t coord_capacity);
     void ShrinkToFit();
     void Clone(IvgPath* path);
+    void Clear();
+
+    void _PushCommand(IvgPathCmd cmd, const IvgCoord* coords, uint32_t num_coords);
+    void _UpdateCurrentPoint(const IvgPathCmd* cmd, uint32_t num_cmds, const IvgCoord* coords);
+};
+
+struct IvgFlattenKernel;
+struct IvgTransformKernel;
+struct IvgCurveBatch;
+
+struct IvgPathCacheEntry
+{
+    uint64_t version;
+    float tolerance;
+    uint32_t last_used_frame;
+    uint32_t vtx_count;
+    IvgV2* vertices;
+    IvgRect bounds;
+};
+
+struct IvgPathCacheStats
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t memory_used;
+    uint32_t num_entries;
+};
+
+struct IvgReorderStats
+{
+    uint32_t num_draws;
+    uint32_t batches_before; // runs of fills, strokes and other draws in recording order
+    uint32_t batches_after;
+};
+
+// Draw of the frame being reordered by IvgContext::_ReorderDraws, offsets are into the command buffer
+struct IvgReorderItem
+{
+    uint32_t cmd;
+    uint32_t draw_state;
+    uint32_t clip;
+    uint32_t kind;
+    uint32_t batch;
+};
+
+// Keeps flattened vertex runs of IvgPath objects across frames. Entries are evicted in least-recently-used order
+// at the end of a frame when the memory budget is exceeded.
+struct IvgPathCache
+{
+    IvgVector<IvgPathCacheEntry> entries_;
+    IvgVector<int32_t> index_;
+    size_t budget_ = 4u << 20;
+    uint32_t frame_ = 0;
+    IvgPathCacheStats stats_{};
+
+    ~IvgPathCache();
+
+    IvgPathCacheEntry* Find(uint64_t version, float tolerance);
+    IvgPathCacheEntry* Insert(uint64_t version, float tolerance, const IvgV2* vertices, uint32_t vtx_count, const IvgRect& bounds);
+    void Trim();
+    void Clear();
+    void _RebuildIndex();
 };
 
 struct IvgBackend
@@ -260,6 +407,12 @@ enum IvgCommandHeader
     IvgCommandHeader_SetDrawState,
     IvgCommandHeader_SetClipRect,
     IvgCommandHeader_Draw,
+    IvgCommandHeader_DrawList,
+    IvgCommandHeader_Stroke,
+    IvgCommandHeader_DrawInstances,
+    IvgCommandHeader_DrawCurves, // Uses IvgDrawCmd
+    IvgCommandHeader_DrawRect,   // Uses IvgDrawCmd
+    IvgCommandHeader_DrawConvex, // Uses IvgDrawCmd
 };
 
 struct IvgSetDrawStateCmd
@@ -279,6 +432,10 @@ struct IvgSetClipRectCmd
     uint32_t w, h;
 };
 
+// Fill of the closed vertex run of vtx_count + 1 points at vtx_offset. With IvgCommandHeader_DrawCurves the run is
+// made of vtx_count quadratic segments instead, segment i is (vtx[2i], vtx[2i + 1], vtx[2i + 2]) and every segment
+// is monotonic in x. With IvgCommandHeader_DrawRect the run is an axis-aligned rect with opposite corners vtx[0] and
+// vtx[2], and with IvgCommandHeader_DrawConvex a convex polygon. Backends may fill both in a single pass.
 struct IvgDrawCmd
 {
     uint32_t header;
@@ -288,12 +445,63 @@ struct IvgDrawCmd
     IvgRect rect;
 };
 
+struct IvgDrawListCmd
+{
+    uint32_t header;
+    uint32_t list_index; // Index into IvgContext::draw_lists_
+    IvgV2 translation;
+    IvgRect clip;
+};
+
+// Analytic stroke of the polyline made of vtx_count points starting at vtx_offset. Closed polylines connect the last
+// point back to the first one. rect bounds the stroke including joins and caps.
+struct IvgStrokeCmd
+{
+    uint32_t header;
+    uint32_t vtx_offset;
+    uint32_t vtx_count;
+    uint8_t join;
+    uint8_t cap;
+    uint8_t closed;
+    uint8_t reserved;
+    float width;
+    float miter_limit;
+    IvgRect rect;
+};
+
+// Fills instance_count instances of the closed vertex run of vtx_count + 1 points at vtx_offset, each with its own
+// transform and color. Every instance has its own coverage region, region_size is the size of all of them together.
+struct IvgDrawInstancesCmd
+{
+    uint32_t header;
+    uint32_t vtx_offset;
+    uint32_t vtx_count;
+    uint32_t instance_offset; // Index into IvgContext::instances_
+    uint32_t instance_count;
+    uint32_t region_size;
+    IvgFillMode fill_mode;
+};
+
+// Per-instance data of IvgDrawInstancesCmd, laid out to be read directly by backends. rect is the pixel region of the
+// instance clipped to the clip rect. region_offset is the offset of its coverage region relative to the first instance
+// of the command, regions are ceil(max) - floor(min) pixels wide.
+struct IvgPathInstance
+{
+    IvgRect rect;
+    float transform[6]; // First two rows of the matrix applied to the path
+    uint32_t color;
+    uint32_t region_offset;
+};
+
 union IvgBackendCommand
 {
     uint32_t header;
     IvgSetDrawStateCmd set_draw_state;
     IvgSetClipRectCmd set_clip_rect;
     IvgDrawCmd draw;
+    IvgDrawListCmd draw_list;
+    IvgStrokeCmd stroke;
+    IvgDrawInstancesCmd draw_instances;
 };
 
 union IvgCmdBufPtr
@@ -302,6 +510,48 @@ union IvgCmdBufPtr
     IvgBackendCommand* cmd_data;
 };
 
+// Commands and vertices recorded once with IvgContext::BeginDrawList/EndDrawList and replayed any number of times
+// with IvgContext::DrawList. Backends keep their own copy of the geometry keyed by id_, so replaying a list does not
+// upload its vertices again. Recording again assigns a new id_; release the backend copy of the old one first.
+struct IvgDrawList
+{
+    IvgV2* vtx_buf_{};
+    uint32_t vtx_count_{};
+    IvgByte* cmd_buf_{};
+    uint32_t cmd_size_{};
+    IvgRect bounds_;
+    uint64_t id_{};
+
+    IvgDrawList() = default;
+    IvgDrawList(const IvgDrawList&) = delete;
+    ~IvgDrawList();
+
+    IvgDrawList& operator=(const IvgDrawList&) = delete;
+
+    void Clear();
+};
+
+// Subpath bookkeeping while flattening a path into a single closed vertex run
+struct IvgSubpathState
+{
+    IvgV2 anchor;
+    IvgV2 start;
+    IvgV2 current;
+    uint32_t first_vertex;
+    bool has_anchor;
+    bool has_start;
+    bool open;
+};
+
+// Polyline of an immediate path subpath inside its vertex run, relative to the start of the run. end is 0 while
+// the subpath is still open.
+struct IvgSubpathSpan
+{
+    uint32_t first;
+    uint32_t end;
+    bool closed;
+};
+
 struct IvgContext
 {
     enum StateUpdate
@@ -312,16 +562,33 @@ struct IvgContext
     };
 
     IvgBackend backend_;
-    IvgStrokeJoin stroke_join_;
-    IvgFillMode fill_mode_;
-    float stroke_width_;
-    float miter_limit_;
-    IvgPath imm_path_;
-    IvgRect clip_rect_;
+    IvgStrokeJoin stroke_join_ = IvgStrokeJoin_Miter;
+    IvgStrokeCap stroke_cap_ = IvgStrokeCap_Butt;
+    IvgStrokeOffset stroke_offset_ = IvgStrokeOffset_Center;
+    IvgStrokeMode stroke_mode_ = IvgStrokeMode_Outline;
+    IvgCurveMode curve_mode_ = IvgCurveMode_Flatten;
+    uint32_t backend_features_ = IvgBackendFeatures_All;
+    IvgFillMode fill_mode_ = IvgFillMode_NonZero;
+    float stroke_width_ = 1.0f;
+    float miter_limit_ = 4.0f;
+    float tessellation_tolerance_ = 0.25f;
+    // Tolerance used to flatten curves in path space, the tessellation tolerance divided by the transform scale and
+    // rounded down to a power of two
+    float flatten_tolerance_ = 0.25f;
+    IvgMat transform_;
+    IvgTransformClass transform_class_ = IvgTransformClass_Identity;
+    float transform_scale_ = 1.0f;
+    IvgPathCache path_cache_;
+    IvgRect clip_rect_; // Clip rect passed to SetClipRect within the damage rect, what draws are culled against
+    IvgRect user_clip_rect_;
+    IvgRect damage_rect_;
+    bool has_damage_rect_ = false;
     IvgRect fill_rect_;
     uint32_t fb_width_ = 0;
     uint32_t fb_height_ = 0;
-    const IvgPaint* paint_;
+    const IvgPaint* paint_{};
+    const IvgFlattenKernel* flatten_kernel_;
+    const IvgTransformKernel* transform_kernel_;
 
     IvgV2* vtx_buf_{};
     uint32_t vtx_count_{};
@@ -333,6 +600,43 @@ struct IvgContext
     uint32_t cmd_size_{};
     uint32_t cmd_offset_{};
 
+    // Immediate path, flattened directly into vtx_buf_ as the commands arrive
+    IvgSubpathState imm_subpath_{};
+    IvgVector<IvgSubpathSpan> imm_spans_;
+    IvgRect imm_bounds_;
+    uint32_t imm_vtx_start_{};
+    uint32_t imm_vtx_end_{};
+    uint32_t imm_cmd_start_{};
+    bool imm_active_{};
+    bool imm_drawn_{};
+
+    // Scratch buffers of the stroker, kept to avoid allocating for every stroke
+    IvgVector<IvgV2> stroke_points_;
+    IvgVector<IvgV2> stroke_normals_;
+    IvgVector<float> stroke_lengths_;
+    IvgVector<IvgV2> stroke_input_;
+
+    IvgVector<IvgPathInstance> instances_;
+
+    // Quadratic run of the path being filled in IvgCurveMode_Quadratic, before and after the transform
+    IvgVector<IvgV2> curve_path_;
+    IvgVector<IvgV2> curve_input_;
+
+    IvgVector<const IvgDrawList*> draw_lists_;
+    IvgDrawList* recording_list_{};
+
+    // Scratch buffers of the draw reordering at the end of the frame
+    bool reorder_draws_{};
+    IvgReorderStats reorder_stats_{};
+    IvgVector<IvgReorderItem> reorder_items_;
+    IvgVector<int32_t> reorder_grid_;
+    IvgVector<int32_t> reorder_batches_[4];
+    IvgVector<uint32_t> reorder_offsets_;
+    IvgVector<uint32_t> reorder_order_;
+    IvgVector<IvgByte> reorder_cmds_;
+    uint32_t list_vtx_start_{};
+    uint32_t list_cmd_start_{};
+
     IvgContext();
     ~IvgContext();
 
@@ -359,6 +663,54 @@ struct IvgContext
 
     inline void SetStrokeJoin(IvgStrokeJoin join) { stroke_join_ = join; }
 
+    inline void SetStrokeCap(IvgStrokeCap cap) { stroke_cap_ = cap; }
+
+    // Placement of the stroke relative to the outline. Inside and outside refer to the interior of closed shapes;
+    // for open polylines inside is the left side in the direction of the polyline.
+    inline void SetStrokeOffset(IvgStrokeOffset offset) { stroke_offset_ = offset; }
+
+    // Analytic strokes upload the polyline points only and need a backend supporting IvgCommandHeader_Stroke.
+    // Inside and outside stroke offsets, and backends without IvgBackendFeatures_AnalyticStroke in
+    // SetBackendFeatures, are always stroked as outlines.
+    inline void SetStrokeMode(IvgStrokeMode mode) { stroke_mode_ = mode; }
+
+    // IvgBackendFeatures flags of the backend the context is submitted to. All by default, as the Vulkan backend
+    // draws every optional command. Contexts submitted to a backend lacking some must pass its flags before recording,
+    // IvgBackendVulkan_GetFeatures for instance, or the commands are recorded anyway.
+    inline void SetBackendFeatures(uint32_t features) { backend_features_ = features; }
+
+    // Quadratic curves need a backend supporting IvgCommandHeader_DrawCurves and apply to FillPath and
+    // FillPathBuffer. Cubics and arcs are approximated by quadratic segments within the tessellation tolerance.
+    // Immediate paths, projective transforms and backends without IvgBackendFeatures_Curves in SetBackendFeatures
+    // are always flattened.
+    inline void SetCurveMode(IvgCurveMode mode) { curve_mode_ = mode; }
+
+    // Maximum distance in pixels between a curve and its flattened polyline
+    inline void SetTessellationTolerance(float tolerance)
+    {
+        tessellation_tolerance_ = tolerance;
+        flatten_tolerance_ = _QuantizeTolerance(tolerance / transform_scale_);
+    }
+
+    // Memory budget of the flattened path cache in bytes, 0 disables the cache
+    inline void SetPathCacheBudget(size_t bytes)
+    {
+        path_cache_.budget_ = bytes;
+        if (bytes == 0)
+            path_cache_.Clear();
+    }
+
+    inline const IvgPathCacheStats& GetPathCacheStats() const { return path_cache_.stats_; }
+
+    // Moves fills and strokes that do not overlap anything drawn between them next to each other in End(), so backends
+    // record fewer batches. The result is the same as in recording order. Needs the framebuffer size.
+    inline void SetDrawReordering(bool enable) { reorder_draws_ = enable; }
+
+    inline const IvgReorderStats& GetReorderStats() const { return reorder_stats_; }
+
+    // Selects the curve flattening kernel. Falls back to the best supported level if the CPU does not support it.
+    void SetSimdLevel(IvgSimdLevel level);
+
     inline void SetFillMode(IvgFillMode fill_mode)
     {
         fill_mode_ = fill_mode;
@@ -367,24 +719,59 @@ struct IvgContext
 
     inline void SetClipRect(const IvgRect& rect)
     {
-        clip_rect_ = rect;
-        state_update_flags |= ClipRectUpdate;
+        user_clip_rect_ = rect;
+        _UpdateClipRect();
     }
 
-    inline void SetTransformMatrix(const IvgMat& mat);
+    // Part of the framebuffer redrawn this frame. Every clip rect is intersected with it, so draws outside of it are
+    // culled when they are recorded and the pixels outside of it are left untouched. Draw lists are recorded without
+    // it and clipped to it when they are replayed. Kept until ResetDamageRect.
+    inline void SetDamageRect(const IvgRect& rect)
+    {
+        damage_rect_ = rect;
+        has_damage_rect_ = true;
+        _UpdateClipRect();
+    }
+
+    inline void ResetDamageRect()
+    {
+        has_damage_rect_ = false;
+        _UpdateClipRect();
+    }
+
+    // Transform applied to the points of fills and strokes when they are emitted. Stroke widths stay in pixels.
+    void SetTransformMatrix(const IvgMat& mat);
+
+    inline const IvgMat& GetTransformMatrix() const { return transform_; }
+
+    inline IvgTransformClass GetTransformClass() const { return transform_class_; }
 
     void StrokeRect(const IvgV2& min_bb, const IvgV2& max_bb);
     void StrokeLine(const IvgV2& p0, const IvgV2& p1);
     void StrokeTriangle(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2);
     void StrokePolyline(const IvgV2* points, const uint32_t count);
 
+    // Rects kept axis-aligned by the transform are recorded as IvgCommandHeader_DrawRect, which needs no backend
+    // feature: backends without a rect path fill them like any other polygon.
     void FillRect(const IvgV2& min_bb, const IvgV2& max_bb);
     void FillTriangle(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2);
     void FillPolygon(const IvgV2* points, const uint32_t count);
     void FillPath(const IvgPath& path);
     void FillPathBuffer(const IvgPathCmd* cmd, const IvgCoord* coord, uint32_t num_commands);
 
-    // Immediate path command
+    // Fills count copies of path, each transformed by transforms[i] and then by the current transform, with the first
+    // color of paints[i]. The path is flattened and uploaded once for all of them. Backends without
+    // IvgBackendFeatures_Instances get one FillPath per instance instead.
+    void DrawPathInstances(const IvgPath& path, const IvgMat* transforms, const IvgPaint* paints, uint32_t count);
+
+    // Draw calls between BeginDrawList and EndDrawList are stored into the list instead of the current frame
+    void BeginDrawList(IvgDrawList* list);
+    void EndDrawList();
+    // Replays a recorded list offset by translation and clipped to the current clip rect
+    void DrawList(const IvgDrawList& list, const IvgV2& translation = IvgV2());
+
+    // Immediate path command. The path is flattened while it is built, so other draw calls issued in between only
+    // cost a copy of the path when it is extended afterwards.
     void BeginPath();
     void MoveTo(IvgCoord x, IvgCoord y);
     void MoveTo(const IvgV2& p);
@@ -445,6 +832,26 @@ struct IvgContext
         fill_rect_.max.y = 0.0f;
     }
 
+    inline void _UpdateClipRect()
+    {
+        clip_rect_ = user_clip_rect_;
+        if (has_damage_rect_ && !recording_list_) {
+            clip_rect_.min.x = IvgMax(clip_rect_.min.x, damage_rect_.min.x);
+            clip_rect_.min.y = IvgMax(clip_rect_.min.y, damage_rect_.min.y);
+            clip_rect_.max.x = IvgMax(IvgMin(clip_rect_.max.x, damage_rect_.max.x), clip_rect_.min.x);
+            clip_rect_.max.y = IvgMax(IvgMin(clip_rect_.max.y, damage_rect_.max.y), clip_rect_.min.y);
+        }
+        state_update_flags |= ClipRectUpdate;
+    }
+
+    inline void _ExpandFillRect(const IvgRect& rect)
+    {
+        fill_rect_.min.x = IvgMin(fill_rect_.min.x, rect.min.x);
+        fill_rect_.min.y = IvgMin(fill_rect_.min.y, rect.min.y);
+        fill_rect_.max.x = IvgMax(fill_rect_.max.x, rect.max.x);
+        fill_rect_.max.y = IvgMax(fill_rect_.max.y, rect.max.y);
+    }
+
     template <typename T>
     inline T* _AllocateCommand()
     {
@@ -458,7 +865,43 @@ struct IvgContext
 
     void _ReserveVertices(uint32_t count);
     void _ReserveCommandBytes(uint32_t size);
-    void _EmitDrawCommand(uint32_t vtx_offset, uint32_t vtx_count);
+    void _EmitStateCommands();
+    void _EmitClipRectCommand();
+    bool _EmitDrawCommand(uint32_t vtx_offset, uint32_t vtx_count, IvgCommandHeader header = IvgCommandHeader_Draw);
+    void _ReorderDraws();
+    static float _QuantizeTolerance(float tolerance);
+    void _FlattenQuad(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2);
+    void _FlattenCubic(const IvgV2& p0, const IvgV2& p1, const IvgV2& p2, const IvgV2& p3);
+    void _FlattenCurveBatch(IvgPathCmd type, IvgCurveBatch* batch);
+    void _FlattenArc(const IvgV2& c, const IvgV2& r, float rotation, float start_angle, float end_angle);
+    void _FlattenArcCommand(IvgSubpathState& subpath, const IvgCoord* coords);
+    void _FlattenPath(const IvgPathCmd* cmd, uint32_t num_cmds, const IvgCoord* coords);
+    void _BeginSubpath(IvgSubpathState& subpath);
+    void _EndSubpath(IvgSubpathState& subpath);
+    void _BeginImmCommand();
+    void _EndImmCommand();
+    void _EndImmSubpath(bool closed);
+    void _StrokePolyline(IvgSubpathState& subpath, const IvgV2* points, uint32_t count, bool closed);
+    void _EmitStrokeCommand(uint32_t vtx_offset);
+    void _EmitAnalyticStroke(const IvgV2* points, uint32_t count, bool closed);
+    void _TransformVertices(uint32_t vtx_offset);
+    uint32_t _AppendPathVertices(const IvgPath& path, IvgRect& bounds);
+    void _FillCurvePath(const IvgPath* path, const IvgPathCmd* cmd, const IvgCoord* coords, uint32_t num_cmds);
+    void _BuildCurvePath(const IvgPathCmd* cmd, uint32_t num_cmds, const IvgCoord* coords);
+    void _PushCurveSegment(const IvgV2& p0, const IvgV2& c, const IvgV2& p1);
+    const IvgV2* _TransformStrokeInput(const IvgV2* points, uint32_t count);
+
+    inline bool _UseAnalyticStroke() const
+    {
+        return stroke_mode_ == IvgStrokeMode_Analytic && stroke_offset_ == IvgStrokeOffset_Center &&
+               (backend_features_ & IvgBackendFeatures_AnalyticStroke);
+    }
+
+    inline bool _UseCurveFill() const
+    {
+        return curve_mode_ == IvgCurveMode_Quadratic && transform_class_ != IvgTransformClass_Projective &&
+               (backend_features_ & IvgBackendFeatures_Curves);
+    }
 };
 
 namespace ImVG
@@ -0,0 +1,673 @@
+#include "imvg.h"
+#include "imvg_simd.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+static const char* simd_level_names[] = {
+    "Scalar",
+    "SSE2",
+    "AVX2",
+};
+
+using BenchClock = std::chrono::high_resolution_clock;
+
+static double SecondsSince(BenchClock::time_point start)
+{
+    return std::chrono::duration<double>(BenchClock::now() - start).count();
+}
+
+static void GenerateCurves(IvgVector<IvgCurveBatch>& batches, uint32_t num_curves, float size)
+{
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> dist_pos(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> dist_ctrl(-size, size);
+    batches.resize((num_curves + IVG_CURVE_BATCH_SIZE - 1) / IVG_CURVE_BATCH_SIZE);
+    for (int i = 0; i < batches.Size; i++) {
+        IvgCurveBatch& batch = batches[i];
+        batch.count = IVG_CURVE_BATCH_SIZE;
+        for (uint32_t k = 0; k < IVG_CURVE_BATCH_SIZE; k++) {
+            float x = dist_pos(rng);
+            float y = dist_pos(rng);
+            for (uint32_t j = 0; j < 4; j++) {
+                batch.x[j][k] = x + dist_ctrl(rng);
+                batch.y[j][k] = y + dist_ctrl(rng);
+            }
+        }
+    }
+}
+
+static uint32_t FlattenAll(const IvgFlattenKernel* kernel, IvgPathCmd type, IvgVector<IvgCurveBatch>& batches, IvgVector<IvgV2>& out)
+{
+    IvgRect bounds(IvgV2(FLT_MAX, FLT_MAX), IvgV2(-FLT_MAX, -FLT_MAX));
+    IvgV2* dst = out.Data;
+    uint32_t total = 0;
+    for (int i = 0; i < batches.Size; i++) {
+        IvgCurveBatch& batch = batches[i];
+        if (type == IvgPathCmd_QuadTo) {
+            total += kernel->quad_segment_count(&batch, 0.25f);
+            dst = kernel->emit_quad(&batch, dst, &bounds);
+        }
+        else {
+            total += kernel->cubic_segment_count(&batch, 0.25f);
+            dst = kernel->emit_cubic(&batch, dst, &bounds);
+        }
+    }
+    return total;
+}
+
+static void BenchKernels(IvgPathCmd type, float size)
+{
+    const uint32_t num_curves = 100000;
+    const uint32_t num_iterations = 20;
+    IvgVector<IvgCurveBatch> batches;
+    GenerateCurves(batches, num_curves, size);
+
+    const IvgFlattenKernel* scalar = IvgGetFlattenKernel(IvgSimdLevel_Scalar);
+    uint32_t num_segments = 0;
+    for (int i = 0; i < batches.Size; i++) {
+        if (type == IvgPathCmd_QuadTo)
+            num_segments += scalar->quad_segment_count(&batches[i], 0.25f);
+        else
+            num_segments += scalar->cubic_segment_count(&batches[i], 0.25f);
+    }
+
+    IvgVector<IvgV2> reference;
+    reference.resize(num_segments);
+    FlattenAll(scalar, type, batches, reference);
+
+    std::printf("%s, %u curves, control point spread %.0f, %u segments\n", type == IvgPathCmd_QuadTo ? "Quadratic" : "Cubic",
+                num_curves, size, num_segments);
+
+    IvgVector<IvgV2> out;
+    out.resize(reference.Size);
+    for (uint32_t level = IvgSimdLevel_Scalar; level <= IvgSimdLevel_AVX2; level++) {
+        const IvgFlattenKernel* kernel = IvgGetFlattenKernel((IvgSimdLevel)level);
+        if (!kernel) {
+            std::printf("  %-8s not supported\n", simd_level_names[level]);
+            continue;
+        }
+
+        auto start = BenchClock::now();
+        for (uint32_t i = 0; i < num_iterations; i++)
+            FlattenAll(kernel, type, batches, out);
+        double seconds = SecondsSince(start);
+
+        bool identical = std::memcmp(out.Data, reference.Data, num_segments * sizeof(IvgV2)) == 0;
+        double segments_per_second = (double)num_segments * num_iterations / seconds;
+        std::printf("  %-8s %8.2f Msegments/s %s\n", simd_level_names[level], segments_per_second * 1e-6,
+                    identical ? "" : "(OUTPUT MISMATCH)");
+    }
+}
+
+static void BenchFillPath()
+{
+    const uint32_t num_paths = 2000;
+    const uint32_t num_iterations = 20;
+    std::mt19937 rng(5678);
+    std::uniform_real_distribution<float> dist_pos(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> dist_ctrl(-40.0f, 40.0f);
+
+    // Icon-like paths made of cubic runs
+    IvgVector<IvgPath*> paths;
+    for (uint32_t i = 0; i < num_paths; i++) {
+        IvgPath* path = new IvgPath();
+        float x = dist_pos(rng);
+        float y = dist_pos(rng);
+        path->MoveTo(x, y);
+        for (uint32_t j = 0; j < 16; j++)
+            path->CubicTo(x + dist_ctrl(rng), y + dist_ctrl(rng), x + dist_ctrl(rng), y + dist_ctrl(rng), x + dist_ctrl(rng), y + dist_ctrl(rng));
+        path->Close();
+        paths.push_back(path);
+    }
+
+    std::printf("FillPath, %u paths of 16 cubics\n", num_paths);
+
+    IvgPaint paint(255, 255, 255, 255);
+    IvgVector<IvgV2> reference;
+    for (uint32_t level = IvgSimdLevel_Scalar; level <= IvgSimdLevel_AVX2; level++) {
+        if (!IvgGetFlattenKernel((IvgSimdLevel)level)) {
+            std::printf("  %-8s not supported\n", simd_level_names[level]);
+            continue;
+        }
+
+        IvgContext ctx;
+        ctx.SetSimdLevel((IvgSimdLevel)level);
+        ctx.SetPathCacheBudget(0);
+        ctx.SetFramebufferSize(1024, 1024);
+        uint32_t num_vertices = 0;
+        auto start = BenchClock::now();
+        for (uint32_t i = 0; i < num_iterations; i++) {
+            ctx.Begin();
+            ctx.SetClipRect(IvgRect(0.0f, 0.0f, 1024.0f, 1024.0f));
+            ctx.SetPaint(&paint);
+            for (int j = 0; j < paths.Size; j++)
+                ctx.FillPath(*paths[j]);
+            ctx.End();
+            num_vertices = ctx.vtx_offset_;
+        }
+        double seconds = SecondsSince(start);
+
+        bool identical = true;
+        if (level == IvgSimdLevel_Scalar) {
+            reference.resize(num_vertices);
+            std::memcpy(reference.Data, ctx.vtx_buf_, num_vertices * sizeof(IvgV2));
+        }
+        else {
+            identical = num_vertices == (uint32_t)reference.Size &&
+                        std::memcmp(reference.Data, ctx.vtx_buf_, num_vertices * sizeof(IvgV2)) == 0;
+        }
+
+        double segments_per_second = (double)num_vertices * num_iterations / seconds;
+        std::printf("  %-8s %8.2f Msegments/s %s\n", simd_level_names[level], segments_per_second * 1e-6,
+                    identical ? "" : "(OUTPUT MISMATCH)");
+    }
+
+    // Same scene redrawn with the flattened path cache enabled
+    IvgContext ctx;
+    ctx.SetFramebufferSize(1024, 1024);
+    uint32_t num_vertices = 0;
+    auto start = BenchClock::now();
+    for (uint32_t i = 0; i < num_iterations; i++) {
+        ctx.Begin();
+        ctx.SetClipRect(IvgRect(0.0f, 0.0f, 1024.0f, 1024.0f));
+        ctx.SetPaint(&paint);
+        for (int j = 0; j < paths.Size; j++)
+            ctx.FillPath(*paths[j]);
+        ctx.End();
+        num_vertices = ctx.vtx_offset_;
+    }
+    double seconds = SecondsSince(start);
+    const IvgPathCacheStats& stats = ctx.GetPathCacheStats();
+    std::printf("  %-8s %8.2f Msegments/s (%llu hits, %llu misses, %zu bytes)\n", "Cached", (double)num_vertices * num_iterations / seconds * 1e-6,
+                (unsigned long long)stats.hits, (unsigned long long)stats.misses, stats.memory_used);
+
+    // Flattened edges against quadratic segments, both uncached. A quadratic segment costs the GPU about
+    // as much as four edges in the coverage pass.
+    static const char* curve_mode_names[] = { "Flatten", "Quadratic" };
+    for (uint32_t mode = IvgCurveMode_Flatten; mode <= IvgCurveMode_Quadratic; mode++) {
+        IvgContext curve_ctx;
+        curve_ctx.SetPathCacheBudget(0);
+        curve_ctx.SetBackendFeatures(IvgBackendFeatures_All);
+        curve_ctx.SetCurveMode((IvgCurveMode)mode);
+        curve_ctx.SetFramebufferSize(1024, 1024);
+        uint32_t num_primitives = 0;
+        start = BenchClock::now();
+        for (uint32_t i = 0; i < num_iterations; i++) {
+            curve_ctx.Begin();
+            curve_ctx.SetClipRect(IvgRect(0.0f, 0.0f, 1024.0f, 1024.0f));
+            curve_ctx.SetPaint(&paint);
+            for (int j = 0; j < paths.Size; j++)
+                curve_ctx.FillPath(*paths[j]);
+            curve_ctx.End();
+            num_primitives = 0;
+            IvgCmdBufPtr cmd_ptr{ curve_ctx.cmd_buf_ };
+            while (cmd_ptr.cmd_bytes != curve_ctx.cmd_buf_ + curve_ctx.cmd_offset_) {
+                const IvgBackendCommand* command = cmd_ptr.cmd_data;
+                if (command->header == IvgCommandHeader_SetClipRect) {
+                    cmd_ptr.cmd_bytes += sizeof(IvgSetClipRectCmd);
+                    continue;
+                }
+                if (command->header == IvgCommandHeader_SetDrawState) {
+                    cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+                    continue;
+                }
+                num_primitives += command->draw.vtx_count;
+                cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+            }
+        }
+        seconds = SecondsSince(start);
+        std::printf("  %-9s %8.2f Kpaths/s %7.1f primitives/path %7.1f vertices/path\n", curve_mode_names[mode],
+                    (double)paths.Size * num_iterations / seconds * 1e-3, (double)num_primitives / paths.Size,
+                    (double)curve_ctx.vtx_offset_ / paths.Size);
+    }
+
+    for (int i = 0; i < paths.Size; i++)
+        delete paths[i];
+}
+
+static void BenchTransform()
+{
+    const uint32_t num_points = 1000000;
+    const uint32_t num_iterations = 20;
+    static const char* class_names[] = { "Identity", "Translate", "ScaleTranslate", "Affine", "Projective" };
+    const IvgMat matrices[] = {
+        IvgMat(),
+        IvgMatTranslate(12.5f, -3.0f),
+        IvgMat(1.5f, 0.0f, 12.5f, 0.0f, 0.75f, -3.0f, 0.0f, 0.0f, 1.0f),
+        IvgMat(0.8f, -0.6f, 12.5f, 0.6f, 0.8f, -3.0f, 0.0f, 0.0f, 1.0f),
+        IvgMat(0.8f, -0.6f, 12.5f, 0.6f, 0.8f, -3.0f, 0.0001f, 0.0002f, 1.0f),
+    };
+
+    std::mt19937 rng(3456);
+    std::uniform_real_distribution<float> dist_pos(0.0f, 1000.0f);
+    IvgVector<IvgV2> points;
+    points.resize(num_points);
+    for (uint32_t i = 0; i < num_points; i++)
+        points[i] = IvgV2(dist_pos(rng), dist_pos(rng));
+
+    std::printf("Transform, %u points\n", num_points);
+
+    IvgVector<IvgV2> reference;
+    IvgVector<IvgV2> out;
+    reference.resize(num_points);
+    out.resize(num_points);
+    for (uint32_t type = IvgTransformClass_Translate; type < IvgTransformClass_Count; type++) {
+        IvgRect bounds(IvgV2(FLT_MAX, FLT_MAX), IvgV2(-FLT_MAX, -FLT_MAX));
+        IvgGetTransformKernel(IvgSimdLevel_Scalar)->transform[type](&matrices[type], points.Data, num_points, reference.Data, &bounds);
+
+        std::printf("  %s\n", class_names[type]);
+        for (uint32_t level = IvgSimdLevel_Scalar; level <= IvgSimdLevel_AVX2; level++) {
+            const IvgTransformKernel* kernel = IvgGetTransformKernel((IvgSimdLevel)level);
+            if (!kernel) {
+                std::printf("    %-8s not supported\n", simd_level_names[level]);
+                continue;
+            }
+
+            auto start = BenchClock::now();
+            for (uint32_t i = 0; i < num_iterations; i++)
+                kernel->transform[type](&matrices[type], points.Data, num_points, out.Data, &bounds);
+            double seconds = SecondsSince(start);
+
+            bool identical = std::memcmp(out.Data, reference.Data, num_points * sizeof(IvgV2)) == 0;
+            std::printf("    %-8s %8.2f Mpoints/s %s\n", simd_level_names[level], (double)num_points * num_iterations / seconds * 1e-6,
+                        identical ? "" : "(OUTPUT MISMATCH)");
+        }
+    }
+}
+
+static void BenchPathInstances()
+{
+    const uint32_t num_instances = 10000;
+    const uint32_t num_iterations = 20;
+    std::mt19937 rng(4321);
+    std::uniform_real_distribution<float> dist_pos(0.0f, 1000.0f);
+    std::uniform_real_distribution<float> dist_angle(0.0f, 6.28f);
+    std::uniform_real_distribution<float> dist_scale(0.5f, 2.0f);
+
+    // Marker made of four cubics around the origin
+    IvgPath marker;
+    marker.MoveTo(0.0f, -8.0f);
+    marker.CubicTo(6.0f, -8.0f, 8.0f, -4.0f, 8.0f, 0.0f);
+    marker.CubicTo(8.0f, 6.0f, 2.0f, 8.0f, 0.0f, 12.0f);
+    marker.CubicTo(-2.0f, 8.0f, -8.0f, 6.0f, -8.0f, 0.0f);
+    marker.CubicTo(-8.0f, -4.0f, -6.0f, -8.0f, 0.0f, -8.0f);
+    marker.Close();
+
+    // IvgPaint points into itself, construct the paints in place
+    std::vector<IvgMat> transforms(num_instances);
+    std::vector<IvgPaint> paints(num_instances);
+    for (uint32_t i = 0; i < num_instances; i++) {
+        float angle = dist_angle(rng);
+        float scale = dist_scale(rng);
+        transforms[i] = IvgMatTranslate(dist_pos(rng), dist_pos(rng)) *
+                        IvgMat(std::cos(angle) * scale, -std::sin(angle) * scale, 0.0f, std::sin(angle) * scale, std::cos(angle) * scale,
+                               0.0f, 0.0f, 0.0f, 1.0f);
+        paints[i].SetColor(0xFF000000u | (i * 2654435761u >> 8));
+    }
+
+    std::printf("Path instances, %u instances of 4 cubics\n", num_instances);
+
+    for (uint32_t instanced = 0; instanced < 2; instanced++) {
+        IvgContext ctx;
+        ctx.SetFramebufferSize(1024, 1024);
+        ctx.SetBackendFeatures(IvgBackendFeatures_All);
+        uint32_t num_vertices = 0;
+        uint32_t num_cmd_bytes = 0;
+        auto start = BenchClock::now();
+        for (uint32_t i = 0; i < num_iterations; i++) {
+            ctx.Begin();
+            ctx.SetClipRect(IvgRect(0.0f, 0.0f, 1024.0f, 1024.0f));
+            if (instanced) {
+                ctx.DrawPathInstances(marker, transforms.data(), paints.data(), num_instances);
+            }
+            else {
+                for (uint32_t j = 0; j < num_instances; j++) {
+                    ctx.SetTransformMatrix(transforms[j]);
+                    ctx.SetPaint(&paints[j]);
+                    ctx.FillPath(marker);
+                }
+                ctx.SetTransformMatrix(IvgMat());
+            }
+            ctx.End();
+            num_vertices = ctx.vtx_offset_;
+            num_cmd_bytes = ctx.cmd_offset_ + (uint32_t)(ctx.instances_.Size * sizeof(IvgPathInstance));
+        }
+        double seconds = SecondsSince(start);
+        std::printf("  %-10s %8.2f Minstances/s %8u vertices %8u command bytes\n", instanced ? "Instanced" : "FillPath",
+                    (double)num_instances * num_iterations / seconds * 1e-6, num_vertices, num_cmd_bytes);
+    }
+}
+
+static void BenchCulling()
+{
+    const uint32_t num_features = 100000;
+    const uint32_t num_iterations = 20;
+    std::mt19937 rng(2468);
+    std::uniform_real_distribution<float> dist_pos(0.0f, 3200.0f);
+    std::uniform_real_distribution<float> dist_size(4.0f, 24.0f);
+
+    // Map features spread over a world about ten times the area of the view, as in a zoomed in map
+    std::vector<IvgV2> points(num_features * 6);
+    for (uint32_t i = 0; i < num_features; i++) {
+        IvgV2 center(dist_pos(rng), dist_pos(rng));
+        for (uint32_t k = 0; k < 6; k++) {
+            float angle = (float)k * 1.047f;
+            points[i * 6 + k] = center + IvgV2(std::cos(angle), std::sin(angle)) * dist_size(rng);
+        }
+    }
+
+    std::printf("Culling, %u hexagons, 10%% inside the view\n", num_features);
+
+    IvgContext ctx;
+    ctx.SetFramebufferSize(1024, 1024);
+    IvgPaint paint;
+    paint.SetColor(0xFF336699u);
+    for (uint32_t damage = 0; damage < 2; damage++) {
+        // Without damage the whole view is redrawn, with it only the top left quarter
+        if (damage)
+            ctx.SetDamageRect(IvgRect(0.0f, 0.0f, 512.0f, 512.0f));
+        uint32_t num_vertices = 0;
+        uint32_t num_cmd_bytes = 0;
+        auto start = BenchClock::now();
+        for (uint32_t i = 0; i < num_iterations; i++) {
+            ctx.Begin();
+            ctx.SetClipRect(IvgRect(0.0f, 0.0f, 1024.0f, 1024.0f));
+            ctx.SetPaint(&paint);
+            for (uint32_t j = 0; j < num_features; j++)
+                ctx.FillPolygon(points.data() + j * 6, 6);
+            ctx.End();
+            num_vertices = ctx.vtx_offset_;
+            num_cmd_bytes = ctx.cmd_offset_;
+        }
+        double seconds = SecondsSince(start);
+        std::printf("  %-8s %8.2f Mfeatures/s %8u vertices %8u command bytes\n", damage ? "Damage" : "Polygon",
+                    (double)num_features * num_iterations / seconds * 1e-6, num_vertices, num_cmd_bytes);
+    }
+}
+
+static void BenchReorder()
+{
+    const uint32_t num_buttons = 10000;
+    const uint32_t num_iterations = 20;
+    std::mt19937 rng(1357);
+    std::uniform_real_distribution<float> dist_pos(0.0f, 1900.0f);
+
+    // Buttons with a fill and a border each, a few of them overlapping
+    std::vector<IvgV2> positions(num_buttons);
+    for (IvgV2& position : positions)
+        position = IvgV2(dist_pos(rng), dist_pos(rng));
+    IvgPaint fill(0xFF404040u);
+    IvgPaint border(0xFFC0C0C0u);
+
+    std::printf("Reorder, %u buttons with borders\n", num_buttons);
+
+    for (uint32_t reorder = 0; reorder < 2; reorder++) {
+        IvgContext ctx;
+        ctx.SetFramebufferSize(2048, 2048);
+        ctx.SetBackendFeatures(IvgBackendFeatures_All);
+        ctx.SetStrokeMode(IvgStrokeMode_Analytic);
+        ctx.SetDrawReordering(reorder != 0);
+        auto start = BenchClock::now();
+        for (uint32_t i = 0; i < num_iterations; i++) {
+            ctx.Begin();
+            ctx.SetClipRect(IvgRect(0.0f, 0.0f, 2048.0f, 2048.0f));
+            for (const IvgV2& position : positions) {
+                ctx.SetPaint(&fill);
+                ctx.FillRect(position, position + IvgV2(96.0f, 24.0f));
+                ctx.SetPaint(&border);
+                ctx.StrokeRect(position, position + IvgV2(96.0f, 24.0f));
+            }
+            ctx.End();
+        }
+        double seconds = SecondsSince(start);
+        const IvgReorderStats& stats = ctx.GetReorderStats();
+        std::printf("  %-8s %8.2f Mbuttons/s", reorder ? "Reorder" : "Recorded", (double)num_buttons * num_iterations / seconds * 1e-6);
+        if (reorder)
+            std::printf(" %8u batches before %8u after", stats.batches_before, stats.batches_after);
+        std::printf("\n");
+    }
+}
+
+static void BenchStrokePolyline()
+{
+    const uint32_t num_points = 1000000;
+    const uint32_t num_iterations = 10;
+    static const char* join_names[] = { "None", "Miter", "Round", "Bevel" };
+
+    // Random walk with smooth turns and occasional sharp corners, like a plotted signal
+    std::mt19937 rng(9012);
+    std::uniform_real_distribution<float> dist_turn(-0.3f, 0.3f);
+    std::uniform_real_distribution<float> dist_corner(0.0f, 1.0f);
+    IvgVector<IvgV2> points;
+    points.resize(num_points);
+    float x = 512.0f, y = 512.0f, angle = 0.0f;
+    for (uint32_t i = 0; i < num_points; i++) {
+        angle += dist_corner(rng) < 0.05f ? 2.5f : dist_turn(rng);
+        x = IvgClamp(x + std::cos(angle) * 2.0f, 0.0f, 1024.0f);
+        y = IvgClamp(y + std::sin(angle) * 2.0f, 0.0f, 1024.0f);
+        points[i] = IvgV2(x, y);
+    }
+
+    std::printf("StrokePolyline, %u points, width 3\n", num_points);
+
+    IvgPaint paint(255, 255, 255, 255);
+    for (uint32_t join = IvgStrokeJoin_None; join <= IvgStrokeJoin_Bevel; join++) {
+        IvgContext ctx;
+        ctx.SetFramebufferSize(1024, 1024);
+        ctx.SetStrokeWidth(3.0f);
+        ctx.SetStrokeJoin((IvgStrokeJoin)join);
+        ctx.SetStrokeCap(IvgStrokeCap_Round);
+        uint32_t num_vertices = 0;
+        auto start = BenchClock::now();
+        for (uint32_t i = 0; i < num_iterations; i++) {
+            ctx.Begin();
+            ctx.SetClipRect(IvgRect(0.0f, 0.0f, 1024.0f, 1024.0f));
+            ctx.SetPaint(&paint);
+            ctx.StrokePolyline(points.Data, num_points);
+            ctx.End();
+            num_vertices = ctx.vtx_offset_;
+        }
+        double seconds = SecondsSince(start);
+        std::printf("  %-8s %8.2f Mpoints/s %6.2f vertices/point\n", join_names[join],
+                    (double)num_points * num_iterations / seconds * 1e-6, (double)num_vertices / num_points);
+    }
+
+    // Analytic strokes only copy the points, joins and caps are resolved on the GPU
+    IvgContext ctx;
+    ctx.SetFramebufferSize(1024, 1024);
+    ctx.SetStrokeWidth(3.0f);
+    ctx.SetStrokeJoin(IvgStrokeJoin_Round);
+    ctx.SetStrokeCap(IvgStrokeCap_Round);
+    ctx.SetBackendFeatures(IvgBackendFeatures_All);
+    ctx.SetStrokeMode(IvgStrokeMode_Analytic);
+    uint32_t num_vertices = 0;
+    auto start = BenchClock::now();
+    for (uint32_t i = 0; i < num_iterations; i++) {
+        ctx.Begin();
+        ctx.SetClipRect(IvgRect(0.0f, 0.0f, 1024.0f, 1024.0f));
+        ctx.SetPaint(&paint);
+        ctx.StrokePolyline(points.Data, num_points);
+        ctx.End();
+        num_vertices = ctx.vtx_offset_;
+    }
+    double seconds = SecondsSince(start);
+    std::printf("  %-8s %8.2f Mpoints/s %6.2f vertices/point\n", "Analytic",
+                (double)num_points * num_iterations / seconds * 1e-6, (double)num_vertices / num_points);
+}
+
+// Only recording is timed, the GPU side cannot be measured here. The bench counts the commands marked convex and the
+// winding buffer entries of the draw regions of the recorded commands, split by whether they are convex.
+// CPU model of the per-pixel work of the two fill paths of the backends, sampled at pixel centers with the non-zero
+// rule. The two-pass path accumulates the winding of every edge into a region of row differences, then sums each row
+// to fill the covered pixels and clears the region. Returns the number of pixels filled.
+static uint32_t ModelTwoPassFill(const IvgDrawCmd& draw, const IvgV2* vtx, std::vector<int32_t>& winding,
+                                 std::vector<uint32_t>& fb, uint32_t fb_width, uint32_t color)
+{
+    int32_t x0 = (int32_t)draw.rect.min.x;
+    int32_t y0 = (int32_t)draw.rect.min.y;
+    uint32_t stride = draw.w + 1;
+    if (winding.size() < stride * draw.h)
+        winding.resize(stride * draw.h);
+    for (uint32_t i = 0; i < draw.vtx_count; i++) {
+        IvgV2 a = vtx[i];
+        IvgV2 b = vtx[i + 1];
+        if (a.y == b.y)
+            continue;
+        int32_t dir = a.y < b.y ? 1 : -1;
+        if (dir < 0)
+            std::swap(a, b);
+        float slope = (b.x - a.x) / (b.y - a.y);
+        int32_t row_begin = IvgMax((int32_t)std::ceil(a.y - 0.5f) - y0, 0);
+        int32_t row_end = IvgMin((int32_t)std::ceil(b.y - 0.5f) - y0, (int32_t)draw.h);
+        for (int32_t row = row_begin; row < row_end; row++) {
+            float x = a.x + ((float)(row + y0) + 0.5f - a.y) * slope;
+            int32_t px = IvgMin(IvgMax((int32_t)std::ceil(x - 0.5f) - x0, 0), (int32_t)draw.w);
+            winding[row * stride + px] += dir;
+        }
+    }
+
+    uint32_t covered = 0;
+    for (uint32_t row = 0; row < draw.h; row++) {
+        int32_t* diff = winding.data() + row * stride;
+        uint32_t* dst = fb.data() + (y0 + row) * fb_width + x0;
+        int32_t sum = 0;
+        for (uint32_t x = 0; x < draw.w; x++) {
+            sum += diff[x];
+            diff[x] = 0;
+            if (sum != 0) {
+                dst[x] = color;
+                covered++;
+            }
+        }
+        diff[draw.w] = 0;
+    }
+    return covered;
+}
+
+// The single-pass path tests every pixel of the region against the edges of the convex polygon
+static uint32_t ModelConvexFill(const IvgDrawCmd& draw, const IvgV2* vtx, std::vector<uint32_t>& fb, uint32_t fb_width,
+                                uint32_t color)
+{
+    int32_t x0 = (int32_t)draw.rect.min.x;
+    int32_t y0 = (int32_t)draw.rect.min.y;
+    float area = 0.0f;
+    for (uint32_t i = 0; i < draw.vtx_count; i++)
+        area += vtx[i].x * vtx[i + 1].y - vtx[i].y * vtx[i + 1].x;
+    float orientation = area < 0.0f ? -1.0f : 1.0f;
+
+    uint32_t covered = 0;
+    for (uint32_t row = 0; row < draw.h; row++) {
+        uint32_t* dst = fb.data() + (y0 + row) * fb_width + x0;
+        float py = (float)(y0 + row) + 0.5f;
+        for (uint32_t x = 0; x < draw.w; x++) {
+            float px = (float)(x0 + (int32_t)x) + 0.5f;
+            bool inside = true;
+            for (uint32_t i = 0; i < draw.vtx_count && inside; i++) {
+                IvgV2 edge = vtx[i + 1] - vtx[i];
+                inside = (edge.x * (py - vtx[i].y) - edge.y * (px - vtx[i].x)) * orientation >= 0.0f;
+            }
+            if (inside) {
+                dst[x] = color;
+                covered++;
+            }
+        }
+    }
+    return covered;
+}
+
+static void BenchTriangles()
+{
+    const uint32_t num_triangles = 100000;
+    const uint32_t num_iterations = 20;
+    const uint32_t num_fill_iterations = 5;
+    const uint32_t fb_size = 1024;
+    std::mt19937 rng(1357);
+    std::uniform_real_distribution<float> dist_pos(0.0f, (float)fb_size);
+    std::uniform_real_distribution<float> dist_offset(-16.0f, 16.0f);
+    std::vector<IvgV2> points(num_triangles * 3);
+    for (uint32_t i = 0; i < num_triangles; i++) {
+        IvgV2 p0(dist_pos(rng), dist_pos(rng));
+        points[i * 3] = p0;
+        points[i * 3 + 1] = p0 + IvgV2(dist_offset(rng), dist_offset(rng));
+        points[i * 3 + 2] = p0 + IvgV2(dist_offset(rng), dist_offset(rng));
+    }
+
+    std::printf("Triangles, %u triangles of up to 32x32 pixels\n", num_triangles);
+
+    IvgContext ctx;
+    ctx.SetFramebufferSize(fb_size, fb_size);
+    IvgPaint paint;
+    paint.SetColor(0xFF336699u);
+    auto start = BenchClock::now();
+    for (uint32_t i = 0; i < num_iterations; i++) {
+        ctx.Begin();
+        ctx.SetClipRect(IvgRect(0.0f, 0.0f, (float)fb_size, (float)fb_size));
+        ctx.SetPaint(&paint);
+        for (uint32_t j = 0; j < num_triangles; j++)
+            ctx.FillTriangle(points[j * 3], points[j * 3 + 1], points[j * 3 + 2]);
+        ctx.End();
+    }
+    double seconds = SecondsSince(start);
+
+    std::vector<const IvgDrawCmd*> draws;
+    uint32_t num_convex = 0;
+    IvgCmdBufPtr cmd_ptr{ ctx.cmd_buf_ };
+    while (cmd_ptr.cmd_bytes != ctx.cmd_buf_ + ctx.cmd_offset_) {
+        const IvgBackendCommand* command = cmd_ptr.cmd_data;
+        if (command->header == IvgCommandHeader_SetClipRect) {
+            cmd_ptr.cmd_bytes += sizeof(IvgSetClipRectCmd);
+            continue;
+        }
+        if (command->header == IvgCommandHeader_SetDrawState) {
+            cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+            continue;
+        }
+        draws.push_back(&command->draw);
+        num_convex += command->header == IvgCommandHeader_DrawConvex ? 1 : 0;
+        cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+    }
+    std::printf("  %-8s %8.2f Mtriangles/s %8u convex\n", "Record",
+                (double)num_triangles * num_iterations / seconds * 1e-6, num_convex);
+
+    // Fill the recorded frame with the CPU model, every draw in two passes, then convex draws in a single pass
+    std::vector<int32_t> winding;
+    std::vector<uint32_t> fb(fb_size * fb_size);
+    for (uint32_t single_pass = 0; single_pass < 2; single_pass++) {
+        uint64_t covered = 0;
+        start = BenchClock::now();
+        for (uint32_t i = 0; i < num_fill_iterations; i++) {
+            covered = 0;
+            for (const IvgDrawCmd* draw : draws) {
+                const IvgV2* vtx = ctx.vtx_buf_ + draw->vtx_offset;
+                if (single_pass && draw->header == IvgCommandHeader_DrawConvex)
+                    covered += ModelConvexFill(*draw, vtx, fb, fb_size, 0xFF336699u);
+                else
+                    covered += ModelTwoPassFill(*draw, vtx, winding, fb, fb_size, 0xFF336699u);
+            }
+        }
+        seconds = SecondsSince(start);
+        std::printf("  %-8s %8.2f Mtriangles/s %8.2f Mpixels filled (CPU model)\n", single_pass ? "Convex" : "TwoPass",
+                    (double)draws.size() * num_fill_iterations / seconds * 1e-6, (double)covered * 1e-6);
+    }
+}
+
+int main()
+{
+    std::printf("Supported SIMD level: %s\n\n", simd_level_names[IvgGetSupportedSimdLevel()]);
+    BenchKernels(IvgPathCmd_QuadTo, 20.0f);
+    BenchKernels(IvgPathCmd_QuadTo, 200.0f);
+    BenchKernels(IvgPathCmd_CubicTo, 20.0f);
+    BenchKernels(IvgPathCmd_CubicTo, 200.0f);
+    BenchFillPath();
+    BenchTransform();
+    BenchPathInstances();
+    BenchCulling();
+    BenchTriangles();
+    BenchReorder();
+    BenchStrokePolyline();
+    return 0;
+}
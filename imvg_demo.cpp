@@ -1,6 +1,8 @@
 #include "imvg.h"
 #include "imvg_vulkan.h"
 #include <iostream>
+#include <cstdio>
+#include <cstring>
 #include <random>
 
 #ifdef WIN32
@@ -17,6 +19,7 @@ static PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr;
 static PFN_vkGetDeviceProcAddr vkGetDeviceProcAddr;
 static PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices;
 static PFN_vkGetPhysicalDeviceFeatures vkGetPhysicalDeviceFeatures;
+static PFN_vkEnumerateDeviceExtensionProperties vkEnumerateDeviceExtensionProperties;
 static PFN_vkGetPhysicalDeviceQueueFamilyProperties vkGetPhysicalDeviceQueueFamilyProperties;
 static PFN_vkGetPhysicalDeviceSurfaceSupportKHR vkGetPhysicalDeviceSurfaceSupportKHR;
 static PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
@@ -79,6 +82,8 @@ static VkPhysicalDevice physical_device;
 static VkSurfaceKHR surface;
 static VkDevice device;
 static uint32_t graphics_queue_index = UINT32_MAX;
+static bool push_descriptor_supported;
+static const char* pipeline_cache_path = "imvg_pipeline_cache.bin";
 static VkQueue queue;
 static VkSwapchainKHR swapchain;
 static VkFormat swapchain_format;
@@ -146,11 +151,35 @@ int main()
     ivg_backend.num_frames_in_flight = num_swapchain_images;
     ivg_backend.min_allocation_size = 4096; // 4KiB is recommended
     ivg_backend.min_winding_buffer_size = 2048 * 1024 * 4; // 8MiB is recommended
+    ivg_backend.share_winding_buffer = false;
+    ivg_backend.compact_coverage = false;
+    ivg_backend.stage_vertices = false;
+    ivg_backend.push_descriptors = push_descriptor_supported;
+
+    // Pipelines compiled by a previous run
+    IvgVector<uint8_t> pipeline_cache_data;
+    if (FILE* file = fopen(pipeline_cache_path, "rb")) {
+        fseek(file, 0, SEEK_END);
+        pipeline_cache_data.resize((int)ftell(file));
+        fseek(file, 0, SEEK_SET);
+        if (fread(pipeline_cache_data.Data, 1, pipeline_cache_data.Size, file) != (size_t)pipeline_cache_data.Size)
+            pipeline_cache_data.resize(0);
+        fclose(file);
+    }
+    ivg_backend.pipeline_cache_data = pipeline_cache_data.Data;
+    ivg_backend.pipeline_cache_size = pipeline_cache_data.Size;
+    ivg_backend.async_pipelines = false;
+    ivg_backend.max_pipeline_sets = 0;
+    ivg_backend.render_pass_format = swapchain_format;
 
     if (!IvgBackendVulkan_Initialize(&ivg_backend, &backend))
         return DestroyAll(-1);
+    // Render passes of the same format share pipelines, a rebuilt one does not compile them again
+    IvgBackendVulkanTarget target{ render_pass, swapchain_format, VK_SAMPLE_COUNT_1_BIT, nullptr };
+    IvgBackendVulkan_PrewarmPipelines(backend, target);
 
     IvgContext ctx{};
+    ctx.SetBackendFeatures(IvgBackendVulkan_GetFeatures(backend));
     IvgPaint paint(0, 255, 255, 255);
     IvgPaint paint2(0, 0, 255, 255);
     IvgPaint paint3(0xFF277FFF);
@@ -250,7 +279,7 @@ int main()
             VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0, 0, NULL, 0, NULL, 1, &barrier);
 
         vkCmdBeginRenderPass(cmd_buf, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
-        IvgBackendVulkan_SubmitCommand(backend, cmd_buf, render_pass, { width, height }, &ctx);
+        IvgBackendVulkan_SubmitCommand(backend, cmd_buf, target, { width, height }, &ctx);
         vkCmdEndRenderPass(cmd_buf);
         vkEndCommandBuffer(cmd_buf);
 
@@ -337,6 +366,7 @@ bool InitializeVulkanInstance()
     vkGetDeviceProcAddr = (PFN_vkGetDeviceProcAddr)vkGetInstanceProcAddr(instance, "vkGetDeviceProcAddr");
     vkEnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices)vkGetInstanceProcAddr(instance, "vkEnumeratePhysicalDevices");
     vkGetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures");
+    vkEnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties)vkGetInstanceProcAddr(instance, "vkEnumerateDeviceExtensionProperties");
     vkGetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties");
     vkGetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceSupportKHR");
     vkGetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR)vkGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
@@ -404,7 +434,21 @@ bool InitializeDevice()
     if (graphics_queue_index == UINT32_MAX)
         return false;
 
-    static const char* swapchain_ext = VK_KHR_SWAPCHAIN_EXTENSION_NAME;
+    // VK_KHR_push_descriptor is optional, the backend falls back to descriptor sets without it
+    static const char* device_ext[2] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME };
+    uint32_t num_device_ext = 1;
+    uint32_t num_ext_properties = 0;
+    vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &num_ext_properties, nullptr);
+    IvgVector<VkExtensionProperties> ext_properties;
+    ext_properties.resize(num_ext_properties);
+    vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &num_ext_properties, ext_properties.Data);
+    for (const VkExtensionProperties& ext : ext_properties) {
+        if (strcmp(ext.extensionName, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME) == 0) {
+            num_device_ext = 2;
+            push_descriptor_supported = true;
+        }
+    }
+
     static const float queue_priorities = 1.0f;
     VkDeviceQueueCreateInfo graphics_queue_info{};
     graphics_queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
@@ -426,8 +470,8 @@ bool InitializeDevice()
     device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
     device_info.queueCreateInfoCount = 1;
     device_info.pQueueCreateInfos = &graphics_queue_info;
-    device_info.enabledExtensionCount = 1;
-    device_info.ppEnabledExtensionNames = &swapchain_ext;
+    device_info.enabledExtensionCount = num_device_ext;
+    device_info.ppEnabledExtensionNames = device_ext;
     device_info.pEnabledFeatures = &device_features;
 
     VkResult result = vkCreateDevice(physical_device, &device_info, nullptr, &device);
@@ -563,6 +607,7 @@ bool InitializeRenderPass()
     subpass_desc.colorAttachmentCount = 1;
     subpass_desc.pColorAttachments = &att_ref;
 
+    // Each frame in flight has its own winding buffer, without share_winding_buffer no external dependency is needed
     VkSubpassDependency subpass_dependency;
     subpass_dependency.srcSubpass = 0;
     subpass_dependency.dstSubpass = 0;
@@ -617,7 +662,16 @@ bool InitializeResource()
 int DestroyAll(int ret)
 {
     if (device) vkDeviceWaitIdle(device);
-    if (backend) IvgBackendVulkan_Shutdown(backend);
+    if (backend) {
+        IvgVector<uint8_t> pipeline_cache_data;
+        if (IvgBackendVulkan_GetPipelineCacheData(backend, &pipeline_cache_data)) {
+            if (FILE* file = fopen(pipeline_cache_path, "wb")) {
+                fwrite(pipeline_cache_data.Data, 1, pipeline_cache_data.Size, file);
+                fclose(file);
+            }
+        }
+        IvgBackendVulkan_Shutdown(backend);
+    }
 
     for (uint32_t i = 0; i < num_swapchain_images; i++) {
         FrameData& data = frame_data[i];
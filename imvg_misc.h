@@ -1,6 +1,7 @@
 #ifndef __IMVG_MISC_H__
 #define __IMVG_MISC_H__
 
+#include <cstddef>
 #include <cstdint>
 #include <cassert>
 #include <cstdlib>
@@ -0,0 +1,744 @@
+#include "imvg_simd.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define IVG_SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(IVG_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define IVG_TARGET_SSE2 __attribute__((target("sse2")))
+#define IVG_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define IVG_TARGET_SSE2
+#define IVG_TARGET_AVX2
+#endif
+
+// NOTE: The SIMD kernels must evaluate every expression in exactly the same order as the scalar kernel so the
+// results stay bit-identical. Do not enable FMA for this file, the compiler may contract multiply-add pairs.
+
+static inline IvgV2 IvgEvalQuad(const IvgCurveBatch* batch, uint32_t k, float t)
+{
+    float mt = 1.0f - t;
+    float a = mt * mt;
+    float b = 2.0f * mt * t;
+    float c = t * t;
+    return IvgV2(a * batch->x[0][k] + b * batch->x[1][k] + c * batch->x[2][k],
+                 a * batch->y[0][k] + b * batch->y[1][k] + c * batch->y[2][k]);
+}
+
+static inline IvgV2 IvgEvalCubic(const IvgCurveBatch* batch, uint32_t k, float t)
+{
+    float mt = 1.0f - t;
+    float a = mt * mt * mt;
+    float b = 3.0f * mt * mt * t;
+    float c = 3.0f * mt * t * t;
+    float d = t * t * t;
+    return IvgV2(a * batch->x[0][k] + b * batch->x[1][k] + c * batch->x[2][k] + d * batch->x[3][k],
+                 a * batch->y[0][k] + b * batch->y[1][k] + c * batch->y[2][k] + d * batch->y[3][k]);
+}
+
+static inline void IvgExpandBounds(IvgRect* bounds, float x, float y)
+{
+    if (x < bounds->min.x)
+        bounds->min.x = x;
+    if (y < bounds->min.y)
+        bounds->min.y = y;
+    if (x > bounds->max.x)
+        bounds->max.x = x;
+    if (y > bounds->max.y)
+        bounds->max.y = y;
+}
+
+// Merges the per-lane bounds of a vector loop. Lanes that never saw a point still hold the initial bounds, so the
+// minimums and maximums are merged separately rather than as points.
+static inline void IvgMergeBounds(IvgRect* bounds, float min_x, float min_y, float max_x, float max_y)
+{
+    if (min_x < bounds->min.x)
+        bounds->min.x = min_x;
+    if (min_y < bounds->min.y)
+        bounds->min.y = min_y;
+    if (max_x > bounds->max.x)
+        bounds->max.x = max_x;
+    if (max_y > bounds->max.y)
+        bounds->max.y = max_y;
+}
+
+//
+// Scalar kernel
+//
+
+static uint32_t QuadSegmentCount_Scalar(IvgCurveBatch* batch, float tolerance)
+{
+    // The distance between a quadratic bezier and its chord with parameter step h is bounded by |B''| * h^2 / 8
+    float tolerance_x4 = 4.0f * tolerance;
+    uint32_t total = 0;
+    for (uint32_t k = 0; k < batch->count; k++) {
+        float ddx = batch->x[0][k] - 2.0f * batch->x[1][k] + batch->x[2][k];
+        float ddy = batch->y[0][k] - 2.0f * batch->y[1][k] + batch->y[2][k];
+        float dd = std::sqrt(ddx * ddx + ddy * ddy);
+        uint32_t n = IvgCurveSegmentCount(std::sqrt(dd / tolerance_x4));
+        batch->num_segments[k] = n;
+        total += n;
+    }
+    return total;
+}
+
+static uint32_t CubicSegmentCount_Scalar(IvgCurveBatch* batch, float tolerance)
+{
+    // Same bound as above, |B''| <= 6 * max(|p0 - 2p1 + p2|, |p1 - 2p2 + p3|)
+    float tolerance_x4 = 4.0f * tolerance;
+    uint32_t total = 0;
+    for (uint32_t k = 0; k < batch->count; k++) {
+        float ddx0 = batch->x[0][k] - 2.0f * batch->x[1][k] + batch->x[2][k];
+        float ddy0 = batch->y[0][k] - 2.0f * batch->y[1][k] + batch->y[2][k];
+        float ddx1 = batch->x[1][k] - 2.0f * batch->x[2][k] + batch->x[3][k];
+        float ddy1 = batch->y[1][k] - 2.0f * batch->y[2][k] + batch->y[3][k];
+        float dd = std::sqrt(IvgMax(ddx0 * ddx0 + ddy0 * ddy0, ddx1 * ddx1 + ddy1 * ddy1));
+        uint32_t n = IvgCurveSegmentCount(std::sqrt(3.0f * dd / tolerance_x4));
+        batch->num_segments[k] = n;
+        total += n;
+    }
+    return total;
+}
+
+static IvgV2* EmitQuad_Scalar(const IvgCurveBatch* batch, IvgV2* out, IvgRect* bounds)
+{
+    for (uint32_t k = 0; k < batch->count; k++) {
+        uint32_t n = batch->num_segments[k];
+        float inv_n = 1.0f / (float)n;
+        for (uint32_t i = 1; i < n; i++) {
+            IvgV2 p = IvgEvalQuad(batch, k, (float)i * inv_n);
+            IvgExpandBounds(bounds, p.x, p.y);
+            *out++ = p;
+        }
+        IvgExpandBounds(bounds, batch->x[2][k], batch->y[2][k]);
+        *out++ = IvgV2(batch->x[2][k], batch->y[2][k]);
+    }
+    return out;
+}
+
+static IvgV2* EmitCubic_Scalar(const IvgCurveBatch* batch, IvgV2* out, IvgRect* bounds)
+{
+    for (uint32_t k = 0; k < batch->count; k++) {
+        uint32_t n = batch->num_segments[k];
+        float inv_n = 1.0f / (float)n;
+        for (uint32_t i = 1; i < n; i++) {
+            IvgV2 p = IvgEvalCubic(batch, k, (float)i * inv_n);
+            IvgExpandBounds(bounds, p.x, p.y);
+            *out++ = p;
+        }
+        IvgExpandBounds(bounds, batch->x[3][k], batch->y[3][k]);
+        *out++ = IvgV2(batch->x[3][k], batch->y[3][k]);
+    }
+    return out;
+}
+
+static const IvgFlattenKernel flatten_kernel_scalar = {
+    IvgSimdLevel_Scalar,
+    QuadSegmentCount_Scalar,
+    CubicSegmentCount_Scalar,
+    EmitQuad_Scalar,
+    EmitCubic_Scalar,
+};
+
+// The vector transform loops compute x' = (x * m0 + y * m1) + m2 and y' = (y * m4 + x * m3) + m5 by multiplying
+// the interleaved points with their pair-swapped copy, the scalar loop uses the same operand order.
+template <IvgTransformClass C>
+static void Transform_Scalar(const IvgMat* mat, const IvgV2* in, uint32_t count, IvgV2* out, IvgRect* bounds)
+{
+    const float* m = mat->m;
+    for (uint32_t i = 0; i < count; i++) {
+        float x = in[i].x;
+        float y = in[i].y;
+        IvgV2 p;
+        if constexpr (C == IvgTransformClass_Identity) {
+            p = IvgV2(x, y);
+        }
+        else if constexpr (C == IvgTransformClass_Translate) {
+            p = IvgV2(x + m[2], y + m[5]);
+        }
+        else if constexpr (C == IvgTransformClass_ScaleTranslate) {
+            p = IvgV2(x * m[0] + m[2], y * m[4] + m[5]);
+        }
+        else {
+            p = IvgV2(x * m[0] + y * m[1] + m[2], y * m[4] + x * m[3] + m[5]);
+            if constexpr (C == IvgTransformClass_Projective) {
+                float w = x * m[6] + y * m[7] + m[8];
+                p = IvgV2(p.x / w, p.y / w);
+            }
+        }
+        IvgExpandBounds(bounds, p.x, p.y);
+        out[i] = p;
+    }
+}
+
+static const IvgTransformKernel transform_kernel_scalar = {
+    IvgSimdLevel_Scalar,
+    {
+        Transform_Scalar<IvgTransformClass_Identity>,
+        Transform_Scalar<IvgTransformClass_Translate>,
+        Transform_Scalar<IvgTransformClass_ScaleTranslate>,
+        Transform_Scalar<IvgTransformClass_Affine>,
+        Transform_Scalar<IvgTransformClass_Projective>,
+    },
+};
+
+#ifdef IVG_SIMD_X86
+
+//
+// SSE2 kernel, segment counts are computed for 4 curves at once and points are emitted 4 at a time
+//
+
+IVG_TARGET_SSE2 static uint32_t QuadSegmentCount_SSE2(IvgCurveBatch* batch, float tolerance)
+{
+    __m128 tolerance_x4 = _mm_set1_ps(4.0f * tolerance);
+    __m128 two = _mm_set1_ps(2.0f);
+    float n[IVG_CURVE_BATCH_SIZE];
+    for (uint32_t k = 0; k < batch->count; k += 4) {
+        __m128 ddx = _mm_add_ps(_mm_sub_ps(_mm_loadu_ps(&batch->x[0][k]), _mm_mul_ps(two, _mm_loadu_ps(&batch->x[1][k]))),
+                                _mm_loadu_ps(&batch->x[2][k]));
+        __m128 ddy = _mm_add_ps(_mm_sub_ps(_mm_loadu_ps(&batch->y[0][k]), _mm_mul_ps(two, _mm_loadu_ps(&batch->y[1][k]))),
+                                _mm_loadu_ps(&batch->y[2][k]));
+        __m128 dd = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(ddx, ddx), _mm_mul_ps(ddy, ddy)));
+        _mm_storeu_ps(&n[k], _mm_sqrt_ps(_mm_div_ps(dd, tolerance_x4)));
+    }
+    uint32_t total = 0;
+    for (uint32_t k = 0; k < batch->count; k++) {
+        batch->num_segments[k] = IvgCurveSegmentCount(n[k]);
+        total += batch->num_segments[k];
+    }
+    return total;
+}
+
+IVG_TARGET_SSE2 static uint32_t CubicSegmentCount_SSE2(IvgCurveBatch* batch, float tolerance)
+{
+    __m128 tolerance_x4 = _mm_set1_ps(4.0f * tolerance);
+    __m128 two = _mm_set1_ps(2.0f);
+    __m128 three = _mm_set1_ps(3.0f);
+    float n[IVG_CURVE_BATCH_SIZE];
+    for (uint32_t k = 0; k < batch->count; k += 4) {
+        __m128 x0 = _mm_loadu_ps(&batch->x[0][k]);
+        __m128 x1 = _mm_loadu_ps(&batch->x[1][k]);
+        __m128 x2 = _mm_loadu_ps(&batch->x[2][k]);
+        __m128 x3 = _mm_loadu_ps(&batch->x[3][k]);
+        __m128 y0 = _mm_loadu_ps(&batch->y[0][k]);
+        __m128 y1 = _mm_loadu_ps(&batch->y[1][k]);
+        __m128 y2 = _mm_loadu_ps(&batch->y[2][k]);
+        __m128 y3 = _mm_loadu_ps(&batch->y[3][k]);
+        __m128 ddx0 = _mm_add_ps(_mm_sub_ps(x0, _mm_mul_ps(two, x1)), x2);
+        __m128 ddy0 = _mm_add_ps(_mm_sub_ps(y0, _mm_mul_ps(two, y1)), y2);
+        __m128 ddx1 = _mm_add_ps(_mm_sub_ps(x1, _mm_mul_ps(two, x2)), x3);
+        __m128 ddy1 = _mm_add_ps(_mm_sub_ps(y1, _mm_mul_ps(two, y2)), y3);
+        __m128 dd0 = _mm_add_ps(_mm_mul_ps(ddx0, ddx0), _mm_mul_ps(ddy0, ddy0));
+        __m128 dd1 = _mm_add_ps(_mm_mul_ps(ddx1, ddx1), _mm_mul_ps(ddy1, ddy1));
+        __m128 dd = _mm_sqrt_ps(_mm_max_ps(dd0, dd1));
+        _mm_storeu_ps(&n[k], _mm_sqrt_ps(_mm_div_ps(_mm_mul_ps(three, dd), tolerance_x4)));
+    }
+    uint32_t total = 0;
+    for (uint32_t k = 0; k < batch->count; k++) {
+        batch->num_segments[k] = IvgCurveSegmentCount(n[k]);
+        total += batch->num_segments[k];
+    }
+    return total;
+}
+
+IVG_TARGET_SSE2 static inline void StoreInterleaved_SSE2(IvgV2* out, __m128 x, __m128 y)
+{
+    _mm_storeu_ps((float*)out, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps((float*)(out + 2), _mm_unpackhi_ps(x, y));
+}
+
+IVG_TARGET_SSE2 static inline void StoreBounds_SSE2(IvgRect* bounds, __m128 min_x, __m128 min_y, __m128 max_x, __m128 max_y)
+{
+    float tmp[4][4];
+    _mm_storeu_ps(tmp[0], min_x);
+    _mm_storeu_ps(tmp[1], min_y);
+    _mm_storeu_ps(tmp[2], max_x);
+    _mm_storeu_ps(tmp[3], max_y);
+    for (uint32_t i = 0; i < 4; i++)
+        IvgMergeBounds(bounds, tmp[0][i], tmp[1][i], tmp[2][i], tmp[3][i]);
+}
+
+IVG_TARGET_SSE2 static IvgV2* EmitQuad_SSE2(const IvgCurveBatch* batch, IvgV2* out, IvgRect* bounds)
+{
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 two = _mm_set1_ps(2.0f);
+    __m128i lane = _mm_set_epi32(3, 2, 1, 0);
+    __m128 min_x = _mm_set1_ps(bounds->min.x);
+    __m128 min_y = _mm_set1_ps(bounds->min.y);
+    __m128 max_x = _mm_set1_ps(bounds->max.x);
+    __m128 max_y = _mm_set1_ps(bounds->max.y);
+
+    for (uint32_t k = 0; k < batch->count; k++) {
+        uint32_t n = batch->num_segments[k];
+        float inv_n_scalar = 1.0f / (float)n;
+        __m128 inv_n = _mm_set1_ps(inv_n_scalar);
+        __m128 x0 = _mm_set1_ps(batch->x[0][k]);
+        __m128 x1 = _mm_set1_ps(batch->x[1][k]);
+        __m128 x2 = _mm_set1_ps(batch->x[2][k]);
+        __m128 y0 = _mm_set1_ps(batch->y[0][k]);
+        __m128 y1 = _mm_set1_ps(batch->y[1][k]);
+        __m128 y2 = _mm_set1_ps(batch->y[2][k]);
+        uint32_t i = 1;
+        for (; i + 4 <= n; i += 4) {
+            __m128 t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32((int)i), lane)), inv_n);
+            __m128 mt = _mm_sub_ps(one, t);
+            __m128 a = _mm_mul_ps(mt, mt);
+            __m128 b = _mm_mul_ps(_mm_mul_ps(two, mt), t);
+            __m128 c = _mm_mul_ps(t, t);
+            __m128 x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, x0), _mm_mul_ps(b, x1)), _mm_mul_ps(c, x2));
+            __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, y0), _mm_mul_ps(b, y1)), _mm_mul_ps(c, y2));
+            min_x = _mm_min_ps(min_x, x);
+            min_y = _mm_min_ps(min_y, y);
+            max_x = _mm_max_ps(max_x, x);
+            max_y = _mm_max_ps(max_y, y);
+            StoreInterleaved_SSE2(out, x, y);
+            out += 4;
+        }
+        for (; i < n; i++) {
+            IvgV2 p = IvgEvalQuad(batch, k, (float)i * inv_n_scalar);
+            IvgExpandBounds(bounds, p.x, p.y);
+            *out++ = p;
+        }
+        IvgExpandBounds(bounds, batch->x[2][k], batch->y[2][k]);
+        *out++ = IvgV2(batch->x[2][k], batch->y[2][k]);
+    }
+
+    StoreBounds_SSE2(bounds, min_x, min_y, max_x, max_y);
+    return out;
+}
+
+IVG_TARGET_SSE2 static IvgV2* EmitCubic_SSE2(const IvgCurveBatch* batch, IvgV2* out, IvgRect* bounds)
+{
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 three = _mm_set1_ps(3.0f);
+    __m128i lane = _mm_set_epi32(3, 2, 1, 0);
+    __m128 min_x = _mm_set1_ps(bounds->min.x);
+    __m128 min_y = _mm_set1_ps(bounds->min.y);
+    __m128 max_x = _mm_set1_ps(bounds->max.x);
+    __m128 max_y = _mm_set1_ps(bounds->max.y);
+
+    for (uint32_t k = 0; k < batch->count; k++) {
+        uint32_t n = batch->num_segments[k];
+        float inv_n_scalar = 1.0f / (float)n;
+        __m128 inv_n = _mm_set1_ps(inv_n_scalar);
+        __m128 x0 = _mm_set1_ps(batch->x[0][k]);
+        __m128 x1 = _mm_set1_ps(batch->x[1][k]);
+        __m128 x2 = _mm_set1_ps(batch->x[2][k]);
+        __m128 x3 = _mm_set1_ps(batch->x[3][k]);
+        __m128 y0 = _mm_set1_ps(batch->y[0][k]);
+        __m128 y1 = _mm_set1_ps(batch->y[1][k]);
+        __m128 y2 = _mm_set1_ps(batch->y[2][k]);
+        __m128 y3 = _mm_set1_ps(batch->y[3][k]);
+        uint32_t i = 1;
+        for (; i + 4 <= n; i += 4) {
+            __m128 t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32((int)i), lane)), inv_n);
+            __m128 mt = _mm_sub_ps(one, t);
+            __m128 a = _mm_mul_ps(_mm_mul_ps(mt, mt), mt);
+            __m128 b = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(three, mt), mt), t);
+            __m128 c = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(three, mt), t), t);
+            __m128 d = _mm_mul_ps(_mm_mul_ps(t, t), t);
+            __m128 x = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a, x0), _mm_mul_ps(b, x1)), _mm_mul_ps(c, x2)), _mm_mul_ps(d, x3));
+            __m128 y = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(a, y0), _mm_mul_ps(b, y1)), _mm_mul_ps(c, y2)), _mm_mul_ps(d, y3));
+            min_x = _mm_min_ps(min_x, x);
+            min_y = _mm_min_ps(min_y, y);
+            max_x = _mm_max_ps(max_x, x);
+            max_y = _mm_max_ps(max_y, y);
+            StoreInterleaved_SSE2(out, x, y);
+            out += 4;
+        }
+        for (; i < n; i++) {
+            IvgV2 p = IvgEvalCubic(batch, k, (float)i * inv_n_scalar);
+            IvgExpandBounds(bounds, p.x, p.y);
+            *out++ = p;
+        }
+        IvgExpandBounds(bounds, batch->x[3][k], batch->y[3][k]);
+        *out++ = IvgV2(batch->x[3][k], batch->y[3][k]);
+    }
+
+    StoreBounds_SSE2(bounds, min_x, min_y, max_x, max_y);
+    return out;
+}
+
+static const IvgFlattenKernel flatten_kernel_sse2 = {
+    IvgSimdLevel_SSE2,
+    QuadSegmentCount_SSE2,
+    CubicSegmentCount_SSE2,
+    EmitQuad_SSE2,
+    EmitCubic_SSE2,
+};
+
+// Two interleaved points per register
+template <IvgTransformClass C>
+IVG_TARGET_SSE2 static void Transform_SSE2(const IvgMat* mat, const IvgV2* in, uint32_t count, IvgV2* out, IvgRect* bounds)
+{
+    const float* m = mat->m;
+    __m128 diag = _mm_setr_ps(m[0], m[4], m[0], m[4]);
+    __m128 cross = _mm_setr_ps(m[1], m[3], m[1], m[3]);
+    __m128 translation = _mm_setr_ps(m[2], m[5], m[2], m[5]);
+    __m128 persp = _mm_setr_ps(m[6], m[7], m[6], m[7]);
+    __m128 persp_w = _mm_set1_ps(m[8]);
+    __m128 min_xy = _mm_setr_ps(bounds->min.x, bounds->min.y, bounds->min.x, bounds->min.y);
+    __m128 max_xy = _mm_setr_ps(bounds->max.x, bounds->max.y, bounds->max.x, bounds->max.y);
+
+    uint32_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128 v = _mm_loadu_ps((const float*)(in + i));
+        __m128 p;
+        if constexpr (C == IvgTransformClass_Translate) {
+            p = _mm_add_ps(v, translation);
+        }
+        else if constexpr (C == IvgTransformClass_ScaleTranslate) {
+            p = _mm_add_ps(_mm_mul_ps(v, diag), translation);
+        }
+        else {
+            __m128 swapped = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+            p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(v, diag), _mm_mul_ps(swapped, cross)), translation);
+            if constexpr (C == IvgTransformClass_Projective) {
+                __m128 w = _mm_mul_ps(v, persp);
+                w = _mm_add_ps(_mm_add_ps(w, _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 3, 0, 1))), persp_w);
+                p = _mm_div_ps(p, w);
+            }
+        }
+        min_xy = _mm_min_ps(min_xy, p);
+        max_xy = _mm_max_ps(max_xy, p);
+        _mm_storeu_ps((float*)(out + i), p);
+    }
+
+    float tmp[2][4];
+    _mm_storeu_ps(tmp[0], min_xy);
+    _mm_storeu_ps(tmp[1], max_xy);
+    for (uint32_t k = 0; k < 4; k += 2)
+        IvgMergeBounds(bounds, tmp[0][k], tmp[0][k + 1], tmp[1][k], tmp[1][k + 1]);
+    Transform_Scalar<C>(mat, in + i, count - i, out + i, bounds);
+}
+
+static const IvgTransformKernel transform_kernel_sse2 = {
+    IvgSimdLevel_SSE2,
+    {
+        Transform_Scalar<IvgTransformClass_Identity>,
+        Transform_SSE2<IvgTransformClass_Translate>,
+        Transform_SSE2<IvgTransformClass_ScaleTranslate>,
+        Transform_SSE2<IvgTransformClass_Affine>,
+        Transform_SSE2<IvgTransformClass_Projective>,
+    },
+};
+
+//
+// AVX2 kernel, same as SSE2 but 8 lanes wide
+//
+
+IVG_TARGET_AVX2 static uint32_t QuadSegmentCount_AVX2(IvgCurveBatch* batch, float tolerance)
+{
+    __m256 tolerance_x4 = _mm256_set1_ps(4.0f * tolerance);
+    __m256 two = _mm256_set1_ps(2.0f);
+    float n[IVG_CURVE_BATCH_SIZE];
+    __m256 ddx = _mm256_add_ps(_mm256_sub_ps(_mm256_loadu_ps(batch->x[0]), _mm256_mul_ps(two, _mm256_loadu_ps(batch->x[1]))),
+                               _mm256_loadu_ps(batch->x[2]));
+    __m256 ddy = _mm256_add_ps(_mm256_sub_ps(_mm256_loadu_ps(batch->y[0]), _mm256_mul_ps(two, _mm256_loadu_ps(batch->y[1]))),
+                               _mm256_loadu_ps(batch->y[2]));
+    __m256 dd = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(ddx, ddx), _mm256_mul_ps(ddy, ddy)));
+    _mm256_storeu_ps(n, _mm256_sqrt_ps(_mm256_div_ps(dd, tolerance_x4)));
+    uint32_t total = 0;
+    for (uint32_t k = 0; k < batch->count; k++) {
+        batch->num_segments[k] = IvgCurveSegmentCount(n[k]);
+        total += batch->num_segments[k];
+    }
+    return total;
+}
+
+IVG_TARGET_AVX2 static uint32_t CubicSegmentCount_AVX2(IvgCurveBatch* batch, float tolerance)
+{
+    __m256 tolerance_x4 = _mm256_set1_ps(4.0f * tolerance);
+    __m256 two = _mm256_set1_ps(2.0f);
+    __m256 three = _mm256_set1_ps(3.0f);
+    float n[IVG_CURVE_BATCH_SIZE];
+    __m256 x0 = _mm256_loadu_ps(batch->x[0]);
+    __m256 x1 = _mm256_loadu_ps(batch->x[1]);
+    __m256 x2 = _mm256_loadu_ps(batch->x[2]);
+    __m256 x3 = _mm256_loadu_ps(batch->x[3]);
+    __m256 y0 = _mm256_loadu_ps(batch->y[0]);
+    __m256 y1 = _mm256_loadu_ps(batch->y[1]);
+    __m256 y2 = _mm256_loadu_ps(batch->y[2]);
+    __m256 y3 = _mm256_loadu_ps(batch->y[3]);
+    __m256 ddx0 = _mm256_add_ps(_mm256_sub_ps(x0, _mm256_mul_ps(two, x1)), x2);
+    __m256 ddy0 = _mm256_add_ps(_mm256_sub_ps(y0, _mm256_mul_ps(two, y1)), y2);
+    __m256 ddx1 = _mm256_add_ps(_mm256_sub_ps(x1, _mm256_mul_ps(two, x2)), x3);
+    __m256 ddy1 = _mm256_add_ps(_mm256_sub_ps(y1, _mm256_mul_ps(two, y2)), y3);
+    __m256 dd0 = _mm256_add_ps(_mm256_mul_ps(ddx0, ddx0), _mm256_mul_ps(ddy0, ddy0));
+    __m256 dd1 = _mm256_add_ps(_mm256_mul_ps(ddx1, ddx1), _mm256_mul_ps(ddy1, ddy1));
+    __m256 dd = _mm256_sqrt_ps(_mm256_max_ps(dd0, dd1));
+    _mm256_storeu_ps(n, _mm256_sqrt_ps(_mm256_div_ps(_mm256_mul_ps(three, dd), tolerance_x4)));
+    uint32_t total = 0;
+    for (uint32_t k = 0; k < batch->count; k++) {
+        batch->num_segments[k] = IvgCurveSegmentCount(n[k]);
+        total += batch->num_segments[k];
+    }
+    return total;
+}
+
+IVG_TARGET_AVX2 static inline void StoreInterleaved_AVX2(IvgV2* out, __m256 x, __m256 y)
+{
+    // unpack works within 128-bit lanes: lo = (p0, p1 | p4, p5), hi = (p2, p3 | p6, p7)
+    __m256 lo = _mm256_unpacklo_ps(x, y);
+    __m256 hi = _mm256_unpackhi_ps(x, y);
+    _mm256_storeu_ps((float*)out, _mm256_permute2f128_ps(lo, hi, 0x20));
+    _mm256_storeu_ps((float*)(out + 4), _mm256_permute2f128_ps(lo, hi, 0x31));
+}
+
+IVG_TARGET_AVX2 static inline void StoreBounds_AVX2(IvgRect* bounds, __m256 min_x, __m256 min_y, __m256 max_x, __m256 max_y)
+{
+    float tmp[4][8];
+    _mm256_storeu_ps(tmp[0], min_x);
+    _mm256_storeu_ps(tmp[1], min_y);
+    _mm256_storeu_ps(tmp[2], max_x);
+    _mm256_storeu_ps(tmp[3], max_y);
+    for (uint32_t i = 0; i < 8; i++)
+        IvgMergeBounds(bounds, tmp[0][i], tmp[1][i], tmp[2][i], tmp[3][i]);
+}
+
+IVG_TARGET_AVX2 static IvgV2* EmitQuad_AVX2(const IvgCurveBatch* batch, IvgV2* out, IvgRect* bounds)
+{
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256 two = _mm256_set1_ps(2.0f);
+    __m256i lane = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    __m256 min_x = _mm256_set1_ps(bounds->min.x);
+    __m256 min_y = _mm256_set1_ps(bounds->min.y);
+    __m256 max_x = _mm256_set1_ps(bounds->max.x);
+    __m256 max_y = _mm256_set1_ps(bounds->max.y);
+
+    for (uint32_t k = 0; k < batch->count; k++) {
+        uint32_t n = batch->num_segments[k];
+        float inv_n_scalar = 1.0f / (float)n;
+        __m256 inv_n = _mm256_set1_ps(inv_n_scalar);
+        __m256 x0 = _mm256_set1_ps(batch->x[0][k]);
+        __m256 x1 = _mm256_set1_ps(batch->x[1][k]);
+        __m256 x2 = _mm256_set1_ps(batch->x[2][k]);
+        __m256 y0 = _mm256_set1_ps(batch->y[0][k]);
+        __m256 y1 = _mm256_set1_ps(batch->y[1][k]);
+        __m256 y2 = _mm256_set1_ps(batch->y[2][k]);
+        uint32_t i = 1;
+        for (; i + 8 <= n; i += 8) {
+            __m256 t = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32((int)i), lane)), inv_n);
+            __m256 mt = _mm256_sub_ps(one, t);
+            __m256 a = _mm256_mul_ps(mt, mt);
+            __m256 b = _mm256_mul_ps(_mm256_mul_ps(two, mt), t);
+            __m256 c = _mm256_mul_ps(t, t);
+            __m256 x = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, x0), _mm256_mul_ps(b, x1)), _mm256_mul_ps(c, x2));
+            __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, y0), _mm256_mul_ps(b, y1)), _mm256_mul_ps(c, y2));
+            min_x = _mm256_min_ps(min_x, x);
+            min_y = _mm256_min_ps(min_y, y);
+            max_x = _mm256_max_ps(max_x, x);
+            max_y = _mm256_max_ps(max_y, y);
+            StoreInterleaved_AVX2(out, x, y);
+            out += 8;
+        }
+        for (; i < n; i++) {
+            IvgV2 p = IvgEvalQuad(batch, k, (float)i * inv_n_scalar);
+            IvgExpandBounds(bounds, p.x, p.y);
+            *out++ = p;
+        }
+        IvgExpandBounds(bounds, batch->x[2][k], batch->y[2][k]);
+        *out++ = IvgV2(batch->x[2][k], batch->y[2][k]);
+    }
+
+    StoreBounds_AVX2(bounds, min_x, min_y, max_x, max_y);
+    return out;
+}
+
+IVG_TARGET_AVX2 static IvgV2* EmitCubic_AVX2(const IvgCurveBatch* batch, IvgV2* out, IvgRect* bounds)
+{
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256 three = _mm256_set1_ps(3.0f);
+    __m256i lane = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+    __m256 min_x = _mm256_set1_ps(bounds->min.x);
+    __m256 min_y = _mm256_set1_ps(bounds->min.y);
+    __m256 max_x = _mm256_set1_ps(bounds->max.x);
+    __m256 max_y = _mm256_set1_ps(bounds->max.y);
+
+    for (uint32_t k = 0; k < batch->count; k++) {
+        uint32_t n = batch->num_segments[k];
+        float inv_n_scalar = 1.0f / (float)n;
+        __m256 inv_n = _mm256_set1_ps(inv_n_scalar);
+        __m256 x0 = _mm256_set1_ps(batch->x[0][k]);
+        __m256 x1 = _mm256_set1_ps(batch->x[1][k]);
+        __m256 x2 = _mm256_set1_ps(batch->x[2][k]);
+        __m256 x3 = _mm256_set1_ps(batch->x[3][k]);
+        __m256 y0 = _mm256_set1_ps(batch->y[0][k]);
+        __m256 y1 = _mm256_set1_ps(batch->y[1][k]);
+        __m256 y2 = _mm256_set1_ps(batch->y[2][k]);
+        __m256 y3 = _mm256_set1_ps(batch->y[3][k]);
+        uint32_t i = 1;
+        for (; i + 8 <= n; i += 8) {
+            __m256 t = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32((int)i), lane)), inv_n);
+            __m256 mt = _mm256_sub_ps(one, t);
+            __m256 a = _mm256_mul_ps(_mm256_mul_ps(mt, mt), mt);
+            __m256 b = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(three, mt), mt), t);
+            __m256 c = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(three, mt), t), t);
+            __m256 d = _mm256_mul_ps(_mm256_mul_ps(t, t), t);
+            __m256 x = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, x0), _mm256_mul_ps(b, x1)), _mm256_mul_ps(c, x2)), _mm256_mul_ps(d, x3));
+            __m256 y = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, y0), _mm256_mul_ps(b, y1)), _mm256_mul_ps(c, y2)), _mm256_mul_ps(d, y3));
+            min_x = _mm256_min_ps(min_x, x);
+            min_y = _mm256_min_ps(min_y, y);
+            max_x = _mm256_max_ps(max_x, x);
+            max_y = _mm256_max_ps(max_y, y);
+            StoreInterleaved_AVX2(out, x, y);
+            out += 8;
+        }
+        for (; i < n; i++) {
+            IvgV2 p = IvgEvalCubic(batch, k, (float)i * inv_n_scalar);
+            IvgExpandBounds(bounds, p.x, p.y);
+            *out++ = p;
+        }
+        IvgExpandBounds(bounds, batch->x[3][k], batch->y[3][k]);
+        *out++ = IvgV2(batch->x[3][k], batch->y[3][k]);
+    }
+
+    StoreBounds_AVX2(bounds, min_x, min_y, max_x, max_y);
+    return out;
+}
+
+static const IvgFlattenKernel flatten_kernel_avx2 = {
+    IvgSimdLevel_AVX2,
+    QuadSegmentCount_AVX2,
+    CubicSegmentCount_AVX2,
+    EmitQuad_AVX2,
+    EmitCubic_AVX2,
+};
+
+// Four interleaved points per register
+template <IvgTransformClass C>
+IVG_TARGET_AVX2 static void Transform_AVX2(const IvgMat* mat, const IvgV2* in, uint32_t count, IvgV2* out, IvgRect* bounds)
+{
+    const float* m = mat->m;
+    __m256 diag = _mm256_setr_ps(m[0], m[4], m[0], m[4], m[0], m[4], m[0], m[4]);
+    __m256 cross = _mm256_setr_ps(m[1], m[3], m[1], m[3], m[1], m[3], m[1], m[3]);
+    __m256 translation = _mm256_setr_ps(m[2], m[5], m[2], m[5], m[2], m[5], m[2], m[5]);
+    __m256 persp = _mm256_setr_ps(m[6], m[7], m[6], m[7], m[6], m[7], m[6], m[7]);
+    __m256 persp_w = _mm256_set1_ps(m[8]);
+    __m256 min_xy = _mm256_setr_ps(bounds->min.x, bounds->min.y, bounds->min.x, bounds->min.y,
+                                   bounds->min.x, bounds->min.y, bounds->min.x, bounds->min.y);
+    __m256 max_xy = _mm256_setr_ps(bounds->max.x, bounds->max.y, bounds->max.x, bounds->max.y,
+                                   bounds->max.x, bounds->max.y, bounds->max.x, bounds->max.y);
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256 v = _mm256_loadu_ps((const float*)(in + i));
+        __m256 p;
+        if constexpr (C == IvgTransformClass_Translate) {
+            p = _mm256_add_ps(v, translation);
+        }
+        else if constexpr (C == IvgTransformClass_ScaleTranslate) {
+            p = _mm256_add_ps(_mm256_mul_ps(v, diag), translation);
+        }
+        else {
+            __m256 swapped = _mm256_permute_ps(v, _MM_SHUFFLE(2, 3, 0, 1));
+            p = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(v, diag), _mm256_mul_ps(swapped, cross)), translation);
+            if constexpr (C == IvgTransformClass_Projective) {
+                __m256 w = _mm256_mul_ps(v, persp);
+                w = _mm256_add_ps(_mm256_add_ps(w, _mm256_permute_ps(w, _MM_SHUFFLE(2, 3, 0, 1))), persp_w);
+                p = _mm256_div_ps(p, w);
+            }
+        }
+        min_xy = _mm256_min_ps(min_xy, p);
+        max_xy = _mm256_max_ps(max_xy, p);
+        _mm256_storeu_ps((float*)(out + i), p);
+    }
+
+    float tmp[2][8];
+    _mm256_storeu_ps(tmp[0], min_xy);
+    _mm256_storeu_ps(tmp[1], max_xy);
+    for (uint32_t k = 0; k < 8; k += 2)
+        IvgMergeBounds(bounds, tmp[0][k], tmp[0][k + 1], tmp[1][k], tmp[1][k + 1]);
+    Transform_Scalar<C>(mat, in + i, count - i, out + i, bounds);
+}
+
+static const IvgTransformKernel transform_kernel_avx2 = {
+    IvgSimdLevel_AVX2,
+    {
+        Transform_Scalar<IvgTransformClass_Identity>,
+        Transform_AVX2<IvgTransformClass_Translate>,
+        Transform_AVX2<IvgTransformClass_ScaleTranslate>,
+        Transform_AVX2<IvgTransformClass_Affine>,
+        Transform_AVX2<IvgTransformClass_Projective>,
+    },
+};
+
+static IvgSimdLevel DetectSimdLevel()
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    int max_leaf = info[0];
+    __cpuid(info, 1);
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    bool avx2 = false;
+    if (osxsave && avx && max_leaf >= 7 && (_xgetbv(0) & 6) == 6) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    bool sse2 = __builtin_cpu_supports("sse2");
+    bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+    if (avx2)
+        return IvgSimdLevel_AVX2;
+    if (sse2)
+        return IvgSimdLevel_SSE2;
+    return IvgSimdLevel_Scalar;
+}
+
+#else
+
+static IvgSimdLevel DetectSimdLevel()
+{
+    return IvgSimdLevel_Scalar;
+}
+
+#endif // IVG_SIMD_X86
+
+IvgSimdLevel IvgGetSupportedSimdLevel()
+{
+    static const IvgSimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+const IvgFlattenKernel* IvgGetFlattenKernel(IvgSimdLevel level)
+{
+    if (level > IvgGetSupportedSimdLevel())
+        return nullptr;
+    switch (level) {
+#ifdef IVG_SIMD_X86
+        case IvgSimdLevel_AVX2:
+            return &flatten_kernel_avx2;
+        case IvgSimdLevel_SSE2:
+            return &flatten_kernel_sse2;
+#endif
+        default:
+            break;
+    }
+    return &flatten_kernel_scalar;
+}
+
+const IvgTransformKernel* IvgGetTransformKernel(IvgSimdLevel level)
+{
+    if (level > IvgGetSupportedSimdLevel())
+        return nullptr;
+    switch (level) {
+#ifdef IVG_SIMD_X86
+        case IvgSimdLevel_AVX2:
+            return &transform_kernel_avx2;
+        case IvgSimdLevel_SSE2:
+            return &transform_kernel_sse2;
+#endif
+        default:
+            break;
+    }
+    return &transform_kernel_scalar;
+}
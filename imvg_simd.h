@@ -0,0 +1,56 @@
+#ifndef __IMVG_SIMD_H__
+#define __IMVG_SIMD_H__
+
+#include "imvg.h"
+#include <cmath>
+
+#define IVG_CURVE_BATCH_SIZE 8
+#define IVG_MAX_CURVE_SEGMENTS 4096
+
+static inline uint32_t IvgCurveSegmentCount(float n)
+{
+    // Also catches NaN coming from degenerated input
+    if (!(n >= 1.0f))
+        return 1;
+    if (n >= (float)IVG_MAX_CURVE_SEGMENTS)
+        return IVG_MAX_CURVE_SEGMENTS;
+    return (uint32_t)std::ceil(n);
+}
+
+// Control points of up to IVG_CURVE_BATCH_SIZE curves in structure-of-arrays layout. Quadratic curves only use
+// the first three points. num_segments is filled by the segment count functions.
+struct IvgCurveBatch
+{
+    float x[4][IVG_CURVE_BATCH_SIZE];
+    float y[4][IVG_CURVE_BATCH_SIZE];
+    uint32_t num_segments[IVG_CURVE_BATCH_SIZE];
+    uint32_t count;
+};
+
+// Every kernel produces bit-identical output. The emit functions write all points of each curve except the first
+// one, in batch order, expand bounds with the written points and return the end of the written range.
+struct IvgFlattenKernel
+{
+    IvgSimdLevel level;
+    uint32_t (*quad_segment_count)(IvgCurveBatch* batch, float tolerance);
+    uint32_t (*cubic_segment_count)(IvgCurveBatch* batch, float tolerance);
+    IvgV2* (*emit_quad)(const IvgCurveBatch* batch, IvgV2* out, IvgRect* bounds);
+    IvgV2* (*emit_cubic)(const IvgCurveBatch* batch, IvgV2* out, IvgRect* bounds);
+};
+
+// Transforms count points from in to out, which may be the same buffer, and expands bounds with the transformed
+// points. There is one function per transform class, each one only reads the matrix elements its class can change.
+typedef void (*IvgTransformFn)(const IvgMat* mat, const IvgV2* in, uint32_t count, IvgV2* out, IvgRect* bounds);
+
+// Every kernel produces bit-identical output
+struct IvgTransformKernel
+{
+    IvgSimdLevel level;
+    IvgTransformFn transform[IvgTransformClass_Count];
+};
+
+IvgSimdLevel IvgGetSupportedSimdLevel();
+const IvgFlattenKernel* IvgGetFlattenKernel(IvgSimdLevel level);
+const IvgTransformKernel* IvgGetTransformKernel(IvgSimdLevel level);
+
+#endif // __IMVG_SIMD_H__
@@ -3,8 +3,13 @@
 #endif
 
 #include "imvg_vulkan.h"
+#include <cmath>
+#include <condition_variable>
 #include <deque>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 #ifdef WIN32
 #ifndef WIN32_LEAN_AND_MEAN
@@ -31,6 +36,92 @@ extern uint32_t __spirv_vulkan_polygon_fs_size;
 extern const uint32_t* __spirv_vulkan_polygon_vs_shader;
 extern const uint32_t* __spirv_vulkan_polygon_fs_shader;
 
+extern uint32_t __spirv_vulkan_polygon_backdrop_vs_size;
+extern uint32_t __spirv_vulkan_polygon_backdrop_fs_size;
+extern const uint32_t* __spirv_vulkan_polygon_backdrop_vs_shader;
+extern const uint32_t* __spirv_vulkan_polygon_backdrop_fs_shader;
+
+extern uint32_t __spirv_vulkan_polygon_curve_vs_size;
+extern uint32_t __spirv_vulkan_polygon_curve_fs_size;
+extern const uint32_t* __spirv_vulkan_polygon_curve_vs_shader;
+extern const uint32_t* __spirv_vulkan_polygon_curve_fs_shader;
+
+extern uint32_t __spirv_vulkan_resolve_vs_size;
+extern uint32_t __spirv_vulkan_resolve_fs_size;
+extern const uint32_t* __spirv_vulkan_resolve_vs_shader;
+extern const uint32_t* __spirv_vulkan_resolve_fs_shader;
+
+extern uint32_t __spirv_vulkan_polygon_batch_vs_size;
+extern uint32_t __spirv_vulkan_polygon_batch_fs_size;
+extern uint32_t __spirv_vulkan_polygon_curve_batch_vs_size;
+extern uint32_t __spirv_vulkan_polygon_curve_batch_fs_size;
+extern uint32_t __spirv_vulkan_resolve_batch_vs_size;
+extern uint32_t __spirv_vulkan_resolve_batch_fs_size;
+extern uint32_t __spirv_vulkan_fill_batch_vs_size;
+extern uint32_t __spirv_vulkan_fill_batch_fs_size;
+extern const uint32_t* __spirv_vulkan_polygon_batch_vs_shader;
+extern const uint32_t* __spirv_vulkan_polygon_batch_fs_shader;
+extern const uint32_t* __spirv_vulkan_polygon_curve_batch_vs_shader;
+extern const uint32_t* __spirv_vulkan_polygon_curve_batch_fs_shader;
+extern const uint32_t* __spirv_vulkan_resolve_batch_vs_shader;
+extern const uint32_t* __spirv_vulkan_resolve_batch_fs_shader;
+extern const uint32_t* __spirv_vulkan_fill_batch_vs_shader;
+extern const uint32_t* __spirv_vulkan_fill_batch_fs_shader;
+
+extern uint32_t __spirv_vulkan_stroke_vs_size;
+extern uint32_t __spirv_vulkan_stroke_fs_size;
+extern const uint32_t* __spirv_vulkan_stroke_vs_shader;
+extern const uint32_t* __spirv_vulkan_stroke_fs_shader;
+
+extern uint32_t __spirv_vulkan_rect_vs_size;
+extern uint32_t __spirv_vulkan_rect_fs_size;
+extern const uint32_t* __spirv_vulkan_rect_vs_shader;
+extern const uint32_t* __spirv_vulkan_rect_fs_shader;
+extern uint32_t __spirv_vulkan_convex_vs_size;
+extern uint32_t __spirv_vulkan_convex_fs_size;
+extern const uint32_t* __spirv_vulkan_convex_vs_shader;
+extern const uint32_t* __spirv_vulkan_convex_fs_shader;
+
+extern uint32_t __spirv_vulkan_instance_polygon_vs_size;
+extern uint32_t __spirv_vulkan_instance_polygon_fs_size;
+extern uint32_t __spirv_vulkan_instance_fill_vs_size;
+extern uint32_t __spirv_vulkan_instance_fill_fs_size;
+extern const uint32_t* __spirv_vulkan_instance_polygon_vs_shader;
+extern const uint32_t* __spirv_vulkan_instance_polygon_fs_shader;
+extern const uint32_t* __spirv_vulkan_instance_fill_vs_shader;
+extern const uint32_t* __spirv_vulkan_instance_fill_fs_shader;
+
+extern uint32_t __spirv_vulkan_path_count_cs_size;
+extern uint32_t __spirv_vulkan_path_alloc_cs_size;
+extern uint32_t __spirv_vulkan_path_scatter_cs_size;
+extern uint32_t __spirv_vulkan_backdrop_cs_size;
+extern uint32_t __spirv_vulkan_bin_cs_size;
+extern uint32_t __spirv_vulkan_coarse_cs_size;
+extern uint32_t __spirv_vulkan_fine_cs_size;
+extern uint32_t __spirv_vulkan_composite_vs_size;
+extern uint32_t __spirv_vulkan_composite_fs_size;
+extern const uint32_t* __spirv_vulkan_path_count_cs_shader;
+extern const uint32_t* __spirv_vulkan_path_alloc_cs_shader;
+extern const uint32_t* __spirv_vulkan_path_scatter_cs_shader;
+extern const uint32_t* __spirv_vulkan_backdrop_cs_shader;
+extern const uint32_t* __spirv_vulkan_bin_cs_shader;
+extern const uint32_t* __spirv_vulkan_coarse_cs_shader;
+extern const uint32_t* __spirv_vulkan_fine_cs_shader;
+extern const uint32_t* __spirv_vulkan_composite_vs_shader;
+extern const uint32_t* __spirv_vulkan_composite_fs_shader;
+
+// Must match shader/vk_compute.glsli
+#define COMPUTE_TILE_SIZE 16
+#define COMPUTE_BIN_TILES 16
+#define COMPUTE_WORKGROUP_SIZE 256
+#define COMPUTE_PATH_TILE_SIZE 80
+
+// Must match shader/vk_winding.glsli. A segment adds at most 2 * 256 to a coverage entry, draws with up to 63 segments
+// stay within 16 bits.
+#define WINDING_FORMAT_32 0
+#define WINDING_FORMAT_16 1
+#define COMPACT_COVERAGE_MAX_SEGMENTS 63
+
 struct IvgBackendVulkanBuffer
 {
     VkDeviceMemory allocation;
@@ -39,12 +130,15 @@ struct IvgBackendVulkanBuffer
     void* mapped_ptr;
     uint32_t count;
     uint32_t offset;
+    VkMemoryPropertyFlags memory_flags;
 };
 
 struct IvgBackendVulkanImage
 {
     VkDeviceMemory allocation;
     VkImage image;
+    VkImageView view;
+    VkExtent2D extent;
 };
 
 struct IvgBackendVulkanDispose
@@ -53,6 +147,7 @@ struct IvgBackendVulkanDispose
     {
         Buffer,
         Image,
+        Pipeline,
     };
 
     uint64_t frame_stamp;
@@ -62,6 +157,7 @@ struct IvgBackendVulkanDispose
     {
         IvgBackendVulkanBuffer buffer;
         IvgBackendVulkanImage image;
+        VkPipeline pipeline;
     };
 };
 
@@ -76,18 +172,140 @@ struct IvgBackendVulkanDrawArgs
     uint32_t fill_mode;
     uint32_t paint_type;
     uint32_t color;
+    IvgV2 translation;
+    float stroke_width;
+    float miter_limit;
+    uint32_t stroke_style;
+    uint32_t vtx_count;
+    uint32_t winding_format;
+};
+
+// Parameters of a draw of a batch, read by the batch shaders by draw index. See BatchDraw in shader/vk_common.glsli.
+struct IvgBackendVulkanBatchDraw
+{
+    IvgV2 min_bb;
+    IvgV2 max_bb;
+    IvgV2 translation;
+    uint32_t vtx_offset;
+    uint32_t line_base;
+    uint32_t curve_base;
+    uint32_t winding_stride;
+    uint32_t winding_offset;
+    uint32_t color;
+    uint32_t winding_format;
+    uint32_t vtx_count; // edges of convex draws
+};
+
+// Pushed instead of IvgBackendVulkanDrawArgs by the batch shaders
+struct IvgBackendVulkanBatchArgs
+{
+    IvgV2 inv_viewport;
+    uint32_t batch_first;
+    uint32_t batch_count;
+};
+
+// Draw record of the compute rasterizer, see shader/vk_compute.glsli
+struct IvgBackendVulkanComputeDraw
+{
+    int32_t clip[4];
+    uint32_t tile_rect[4];
+    uint32_t path_tile_offset;
+    uint32_t segment_base;
+    uint32_t vtx_offset;
+    uint32_t color;
+    uint32_t fill_mode;
+    uint32_t column_base;
+    uint32_t pad[2];
+};
+
+struct IvgBackendVulkanComputeArgs
+{
+    uint32_t num_draws;
+    uint32_t num_segments;
+    uint32_t num_path_tiles;
+    uint32_t num_columns;
+    uint32_t fb_size[2];
+    uint32_t tiles[2];
+    uint32_t bins[2];
+    uint32_t segment_capacity;
+    uint32_t dispatch_width;
+};
+
+struct IvgBackendVulkanComputePipeline
+{
+    VkPipeline path_count;
+    VkPipeline path_alloc;
+    VkPipeline path_scatter;
+    VkPipeline backdrop;
+    VkPipeline bin;
+    VkPipeline coarse;
+    VkPipeline fine;
 };
 
 struct IvgBackendVulkanPipeline
 {
     VkPipeline polygon;
+    VkPipeline polygon_backdrop;
+    VkPipeline polygon_curve;
+    VkPipeline resolve;
     VkPipeline fill;
+    VkPipeline stroke;
+    VkPipeline instance_polygon;
+    VkPipeline instance_fill;
+    VkPipeline rect;
+    VkPipeline rect_opaque;
+    VkPipeline convex;
+    bool batched;
+    uint64_t frame_stamp; // Last frame the pipelines were used in, the least recently used are evicted first
+};
+
+struct IvgBackendVulkanCompositePipeline
+{
+    VkPipeline pipeline;
+    uint64_t frame_stamp;
 };
 
+// Targets with the same key share pipelines. Render passes without a declared format are keyed by their handle.
+struct IvgBackendVulkanPipelineKey
+{
+    VkRenderPass render_pass;
+    VkFormat color_format;
+    VkSampleCountFlagBits samples;
+    bool dynamic;
+
+    bool operator==(const IvgBackendVulkanPipelineKey& other) const
+    {
+        return render_pass == other.render_pass && color_format == other.color_format && samples == other.samples && dynamic == other.dynamic;
+    }
+};
+
+struct IvgBackendVulkanPipelineKeyHash
+{
+    size_t operator()(const IvgBackendVulkanPipelineKey& key) const
+    {
+        size_t hash = std::hash<VkRenderPass>()(key.render_pass);
+        hash = hash * 31 + (size_t)key.color_format;
+        hash = hash * 31 + (size_t)key.samples;
+        return hash * 2 + (key.dynamic ? 1 : 0);
+    }
+};
+
+template <typename T>
+using IvgBackendVulkanPipelineMap = std::unordered_map<IvgBackendVulkanPipelineKey, T, IvgBackendVulkanPipelineKeyHash>;
+
+// Vertices of a context uploaded ahead of its submit
+struct IvgBackendVulkanUpload
+{
+    const IvgContext* ctx;
+    VkBuffer vtx_buffer;
+    uint32_t vtx_base;
+};
+
+// Descriptor pools of a frame, another one is added when they run out of sets
 struct IvgBackendVulkanDescriptorStream
 {
-    VkDescriptorPool pool;
-    VkDescriptorSet current_descriptor_set;
+    IvgVector<VkDescriptorPool> pools;
+    int current_pool;
 };
 
 struct IvgBackendVulkan
@@ -99,28 +317,123 @@ struct IvgBackendVulkan
     VkRenderPass compatible_render_pass;
     VkDescriptorSetLayout descriptor_set_layout;
     VkPipelineLayout pipeline_layout;
+    VkDescriptorSetLayout compute_descriptor_set_layout;
+    VkPipelineLayout compute_pipeline_layout;
+    IvgBackendVulkanComputePipeline compute_pipeline{};
     uint64_t frame_count = 0;
     uint32_t frame_id = 0;
     VkDeviceSize min_allocation_size;
     VkDeviceSize min_winding_buffer_size;
+    bool compact_coverage;
+    bool share_winding_buffer;
+    bool push_descriptors; // Graphics descriptors are pushed, the pools only serve the compute rasterizer
     VkDeviceSize buffer_alignment = 256;
     VkDeviceSize area_covered = 0;
-    uint32_t winding_offset = 0;
+    uint32_t winding_offset = 0; // Carried over frames when they share the winding buffer
+    IvgBackendVulkanStats stats{};
     IvgBackendVulkanDescriptorStream descriptor_stream[MAX_FRAMES_IN_FLIGHT]{};
     IvgBackendVulkanBuffer vtx_buffer[MAX_FRAMES_IN_FLIGHT]{};
+    // Only used within a render pass and left cleared by the fill pass. With share_winding_buffer the first one serves
+    // all frames in flight, submissions are then ordered by the external subpass dependency render passes must declare,
+    // see imvg_vulkan.h.
     IvgBackendVulkanBuffer winding_buffer[MAX_FRAMES_IN_FLIGHT]{};
-    std::unordered_map<VkRenderPass, IvgBackendVulkanPipeline> pipeline_cache;
+    IvgBackendVulkanBuffer instance_buffer[MAX_FRAMES_IN_FLIGHT]{};
+    IvgBackendVulkanBuffer batch_buffer[MAX_FRAMES_IN_FLIGHT]{};
+    // Most elements written to the upload buffers of the same kind in one frame
+    uint32_t vtx_high_water = 0;
+    uint32_t instance_high_water = 0;
+    uint32_t batch_high_water = 0;
+    VkDeviceSize non_coherent_atom_size = 1;
+    // Vertices of the contexts uploaded with IvgBackendVulkan_UploadContext this frame
+    bool stage_vertices;
+    IvgBackendVulkanBuffer staged_vtx_buffer[MAX_FRAMES_IN_FLIGHT]{};
+    IvgVector<IvgBackendVulkanUpload> uploads;
+    IvgVector<IvgBackendVulkanBatchDraw> batch_draws;
+    IvgBackendVulkanBuffer compute_draw_buffer[MAX_FRAMES_IN_FLIGHT]{};
+    IvgBackendVulkanBuffer compute_scratch_buffer[MAX_FRAMES_IN_FLIGHT]{};
+    IvgBackendVulkanImage compute_image[MAX_FRAMES_IN_FLIGHT]{};
+    VkDescriptorSet compute_descriptor_set[MAX_FRAMES_IN_FLIGHT]{};
+    uint64_t compute_frame_stamp = ~0ull;
+    IvgContext* compute_fallback_ctx = nullptr; // Submitted by IvgBackendVulkan_CompositeCompute instead
+    IvgVector<IvgBackendVulkanComputeDraw> compute_draws;
+    VkPipelineCache vk_pipeline_cache = VK_NULL_HANDLE; // Backs every pipeline creation, see IvgBackendVulkan_GetPipelineCacheData
+    uint32_t max_pipeline_sets;
+    VkFormat render_pass_format;
+    bool dynamic_rendering_local_read;
+    // Copy of the dynamic rendering info of the current submit that loads its attachments, see CoverageBarrier
+    VkRenderingInfo resume_rendering;
+    IvgVector<VkRenderingAttachmentInfo> resume_attachments;
+    IvgBackendVulkanPipelineMap<IvgBackendVulkanPipeline> pipeline_cache;
+    // Pipelines compiled on compile_thread with async_pipelines. Everything below compile_mutex is guarded by it,
+    // compile_pending holds the keys queued, in compilation or compiled but not moved to pipeline_cache yet.
+    bool async_pipelines;
+    uint64_t pipeline_timeout_ns = UINT64_MAX;
+    std::thread compile_thread;
+    std::mutex compile_mutex;
+    std::condition_variable compile_request_cv;
+    std::condition_variable compile_done_cv;
+    std::deque<IvgBackendVulkanTarget> compile_requests;
+    std::unordered_set<IvgBackendVulkanPipelineKey, IvgBackendVulkanPipelineKeyHash> compile_pending;
+    IvgBackendVulkanPipelineMap<IvgBackendVulkanPipeline> compiled_pipelines;
+    bool compile_exit = false;
+    IvgBackendVulkanPipelineMap<IvgBackendVulkanCompositePipeline> composite_pipeline_cache;
+    std::unordered_map<uint64_t, IvgBackendVulkanBuffer> draw_list_buffers;
     std::deque<IvgBackendVulkanDispose> resource_disposal_queue;
 };
 
+// A command stream being recorded into a Vulkan command buffer. Replayed draw lists carry their own vertex buffer.
+struct IvgBackendVulkanStream
+{
+    VkBuffer vtx_buffer;
+    uint32_t vtx_base;
+    IvgByte* cmd_begin;
+    IvgByte* cmd_end;
+    const IvgDrawListCmd* replay;
+    IvgV2 translation; // of the replayed draw list, applied by the shaders
+};
+
+struct IvgBackendVulkanSubmitState
+{
+    VkCommandBuffer cmd_buf;
+    VkPipeline polygon;
+    VkPipeline polygon_backdrop;
+    VkPipeline polygon_curve;
+    VkPipeline resolve;
+    VkPipeline fill;
+    VkPipeline stroke;
+    VkPipeline instance_polygon;
+    VkPipeline instance_fill;
+    VkPipeline rect;         // with blending, and without for runs of opaque pixel aligned rects
+    VkPipeline rect_opaque;
+    VkPipeline convex;
+    VkBuffer instance_buffer;
+    uint32_t instance_base;
+    bool batched;
+    const VkRenderingInfo* resume_rendering; // with dynamic rendering scopes split around the barriers
+    VkBuffer bound_vtx_buffer;
+    VkBuffer bound_winding_buffer;
+    VkBuffer bound_batch_buffer;
+    uint32_t winding_base;   // where every batch starts allocating regions, the fill pass leaves them cleared
+    uint32_t winding_offset;
+    uint32_t winding_end;    // end of the regions used by this submit
+    VkRect2D scissor;        // of the current clip rect
+    VkRect2D fb_scissor;
+    IvgBackendVulkanDrawArgs draw_args;
+};
+
 static uint32_t GetMemoryType(IvgBackendVulkanFn& fn, VkPhysicalDevice physical_device, VkMemoryPropertyFlags properties,
-                              uint32_t type_bits)
+                              uint32_t type_bits, VkMemoryPropertyFlags* type_properties = nullptr, VkMemoryPropertyFlags excluded_properties = 0)
 {
     VkPhysicalDeviceMemoryProperties prop;
     fn.vkGetPhysicalDeviceMemoryProperties(physical_device, &prop);
-    for (uint32_t i = 0; i < prop.memoryTypeCount; i++)
-        if ((prop.memoryTypes[i].propertyFlags & properties) == properties && type_bits & (1 << i))
+    for (uint32_t i = 0; i < prop.memoryTypeCount; i++) {
+        if ((prop.memoryTypes[i].propertyFlags & properties) == properties && !(prop.memoryTypes[i].propertyFlags & excluded_properties) &&
+            type_bits & (1 << i)) {
+            if (type_properties)
+                *type_properties = prop.memoryTypes[i].propertyFlags;
             return i;
+        }
+    }
     return 0xFFFFFFFF; // Unable to find memoryType
 }
 
@@ -129,18 +442,21 @@ static inline VkDeviceSize AlignBufferSize(VkDeviceSize size, VkDeviceSize align
     return (size + alignment - 1) & ~(alignment - 1);
 }
 
-static void CreateOrResizeBuffer(IvgBackendVulkan* backend, IvgBackendVulkanBuffer& buffer, VkDeviceSize new_size, VkBufferUsageFlags usage, VkMemoryPropertyFlags mem_props)
+static void DisposeBuffer(IvgBackendVulkan* backend, const IvgBackendVulkanBuffer& buffer)
 {
-    IvgBackendVulkanFn& fn = backend->fn;
-    if (buffer.buffer != VK_NULL_HANDLE && buffer.allocation != VK_NULL_HANDLE) {
-        IvgBackendVulkanDispose& disposal = backend->resource_disposal_queue.emplace_back();
-        disposal.frame_stamp = backend->frame_count;
-        disposal.type = IvgBackendVulkanDispose::Buffer;
-        disposal.buffer = buffer;
-    }
+    IvgBackendVulkanDispose& disposal = backend->resource_disposal_queue.emplace_back();
+    disposal.frame_stamp = backend->frame_count;
+    disposal.type = IvgBackendVulkanDispose::Buffer;
+    disposal.buffer = buffer;
+}
 
-    // Prefer aligned buffer size
-    VkDeviceSize buffer_size_aligned = AlignBufferSize(IvgMax(backend->min_allocation_size, new_size), backend->buffer_alignment);
+// Memory types with preferred_mem_props in addition to mem_props are tried first. When their heap is out of memory,
+// host visible buffers fall back to coherent system memory.
+static void CreateBuffer(IvgBackendVulkan* backend, IvgBackendVulkanBuffer& buffer, VkDeviceSize size, VkBufferUsageFlags usage,
+                         VkMemoryPropertyFlags mem_props, VkMemoryPropertyFlags preferred_mem_props)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    VkDeviceSize buffer_size_aligned = AlignBufferSize(size, backend->buffer_alignment);
     VkBufferCreateInfo buffer_info = {};
     buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     buffer_info.size = buffer_size_aligned;
@@ -153,15 +469,91 @@ static void CreateOrResizeBuffer(IvgBackendVulkan* backend, IvgBackendVulkanBuff
     fn.vkGetBufferMemoryRequirements(backend->device, buffer.buffer, &req);
     backend->buffer_alignment = (backend->buffer_alignment > req.alignment) ? backend->buffer_alignment : req.alignment;
 
+    uint32_t memory_type = 0xFFFFFFFF;
+    if (preferred_mem_props != 0)
+        memory_type = GetMemoryType(backend->fn, backend->physical_device, mem_props | preferred_mem_props, req.memoryTypeBits,
+                                    &buffer.memory_flags);
+    if (memory_type == 0xFFFFFFFF)
+        memory_type = GetMemoryType(backend->fn, backend->physical_device, mem_props, req.memoryTypeBits, &buffer.memory_flags);
+
     VkMemoryAllocateInfo alloc_info = {};
     alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     alloc_info.allocationSize = req.size;
-    alloc_info.memoryTypeIndex = GetMemoryType(backend->fn, backend->physical_device, mem_props, req.memoryTypeBits);
-    IVG_VK_CHECK(fn.vkAllocateMemory(backend->device, &alloc_info, nullptr, &buffer.allocation));
+    alloc_info.memoryTypeIndex = memory_type;
+    result = fn.vkAllocateMemory(backend->device, &alloc_info, nullptr, &buffer.allocation);
+    if (result == VK_ERROR_OUT_OF_DEVICE_MEMORY && (buffer.memory_flags & preferred_mem_props) != 0 &&
+        (mem_props & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)) {
+        // The mappable part of device local memory is often a small window, the rest of the frame still fits in
+        // system memory
+        memory_type = GetMemoryType(backend->fn, backend->physical_device, mem_props | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                    req.memoryTypeBits, &buffer.memory_flags, preferred_mem_props);
+        if (memory_type != 0xFFFFFFFF) {
+            alloc_info.memoryTypeIndex = memory_type;
+            result = fn.vkAllocateMemory(backend->device, &alloc_info, nullptr, &buffer.allocation);
+        }
+    }
+    IVG_VK_CHECK(result);
     IVG_VK_CHECK(fn.vkBindBufferMemory(backend->device, buffer.buffer, buffer.allocation, 0));
     buffer.size = buffer_size_aligned;
 }
 
+static void CreateOrResizeBuffer(IvgBackendVulkan* backend, IvgBackendVulkanBuffer& buffer, VkDeviceSize new_size, VkBufferUsageFlags usage, VkMemoryPropertyFlags mem_props)
+{
+    if (buffer.buffer != VK_NULL_HANDLE && buffer.allocation != VK_NULL_HANDLE)
+        DisposeBuffer(backend, buffer);
+
+    // Prefer aligned buffer size
+    CreateBuffer(backend, buffer, IvgMax(backend->min_allocation_size, new_size), usage, mem_props, 0);
+}
+
+// Makes room for count elements in a persistently mapped upload buffer of the frame. Buffers grow geometrically and to
+// the high-water mark of the previous frames, so the buffers of every frame in flight settle at the same size. Device
+// local memory is preferred, so writes go straight to the GPU on devices that can map it, and system memory is used
+// once it runs out.
+static void ReserveUploadBuffer(IvgBackendVulkan* backend, IvgBackendVulkanBuffer& buffer, uint32_t count, uint32_t element_size,
+                                VkBufferUsageFlags usage, uint32_t& high_water)
+{
+    high_water = IvgMax(high_water, count);
+    if (buffer.buffer != VK_NULL_HANDLE && count <= buffer.count)
+        return;
+
+    uint32_t new_count = IvgMax(IvgMax(count, high_water), buffer.count * 2);
+    if (buffer.buffer != VK_NULL_HANDLE && buffer.allocation != VK_NULL_HANDLE)
+        DisposeBuffer(backend, buffer);
+    CreateBuffer(backend, buffer, IvgMax(backend->min_allocation_size, (VkDeviceSize)new_count * element_size), usage,
+                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    IVG_VK_CHECK(backend->fn.vkMapMemory(backend->device, buffer.allocation, 0, VK_WHOLE_SIZE, 0, &buffer.mapped_ptr));
+    buffer.count = (uint32_t)(buffer.size / element_size);
+}
+
+// Flushes the bytes written to a mapped buffer, widened to whole non-coherent atoms. Coherent memory needs no flush.
+static void FlushBufferRange(IvgBackendVulkan* backend, const IvgBackendVulkanBuffer& buffer, VkDeviceSize offset, VkDeviceSize size)
+{
+    backend->stats.upload_bytes += size;
+    if (size == 0 || (buffer.memory_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT))
+        return;
+
+    VkDeviceSize atom = backend->non_coherent_atom_size;
+    VkDeviceSize begin = offset / atom * atom;
+    VkDeviceSize end = (offset + size + atom - 1) / atom * atom;
+    VkMappedMemoryRange range{};
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.memory = buffer.allocation;
+    range.offset = begin;
+    range.size = end < buffer.size ? end - begin : VK_WHOLE_SIZE;
+    backend->fn.vkFlushMappedMemoryRanges(backend->device, 1, &range);
+}
+
+static void DisposePipeline(IvgBackendVulkan* backend, VkPipeline pipeline)
+{
+    if (pipeline == VK_NULL_HANDLE)
+        return;
+    IvgBackendVulkanDispose& disposal = backend->resource_disposal_queue.emplace_back();
+    disposal.frame_stamp = backend->frame_count;
+    disposal.type = IvgBackendVulkanDispose::Pipeline;
+    disposal.pipeline = pipeline;
+}
+
 static void DestroyResource(IvgBackendVulkan* backend, uint64_t inflight_frames, uint64_t frame_count)
 {
     VkDevice device = backend->device;
@@ -175,9 +567,13 @@ static void DestroyResource(IvgBackendVulkan* backend, uint64_t inflight_frames,
                     fn.vkFreeMemory(device, item.buffer.allocation, nullptr);
                     break;
                 case IvgBackendVulkanDispose::Image:
+                    fn.vkDestroyImageView(device, item.image.view, nullptr);
                     fn.vkDestroyImage(device, item.image.image, nullptr);
                     fn.vkFreeMemory(device, item.image.allocation, nullptr);
                     break;
+                case IvgBackendVulkanDispose::Pipeline:
+                    fn.vkDestroyPipeline(device, item.pipeline, nullptr);
+                    break;
             }
             backend->resource_disposal_queue.pop_front();
         }
@@ -189,7 +585,7 @@ static void DestroyResource(IvgBackendVulkan* backend, uint64_t inflight_frames,
 
 static VkPipeline CreatePipeline(IvgBackendVulkan* backend, const uint32_t* vs_bytecode, uint32_t vs_size,
                                  const uint32_t* fs_bytecode, uint32_t fs_size, bool enable_blend, bool color_write,
-                                 VkPrimitiveTopology topology, VkPipelineLayout layout, VkRenderPass render_pass)
+                                 VkPrimitiveTopology topology, VkPipelineLayout layout, const IvgBackendVulkanTarget& target)
 {
     IvgBackendVulkanFn& fn = backend->fn;
     VkShaderModule vs_module;
@@ -262,7 +658,7 @@ static VkPipeline CreatePipeline(IvgBackendVulkan* backend, const uint32_t* vs_b
 
     VkPipelineMultisampleStateCreateInfo multisample{};
     multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
-    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    multisample.rasterizationSamples = target.samples;
 
     VkPipelineColorBlendAttachmentState attachment{};
     attachment.blendEnable = enable_blend;
@@ -298,9 +694,15 @@ static VkPipeline CreatePipeline(IvgBackendVulkan* backend, const uint32_t* vs_b
     dynamic.dynamicStateCount = 4;
     dynamic.pDynamicStates = dynamic_states;
 
+    // Dynamic rendering declares the attachment instead of a render pass
+    VkPipelineRenderingCreateInfo rendering_info{};
+    rendering_info.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO;
+    rendering_info.colorAttachmentCount = 1;
+    rendering_info.pColorAttachmentFormats = &target.color_format;
+
     VkGraphicsPipelineCreateInfo pipeline_info;
     pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    pipeline_info.pNext = {};
+    pipeline_info.pNext = target.render_pass == VK_NULL_HANDLE ? &rendering_info : nullptr;
     pipeline_info.flags = {};
     pipeline_info.stageCount = 2;
     pipeline_info.pStages = stages;
@@ -314,13 +716,13 @@ static VkPipeline CreatePipeline(IvgBackendVulkan* backend, const uint32_t* vs_b
     pipeline_info.pColorBlendState = &blend;
     pipeline_info.pDynamicState = &dynamic;
     pipeline_info.layout = layout;
-    pipeline_info.renderPass = render_pass;
+    pipeline_info.renderPass = target.render_pass;
     pipeline_info.subpass = 0;
     pipeline_info.basePipelineHandle = {};
     pipeline_info.basePipelineIndex = {};
 
     VkPipeline pipeline;
-    if (IVG_VK_FAILED(backend->fn.vkCreateGraphicsPipelines(backend->device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipeline))) {
+    if (IVG_VK_FAILED(backend->fn.vkCreateGraphicsPipelines(backend->device, backend->vk_pipeline_cache, 1, &pipeline_info, nullptr, &pipeline))) {
         fn.vkDestroyShaderModule(backend->device, vs_module, nullptr);
         fn.vkDestroyShaderModule(backend->device, fs_module, nullptr);
         return VK_NULL_HANDLE;
@@ -331,7 +733,107 @@ static VkPipeline CreatePipeline(IvgBackendVulkan* backend, const uint32_t* vs_b
     return pipeline;
 }
 
-static void PushResourceDescriptors(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, VkBuffer vtx_buffer, VkBuffer winding_buffer)
+static VkPipeline CreateComputePipeline(IvgBackendVulkan* backend, const uint32_t* cs_bytecode, uint32_t cs_size, VkPipelineLayout layout)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    VkShaderModule cs_module;
+
+    VkShaderModuleCreateInfo cs_info;
+    cs_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    cs_info.pNext = nullptr;
+    cs_info.flags = 0;
+    cs_info.codeSize = cs_size;
+    cs_info.pCode = cs_bytecode;
+    if (IVG_VK_FAILED(fn.vkCreateShaderModule(backend->device, &cs_info, nullptr, &cs_module)))
+        return VK_NULL_HANDLE;
+
+    VkComputePipelineCreateInfo pipeline_info{};
+    pipeline_info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    pipeline_info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    pipeline_info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    pipeline_info.stage.module = cs_module;
+    pipeline_info.stage.pName = "main";
+    pipeline_info.layout = layout;
+
+    VkPipeline pipeline;
+    if (IVG_VK_FAILED(fn.vkCreateComputePipelines(backend->device, backend->vk_pipeline_cache, 1, &pipeline_info, nullptr, &pipeline)))
+        pipeline = VK_NULL_HANDLE;
+    fn.vkDestroyShaderModule(backend->device, cs_module, nullptr);
+    return pipeline;
+}
+
+static void DisposeImage(IvgBackendVulkan* backend, const IvgBackendVulkanImage& image)
+{
+    IvgBackendVulkanDispose& disposal = backend->resource_disposal_queue.emplace_back();
+    disposal.frame_stamp = backend->frame_count;
+    disposal.type = IvgBackendVulkanDispose::Image;
+    disposal.image = image;
+}
+
+static void CreateOrResizeStorageImage(IvgBackendVulkan* backend, IvgBackendVulkanImage& image, const VkExtent2D& extent)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    if (image.image != VK_NULL_HANDLE)
+        DisposeImage(backend, image);
+
+    VkImageCreateInfo image_info{};
+    image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_info.extent = { extent.width, extent.height, 1 };
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_STORAGE_BIT;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    IVG_VK_CHECK(fn.vkCreateImage(backend->device, &image_info, nullptr, &image.image));
+
+    VkMemoryRequirements req;
+    fn.vkGetImageMemoryRequirements(backend->device, image.image, &req);
+
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = req.size;
+    alloc_info.memoryTypeIndex = GetMemoryType(fn, backend->physical_device, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, req.memoryTypeBits);
+    IVG_VK_CHECK(fn.vkAllocateMemory(backend->device, &alloc_info, nullptr, &image.allocation));
+    IVG_VK_CHECK(fn.vkBindImageMemory(backend->device, image.image, image.allocation, 0));
+
+    VkImageViewCreateInfo view_info{};
+    view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    view_info.image = image.image;
+    view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    view_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    view_info.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    IVG_VK_CHECK(fn.vkCreateImageView(backend->device, &view_info, nullptr, &image.view));
+    image.extent = extent;
+}
+
+static VkDescriptorPool CreateDescriptorPool(IvgBackendVulkan* backend)
+{
+    VkDescriptorPoolSize descriptor_pool_size[2];
+    descriptor_pool_size[0].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    descriptor_pool_size[0].descriptorCount = 4096;
+    descriptor_pool_size[1].type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    descriptor_pool_size[1].descriptorCount = 16;
+
+    VkDescriptorPoolCreateInfo descriptor_pool_info;
+    descriptor_pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    descriptor_pool_info.pNext = {};
+    descriptor_pool_info.flags = {};
+    descriptor_pool_info.maxSets = 1024;
+    descriptor_pool_info.poolSizeCount = 2;
+    descriptor_pool_info.pPoolSizes = descriptor_pool_size;
+
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    if (IVG_VK_FAILED(backend->fn.vkCreateDescriptorPool(backend->device, &descriptor_pool_info, nullptr, &pool)))
+        return VK_NULL_HANDLE;
+    return pool;
+}
+
+// Allocates from the current pool of the frame and moves on to the next one, created on demand, when it is exhausted
+static VkDescriptorSet AllocateDescriptorSet(IvgBackendVulkan* backend, VkDescriptorSetLayout layout)
 {
     IvgBackendVulkanFn& fn = backend->fn;
     IvgBackendVulkanDescriptorStream& ds = backend->descriptor_stream[backend->frame_id];
@@ -339,65 +841,809 @@ static void PushResourceDescriptors(IvgBackendVulkan* backend, VkCommandBuffer v
     VkDescriptorSetAllocateInfo alloc_info;
     alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
     alloc_info.pNext = {};
-    alloc_info.descriptorPool = ds.pool;
     alloc_info.descriptorSetCount = 1;
-    alloc_info.pSetLayouts = &backend->descriptor_set_layout;
+    alloc_info.pSetLayouts = &layout;
+
+    VkDescriptorSet descriptor_set = VK_NULL_HANDLE;
+    for (;;) {
+        alloc_info.descriptorPool = ds.pools[ds.current_pool];
+        VkResult result = fn.vkAllocateDescriptorSets(backend->device, &alloc_info, &descriptor_set);
+        if (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL) {
+            IVG_VK_CHECK(result);
+            return descriptor_set;
+        }
+        if (++ds.current_pool == ds.pools.Size) {
+            VkDescriptorPool pool = CreateDescriptorPool(backend);
+            IVG_ASSERT(pool != VK_NULL_HANDLE && "Failed to create a descriptor pool");
+            ds.pools.push_back(pool);
+        }
+    }
+}
 
-    VkDescriptorSet descriptor_set;
-    IVG_VK_CHECK(fn.vkAllocateDescriptorSets(backend->device, &alloc_info, &descriptor_set));
+static void PushResourceDescriptors(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, VkBuffer vtx_buffer, VkBuffer winding_buffer,
+                                    VkBuffer instance_buffer, VkBuffer batch_buffer)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
 
-    VkDescriptorBufferInfo descriptor[2];
+    VkDescriptorBufferInfo descriptor[4];
     descriptor[0].buffer = vtx_buffer;
     descriptor[0].offset = 0;
     descriptor[0].range = VK_WHOLE_SIZE;
     descriptor[1].buffer = winding_buffer;
     descriptor[1].offset = 0;
     descriptor[1].range = VK_WHOLE_SIZE;
+    descriptor[2].buffer = instance_buffer;
+    descriptor[2].offset = 0;
+    descriptor[2].range = VK_WHOLE_SIZE;
+    descriptor[3].buffer = batch_buffer;
+    descriptor[3].offset = 0;
+    descriptor[3].range = VK_WHOLE_SIZE;
+
+    // Binding i is vtx_buffer, winding_buffer, instance_buffer and batch_buffer in order
+    VkWriteDescriptorSet write[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        write[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write[i].pNext = {};
+        write[i].dstSet = VK_NULL_HANDLE;
+        write[i].dstBinding = i;
+        write[i].dstArrayElement = 0;
+        write[i].descriptorCount = 1;
+        write[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        write[i].pImageInfo = {};
+        write[i].pBufferInfo = &descriptor[i];
+        write[i].pTexelBufferView = {};
+    }
 
-    VkWriteDescriptorSet write[2];
-    // vtx_buffer descriptor
-    write[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    write[0].pNext = {};
-    write[0].dstSet = descriptor_set;
-    write[0].dstBinding = 0;
-    write[0].dstArrayElement = 0;
-    write[0].descriptorCount = 1;
-    write[0].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    write[0].pImageInfo = {};
-    write[0].pBufferInfo = &descriptor[0];
-    write[0].pTexelBufferView = {};
-    // winding_buffer descriptor
-    write[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-    write[1].pNext = {};
-    write[1].dstSet = descriptor_set;
-    write[1].dstBinding = 1;
-    write[1].dstArrayElement = 0;
-    write[1].descriptorCount = 1;
-    write[1].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    write[1].pImageInfo = {};
-    write[1].pBufferInfo = &descriptor[1];
-    write[1].pTexelBufferView = {};
-    fn.vkUpdateDescriptorSets(backend->device, 2, write, 0, nullptr);
+    // Pushed descriptors live in the command buffer, nothing is allocated
+    if (backend->push_descriptors) {
+        fn.vkCmdPushDescriptorSetKHR(vk_cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, backend->pipeline_layout, 0, 4, write);
+        return;
+    }
+
+    VkDescriptorSet descriptor_set = AllocateDescriptorSet(backend, backend->descriptor_set_layout);
+    for (uint32_t i = 0; i < 4; i++)
+        write[i].dstSet = descriptor_set;
+    fn.vkUpdateDescriptorSets(backend->device, 4, write, 0, nullptr);
     fn.vkCmdBindDescriptorSets(vk_cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, backend->pipeline_layout, 0, 1, &descriptor_set, 0, nullptr);
-    ds.current_descriptor_set = descriptor_set;
+}
+
+static void BindResourceDescriptors(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, VkBuffer vtx_buffer, VkBuffer winding_buffer)
+{
+    VkBuffer batch_buffer = backend->batch_buffer[backend->frame_id].buffer;
+    if (state.bound_vtx_buffer == vtx_buffer && state.bound_winding_buffer == winding_buffer && state.bound_batch_buffer == batch_buffer)
+        return;
+    PushResourceDescriptors(backend, state.cmd_buf, vtx_buffer, winding_buffer, state.instance_buffer, batch_buffer);
+    state.bound_vtx_buffer = vtx_buffer;
+    state.bound_winding_buffer = winding_buffer;
+    state.bound_batch_buffer = batch_buffer;
+}
+
+// Pixel region of a draw, rounded the same way as IvgContext::_EmitDrawCommand. Replayed draws are moved by the
+// replay translation and clipped to the replay clip rect.
+static bool GetDrawRegion(const IvgDrawCmd& draw, const IvgDrawListCmd* replay, IvgRect& rect, uint32_t& width, uint32_t& height)
+{
+    rect = draw.rect;
+    if (replay) {
+        rect.min.x = IvgMax(rect.min.x + replay->translation.x, replay->clip.min.x);
+        rect.min.y = IvgMax(rect.min.y + replay->translation.y, replay->clip.min.y);
+        rect.max.x = IvgMin(rect.max.x + replay->translation.x, replay->clip.max.x);
+        rect.max.y = IvgMin(rect.max.y + replay->translation.y, replay->clip.max.y);
+    }
+
+    int32_t min_x = (int32_t)rect.min.x;
+    int32_t min_y = (int32_t)rect.min.y;
+    int32_t max_x = (int32_t)std::ceil(rect.max.x);
+    int32_t max_y = (int32_t)std::ceil(rect.max.y);
+    if (max_x <= min_x || max_y <= min_y)
+        return false;
+    width = (uint32_t)(max_x - min_x);
+    height = (uint32_t)(max_y - min_y);
+    return true;
+}
+
+// Row stride in pixels and size in winding buffer entries of a draw region. Compact regions hold two pixels per entry
+// and have an even stride so every row starts on an entry.
+static uint32_t GetWindingLayout(const IvgBackendVulkan* backend, const IvgDrawCmd& draw, uint32_t width, uint32_t height,
+                                 uint32_t& stride, uint32_t& format)
+{
+    if (backend->compact_coverage && draw.vtx_count <= COMPACT_COVERAGE_MAX_SEGMENTS) {
+        stride = (width + 1) & ~1u;
+        format = WINDING_FORMAT_16;
+        return stride / 2 * height;
+    }
+    stride = width;
+    format = WINDING_FORMAT_32;
+    return width * height;
+}
+
+static IvgBackendVulkanBuffer* GetDrawListBuffer(IvgBackendVulkan* backend, const IvgDrawList* list)
+{
+    auto it = backend->draw_list_buffers.find(list->id_);
+    if (it != backend->draw_list_buffers.end())
+        return &it->second;
+
+    // Not uploaded with IvgBackendVulkan_UploadDrawList, write the vertices directly into host visible memory
+    IvgBackendVulkanFn& fn = backend->fn;
+    VkDeviceSize size = (VkDeviceSize)list->vtx_count_ * sizeof(IvgV2);
+    IvgBackendVulkanBuffer& buffer = backend->draw_list_buffers[list->id_];
+    CreateBuffer(backend, buffer, IvgMax(size, (VkDeviceSize)sizeof(IvgV2)), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                 VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    IVG_VK_CHECK(fn.vkMapMemory(backend->device, buffer.allocation, 0, VK_WHOLE_SIZE, 0, &buffer.mapped_ptr));
+    std::memcpy(buffer.mapped_ptr, list->vtx_buf_, size);
+    buffer.count = list->vtx_count_;
+
+    VkMappedMemoryRange range{};
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.memory = buffer.allocation;
+    range.offset = 0;
+    range.size = VK_WHOLE_SIZE;
+    fn.vkFlushMappedMemoryRanges(backend->device, 1, &range);
+    return &buffer;
+}
+
+static inline void ApplyDrawState(IvgBackendVulkanDrawArgs& draw_args, const IvgSetDrawStateCmd& draw_state)
+{
+    draw_args.fill_mode = draw_state.fill_mode;
+    draw_args.paint_type = draw_state.paint_type;
+    draw_args.color = draw_state.color[0];
+}
+
+// Scissor of a clip rect, replayed clip rects are moved by the replay translation and clipped to the replay clip rect
+static VkRect2D GetClipScissor(const IvgSetClipRectCmd& clip, const IvgDrawListCmd* replay)
+{
+    VkRect2D rect;
+    if (replay) {
+        float min_x = IvgMax((float)clip.x + replay->translation.x, replay->clip.min.x);
+        float min_y = IvgMax((float)clip.y + replay->translation.y, replay->clip.min.y);
+        float max_x = IvgMin((float)clip.x + (float)clip.w + replay->translation.x, replay->clip.max.x);
+        float max_y = IvgMin((float)clip.y + (float)clip.h + replay->translation.y, replay->clip.max.y);
+        rect.offset = { IvgMax((int32_t)min_x, 0), IvgMax((int32_t)min_y, 0) };
+        rect.extent = { (uint32_t)IvgMax(std::ceil(max_x) - (float)rect.offset.x, 0.0f),
+                        (uint32_t)IvgMax(std::ceil(max_y) - (float)rect.offset.y, 0.0f) };
+    }
+    else {
+        rect.offset = { clip.x, clip.y };
+        rect.extent = { clip.w, clip.h };
+    }
+    return rect;
+}
+
+// Draws one quad over the region of every draw of a batch, in the same order the regions were allocated. Draw states
+// inside the batch are applied on the way, starting from the arguments the batch started with.
+static void DrawBatchRegions(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, const IvgBackendVulkanStream& stream,
+                             IvgByte* batch_begin, IvgByte* batch_end, uint32_t winding_offset, IvgBackendVulkanDrawArgs draw_args)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    IvgCmdBufPtr draw_cmd_ptr{ batch_begin };
+    while (draw_cmd_ptr.cmd_bytes != batch_end) {
+        const IvgBackendCommand* command = draw_cmd_ptr.cmd_data;
+        if (command->header == IvgCommandHeader_SetDrawState) {
+            ApplyDrawState(draw_args, command->set_draw_state);
+            draw_cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+            continue;
+        }
+        if (command->header == IvgCommandHeader_SetClipRect) {
+            draw_cmd_ptr.cmd_bytes += sizeof(IvgSetClipRectCmd);
+            continue;
+        }
+
+        draw_cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+        IvgRect rect;
+        uint32_t width;
+        uint32_t height;
+        if (!GetDrawRegion(command->draw, stream.replay, rect, width, height))
+            continue;
+
+        uint32_t size = GetWindingLayout(backend, command->draw, width, height, draw_args.winding_stride, draw_args.winding_format);
+        draw_args.min_bb = rect.min;
+        draw_args.max_bb = rect.max;
+        draw_args.vtx_offset = stream.vtx_base + command->draw.vtx_offset;
+        draw_args.winding_offset = winding_offset;
+
+        fn.vkCmdPushConstants(state.cmd_buf, backend->pipeline_layout,
+                              VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                              0, sizeof(IvgBackendVulkanDrawArgs), &draw_args);
+        fn.vkCmdDraw(state.cmd_buf, 6, 1, 0, 0);
+        winding_offset += size;
+    }
+}
+
+// Pipeline drawing rects or convex polygons in a single pass, if it could be created
+static inline VkPipeline GetSinglePassPipeline(const IvgBackendVulkanSubmitState& state, uint32_t header)
+{
+    if (header == IvgCommandHeader_DrawRect)
+        return state.rect;
+    if (header == IvgCommandHeader_DrawConvex)
+        return state.convex;
+    return VK_NULL_HANDLE;
+}
+
+// Rects and convex polygons are filled like any other path when their pipelines could not be created
+static inline bool IsFillCommand(const IvgBackendVulkanSubmitState& state, uint32_t header)
+{
+    return header == IvgCommandHeader_Draw || header == IvgCommandHeader_DrawCurves ||
+           ((header == IvgCommandHeader_DrawRect || header == IvgCommandHeader_DrawConvex) &&
+            GetSinglePassPipeline(state, header) == VK_NULL_HANDLE);
+}
+
+// Copies the records of a batch into the batch buffer of the frame and returns the index of the first one. The buffer
+// is replaced by a larger one when full, the draws already recorded keep reading the old one.
+static uint32_t UploadBatchDraws(IvgBackendVulkan* backend, const IvgVector<IvgBackendVulkanBatchDraw>& draws)
+{
+    IvgBackendVulkanBuffer& batch_buffer = backend->batch_buffer[backend->frame_id];
+    uint32_t count = (uint32_t)draws.Size;
+    uint32_t first = batch_buffer.offset;
+    ReserveUploadBuffer(backend, batch_buffer, first + count, sizeof(IvgBackendVulkanBatchDraw), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                        backend->batch_high_water);
+    std::memcpy((IvgBackendVulkanBatchDraw*)batch_buffer.mapped_ptr + first, draws.Data, draws.size_in_bytes());
+    FlushBufferRange(backend, batch_buffer, (VkDeviceSize)first * sizeof(IvgBackendVulkanBatchDraw), draws.size_in_bytes());
+    batch_buffer.offset += count;
+    return first;
+}
+
+static void DrawBatchInstances(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, VkPipeline pipeline, const IvgBackendVulkanBatchArgs& args,
+                               uint32_t instance_count)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    fn.vkCmdBindPipeline(state.cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    fn.vkCmdPushConstants(state.cmd_buf, backend->pipeline_layout, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                          0, sizeof(IvgBackendVulkanBatchArgs), &args);
+    fn.vkCmdDraw(state.cmd_buf, 6, instance_count, 0, 0);
+}
+
+// Makes the winding buffer writes of a fill pass visible to the next one. Without VK_KHR_dynamic_rendering_local_read,
+// dynamic rendering does not allow barriers within its scope, it is ended around the barrier and begun again loading
+// the attachments. With it the by-region barrier of render passes is recorded within the scope.
+static void CoverageBarrier(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    VkMemoryBarrier barrier;
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.pNext = nullptr;
+    barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    if (state.resume_rendering == nullptr) {
+        fn.vkCmdPipelineBarrier(state.cmd_buf, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                                VK_DEPENDENCY_BY_REGION_BIT, 1, &barrier, 0, nullptr, 0, nullptr);
+        return;
+    }
+
+    // Also orders the color writes of the ended scope before the loads of the next one
+    barrier.srcAccessMask |= VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    barrier.dstAccessMask |= VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    fn.vkCmdEndRendering(state.cmd_buf);
+    fn.vkCmdPipelineBarrier(state.cmd_buf, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                            VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                            0, 1, &barrier, 0, nullptr, 0, nullptr);
+    fn.vkCmdBeginRendering(state.cmd_buf, state.resume_rendering);
+}
+
+// Copies the info a dynamic rendering scope was begun with, loading its attachments instead of clearing them. Returns
+// nullptr when the scope cannot be split: without the dynamic rendering functions, for suspending scopes, whose
+// continuation the caller records, or when an attachment is not stored.
+static const VkRenderingInfo* GetResumeRendering(IvgBackendVulkan* backend, const VkRenderingInfo* info)
+{
+    if (!info || !backend->fn.vkCmdBeginRendering || !backend->fn.vkCmdEndRendering || (info->flags & VK_RENDERING_SUSPENDING_BIT))
+        return nullptr;
+    IvgVector<VkRenderingAttachmentInfo>& attachments = backend->resume_attachments;
+    attachments.resize(0);
+    for (uint32_t i = 0; i < info->colorAttachmentCount; i++)
+        attachments.push_back(info->pColorAttachments[i]);
+    if (info->pDepthAttachment)
+        attachments.push_back(*info->pDepthAttachment);
+    if (info->pStencilAttachment)
+        attachments.push_back(*info->pStencilAttachment);
+    for (VkRenderingAttachmentInfo& attachment : attachments) {
+        if (attachment.imageView != VK_NULL_HANDLE && attachment.storeOp != VK_ATTACHMENT_STORE_OP_STORE)
+            return nullptr;
+        attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    }
+
+    VkRenderingInfo& resume = backend->resume_rendering;
+    resume = *info;
+    resume.flags &= ~(VkRenderingFlags)VK_RENDERING_RESUMING_BIT;
+    uint32_t next = info->colorAttachmentCount;
+    resume.pColorAttachments = attachments.Data;
+    resume.pDepthAttachment = info->pDepthAttachment ? &attachments[next++] : nullptr;
+    resume.pStencilAttachment = info->pStencilAttachment ? &attachments[next++] : nullptr;
+    return &resume;
+}
+
+static inline IvgBackendVulkanBuffer& GetWindingBuffer(IvgBackendVulkan* backend)
+{
+    return backend->winding_buffer[backend->share_winding_buffer ? 0 : backend->frame_id];
+}
+
+// Returns the regions of a finished batch to the winding buffer. The fill pass cleared them, the next batch of the
+// same subpass allocates from the same base again. Later submits start past them, they are in other subpasses the
+// barriers of this one do not cover.
+// Regions are allocated linearly rather than packed into a fixed width 2D atlas: each one is addressed with its own
+// width as row stride, so consecutive regions leave no gaps, where shelf or skyline packing would waste the space
+// beside and above shelves and split batches sooner. Recycling per batch gives the reuse an atlas would.
+static void EndWindingBatch(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, bool split)
+{
+    IvgBackendVulkanStats& stats = backend->stats;
+    uint32_t used = state.winding_offset - state.winding_base;
+    stats.num_batches++;
+    stats.num_splits += split ? 1 : 0;
+    stats.region_size += used;
+    stats.peak_winding_size = IvgMax(stats.peak_winding_size, used);
+    stats.winding_buffer_size = GetWindingBuffer(backend).count;
+    state.winding_end = IvgMax(state.winding_end, state.winding_offset);
+    state.winding_offset = state.winding_base;
+}
+
+// Creates the winding buffer for draws that do not allocate regions but still bind it as part of the descriptor set
+static void CreateWindingBuffer(IvgBackendVulkan* backend)
+{
+    IvgBackendVulkanBuffer& winding_buffer = GetWindingBuffer(backend);
+    if (winding_buffer.buffer != VK_NULL_HANDLE)
+        return;
+    CreateOrResizeBuffer(backend, winding_buffer, backend->min_winding_buffer_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    winding_buffer.count = (uint32_t)(winding_buffer.size / sizeof(int32_t));
+}
+
+// Starts allocating regions from the beginning of the winding buffer, growing it when a single region does not fit
+static void WrapWindingBuffer(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, uint32_t size)
+{
+    IvgBackendVulkanBuffer& winding_buffer = GetWindingBuffer(backend);
+    if (size > winding_buffer.count) {
+        VkDeviceSize required_size = IvgMax(backend->min_winding_buffer_size, (VkDeviceSize)size * sizeof(int32_t));
+        CreateOrResizeBuffer(backend, winding_buffer, required_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        winding_buffer.count = (uint32_t)(winding_buffer.size / sizeof(int32_t));
+    }
+    state.winding_base = 0;
+    state.winding_offset = 0;
+    state.winding_end = 0;
+}
+
+// Records consecutive draw commands in two passes: accumulate the coverage of every draw into its own region of the
+// winding buffer, then fill and clear those regions. The batch is split when the winding buffer is full. Line and
+// curve draws only differ in the coverage pass.
+// With the backdrop pipelines each segment only touches the rows it crosses and stores row differences, which a resolve
+// pass sums down every column before the fill. Otherwise segments are drawn from the top of the region.
+// With the batch pipelines the draws are written to the batch buffer instead, and every pass is a single instanced draw
+// over all line segments, curve segments or regions of the batch.
+// Draw states and clip rects do not end a batch. There is no separate table of paints and clip rects per draw: the
+// batch records carry the color, the only paint parameter the shaders read, and a draw region is already clipped
+// when it is recorded, so only the coverage draws recorded one by one need the scissor. Once the clip rect changed
+// within the batch, the other passes run with the scissor of the union of its regions.
+static IvgByte* SubmitDrawBatch(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, const IvgBackendVulkanStream& stream,
+                                IvgByte* batch_begin)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    IvgBackendVulkanBuffer& winding_buffer = GetWindingBuffer(backend);
+    IvgBackendVulkanDrawArgs& draw_args = state.draw_args;
+    draw_args.translation = stream.translation;
+    IvgBackendVulkanDrawArgs batch_begin_args = draw_args;
+
+    // 1. draw to pixel coverage
+    IvgCmdBufPtr draw_cmd_ptr{ batch_begin };
+    uint32_t batch_winding_offset = state.winding_offset;
+    uint32_t num_draws = 0;
+    uint32_t num_line_segments = 0;
+    uint32_t num_curve_segments = 0;
+    bool split = false;
+    bool clip_changed = false;
+    int32_t bounds_min_x = INT32_MAX;
+    int32_t bounds_min_y = INT32_MAX;
+    int32_t bounds_max_x = 0;
+    int32_t bounds_max_y = 0;
+    IvgVector<IvgBackendVulkanBatchDraw>& batch_draws = backend->batch_draws;
+    batch_draws.resize(0);
+    VkPipeline bound_pipeline = VK_NULL_HANDLE;
+    while (draw_cmd_ptr.cmd_bytes != stream.cmd_end) {
+        const IvgBackendCommand* command = draw_cmd_ptr.cmd_data;
+        if (command->header == IvgCommandHeader_SetDrawState) {
+            ApplyDrawState(draw_args, command->set_draw_state);
+            draw_cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+            continue;
+        }
+        if (command->header == IvgCommandHeader_SetClipRect) {
+            state.scissor = GetClipScissor(command->set_clip_rect, stream.replay);
+            if (!state.batched)
+                fn.vkCmdSetScissor(state.cmd_buf, 0, 1, &state.scissor);
+            clip_changed = true;
+            draw_cmd_ptr.cmd_bytes += sizeof(IvgSetClipRectCmd);
+            continue;
+        }
+        if (!IsFillCommand(state, command->header))
+            break;
+
+        IvgRect rect;
+        uint32_t width;
+        uint32_t height;
+        if (!GetDrawRegion(command->draw, stream.replay, rect, width, height)) {
+            draw_cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+            continue;
+        }
+
+        // Check buffer size first!
+        uint32_t stride;
+        uint32_t format;
+        uint32_t size = GetWindingLayout(backend, command->draw, width, height, stride, format);
+        if (state.winding_offset + size > winding_buffer.count) {
+            // Fill what we have so far, then start again from the beginning of the winding buffer
+            split = num_draws > 0;
+            if (split)
+                break;
+            WrapWindingBuffer(backend, state, size);
+            batch_winding_offset = 0;
+        }
+        bounds_min_x = IvgMin(bounds_min_x, (int32_t)rect.min.x);
+        bounds_min_y = IvgMin(bounds_min_y, (int32_t)rect.min.y);
+        bounds_max_x = IvgMax(bounds_max_x, (int32_t)std::ceil(rect.max.x));
+        bounds_max_y = IvgMax(bounds_max_y, (int32_t)std::ceil(rect.max.y));
+
+        if (state.batched) {
+            IvgBackendVulkanBatchDraw batch_draw{};
+            batch_draw.min_bb = rect.min;
+            batch_draw.max_bb = rect.max;
+            batch_draw.translation = draw_args.translation;
+            batch_draw.vtx_offset = stream.vtx_base + command->draw.vtx_offset;
+            batch_draw.line_base = num_line_segments;
+            batch_draw.curve_base = num_curve_segments;
+            batch_draw.winding_stride = stride;
+            batch_draw.winding_offset = state.winding_offset;
+            batch_draw.color = draw_args.color;
+            batch_draw.winding_format = format;
+            batch_draws.push_back(batch_draw);
+            if (command->header == IvgCommandHeader_DrawCurves)
+                num_curve_segments += command->draw.vtx_count;
+            else
+                num_line_segments += command->draw.vtx_count;
+            state.winding_offset += size;
+            num_draws++;
+            draw_cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+            continue;
+        }
+
+        BindResourceDescriptors(backend, state, stream.vtx_buffer, winding_buffer.buffer);
+
+        // Contexts only record curves for backends reporting IvgBackendFeatures_Curves. Should the pipeline still be
+        // missing the region is filled and cleared, it just stays empty.
+        VkPipeline pipeline = command->header == IvgCommandHeader_DrawCurves ? state.polygon_curve :
+                              state.resolve != VK_NULL_HANDLE ? state.polygon_backdrop : state.polygon;
+        if (pipeline != bound_pipeline && pipeline != VK_NULL_HANDLE) {
+            fn.vkCmdBindPipeline(state.cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+            bound_pipeline = pipeline;
+        }
+
+        draw_args.min_bb = rect.min;
+        draw_args.max_bb = rect.max;
+        draw_args.vtx_offset = stream.vtx_base + command->draw.vtx_offset;
+        draw_args.winding_stride = stride;
+        draw_args.winding_offset = state.winding_offset;
+        draw_args.winding_format = format;
+
+        fn.vkCmdPushConstants(state.cmd_buf, backend->pipeline_layout,
+                              VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                              0, sizeof(IvgBackendVulkanDrawArgs), &draw_args);
+        if (pipeline != VK_NULL_HANDLE)
+            fn.vkCmdDraw(state.cmd_buf, command->draw.vtx_count * 6, 1, 0, 0);
+
+        state.winding_offset += size;
+        num_draws++;
+        draw_cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+    }
+
+    IvgByte* batch_end = draw_cmd_ptr.cmd_bytes;
+    if (num_draws == 0)
+        return batch_end;
+
+    if (clip_changed) {
+        VkRect2D bounds_scissor;
+        bounds_scissor.offset = { IvgMax(bounds_min_x, 0), IvgMax(bounds_min_y, 0) };
+        bounds_scissor.extent = { (uint32_t)IvgMax(bounds_max_x - bounds_scissor.offset.x, 0),
+                                  (uint32_t)IvgMax(bounds_max_y - bounds_scissor.offset.y, 0) };
+        fn.vkCmdSetScissor(state.cmd_buf, 0, 1, &bounds_scissor);
+    }
+
+    IvgBackendVulkanBatchArgs batch_args;
+    if (state.batched) {
+        backend->stats.num_batched_draws += num_draws;
+        batch_args.inv_viewport = draw_args.inv_viewport;
+        batch_args.batch_first = UploadBatchDraws(backend, batch_draws);
+        batch_args.batch_count = num_draws;
+        BindResourceDescriptors(backend, state, stream.vtx_buffer, winding_buffer.buffer);
+        if (num_line_segments != 0)
+            DrawBatchInstances(backend, state, state.polygon_backdrop, batch_args, num_line_segments);
+        if (num_curve_segments != 0)
+            DrawBatchInstances(backend, state, state.polygon_curve, batch_args, num_curve_segments);
+    }
+
+    CoverageBarrier(backend, state);
+
+    // 2. sum the row differences down each column. The resolve fragment of a column reads and writes the whole
+    // column, so this relies on the barriers above and below synchronizing the entire winding buffer.
+    if (state.resolve != VK_NULL_HANDLE) {
+        if (state.batched) {
+            DrawBatchInstances(backend, state, state.resolve, batch_args, num_draws);
+        }
+        else {
+            fn.vkCmdBindPipeline(state.cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, state.resolve);
+            DrawBatchRegions(backend, state, stream, batch_begin, batch_end, batch_winding_offset, batch_begin_args);
+        }
+        CoverageBarrier(backend, state);
+    }
+
+    // 3. fill covered pixel
+    if (state.batched) {
+        DrawBatchInstances(backend, state, state.fill, batch_args, num_draws);
+    }
+    else {
+        fn.vkCmdBindPipeline(state.cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, state.fill);
+        DrawBatchRegions(backend, state, stream, batch_begin, batch_end, batch_winding_offset, batch_begin_args);
+    }
+
+    CoverageBarrier(backend, state);
+    if (clip_changed)
+        fn.vkCmdSetScissor(state.cmd_buf, 0, 1, &state.scissor);
+    EndWindingBatch(backend, state, split);
+    return batch_end;
+}
+
+// Records consecutive analytic strokes. They are drawn directly with one quad per segment and do not touch the
+// winding buffer, which is only bound because it is part of the descriptor set.
+static IvgByte* SubmitStrokeBatch(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, const IvgBackendVulkanStream& stream,
+                                  IvgByte* batch_begin)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    IvgBackendVulkanBuffer& winding_buffer = GetWindingBuffer(backend);
+    IvgBackendVulkanDrawArgs& draw_args = state.draw_args;
+    IvgCmdBufPtr cmd_ptr{ batch_begin };
+    if (state.stroke == VK_NULL_HANDLE) {
+        // Contexts only record strokes for backends reporting IvgBackendFeatures_AnalyticStroke
+        while (cmd_ptr.cmd_bytes != stream.cmd_end && cmd_ptr.cmd_data->header == IvgCommandHeader_Stroke)
+            cmd_ptr.cmd_bytes += sizeof(IvgStrokeCmd);
+        return cmd_ptr.cmd_bytes;
+    }
+
+    CreateWindingBuffer(backend);
+    BindResourceDescriptors(backend, state, stream.vtx_buffer, winding_buffer.buffer);
+    fn.vkCmdBindPipeline(state.cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, state.stroke);
+    draw_args.translation = stream.translation;
+
+    while (cmd_ptr.cmd_bytes != stream.cmd_end) {
+        const IvgBackendCommand* command = cmd_ptr.cmd_data;
+        if (command->header != IvgCommandHeader_Stroke)
+            break;
+
+        const IvgStrokeCmd& stroke = command->stroke;
+        uint32_t num_segments = stroke.closed ? stroke.vtx_count : stroke.vtx_count - 1;
+        draw_args.vtx_offset = stream.vtx_base + stroke.vtx_offset;
+        draw_args.vtx_count = stroke.vtx_count;
+        draw_args.stroke_width = stroke.width;
+        draw_args.miter_limit = stroke.miter_limit;
+        draw_args.stroke_style = (uint32_t)stroke.join | ((uint32_t)stroke.cap << 8) | (stroke.closed ? 0x10000u : 0u);
+        fn.vkCmdPushConstants(state.cmd_buf, backend->pipeline_layout,
+                              VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                              0, sizeof(IvgBackendVulkanDrawArgs), &draw_args);
+        fn.vkCmdDraw(state.cmd_buf, num_segments * 6, 1, 0, 0);
+        cmd_ptr.cmd_bytes += sizeof(IvgStrokeCmd);
+    }
+    return cmd_ptr.cmd_bytes;
+}
+
+// Records consecutive rects or consecutive convex polygons with one instanced draw per run. Their coverage is computed
+// from the shape in the fragment shader, so they need neither the winding buffer nor any barrier. Draw states are
+// applied on the way like in fill batches, a clip rect ends the run since the scissor is the only clip of the pixels
+// the region was rounded out to. Runs of opaque rects on pixel boundaries cover every pixel of their region and are
+// drawn without blending.
+static IvgByte* SubmitSinglePassBatch(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, const IvgBackendVulkanStream& stream,
+                                      IvgByte* batch_begin)
+{
+    IvgBackendVulkanDrawArgs& draw_args = state.draw_args;
+    uint32_t header = ((const IvgBackendCommand*)batch_begin)->header;
+    IvgV2 translation = stream.replay ? stream.replay->translation : IvgV2();
+    bool aligned_translation = translation.x == std::floor(translation.x) && translation.y == std::floor(translation.y);
+    IvgVector<IvgBackendVulkanBatchDraw>& batch_draws = backend->batch_draws;
+    batch_draws.resize(0);
+    bool opaque = header == IvgCommandHeader_DrawRect;
+    IvgCmdBufPtr cmd_ptr{ batch_begin };
+    while (cmd_ptr.cmd_bytes != stream.cmd_end) {
+        const IvgBackendCommand* command = cmd_ptr.cmd_data;
+        if (command->header == IvgCommandHeader_SetDrawState) {
+            ApplyDrawState(draw_args, command->set_draw_state);
+            cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+            continue;
+        }
+        if (command->header != header)
+            break;
+
+        cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+        IvgRect rect;
+        uint32_t width;
+        uint32_t height;
+        if (!GetDrawRegion(command->draw, stream.replay, rect, width, height))
+            continue;
+
+        opaque = opaque && (draw_args.color >> 24) == 0xFF && aligned_translation &&
+                 rect.min.x == std::floor(rect.min.x) && rect.min.y == std::floor(rect.min.y) &&
+                 rect.max.x == std::floor(rect.max.x) && rect.max.y == std::floor(rect.max.y);
+        IvgBackendVulkanBatchDraw batch_draw{};
+        batch_draw.min_bb = rect.min;
+        batch_draw.max_bb = rect.max;
+        batch_draw.translation = stream.translation;
+        batch_draw.vtx_offset = stream.vtx_base + command->draw.vtx_offset;
+        batch_draw.color = draw_args.color;
+        batch_draw.vtx_count = command->draw.vtx_count;
+        batch_draws.push_back(batch_draw);
+    }
+
+    if (batch_draws.Size == 0)
+        return cmd_ptr.cmd_bytes;
+
+    IvgBackendVulkanBatchArgs batch_args;
+    batch_args.inv_viewport = draw_args.inv_viewport;
+    batch_args.batch_first = UploadBatchDraws(backend, batch_draws);
+    batch_args.batch_count = (uint32_t)batch_draws.Size;
+    CreateWindingBuffer(backend);
+    BindResourceDescriptors(backend, state, stream.vtx_buffer, GetWindingBuffer(backend).buffer);
+    VkPipeline pipeline = opaque && state.rect_opaque != VK_NULL_HANDLE ? state.rect_opaque : GetSinglePassPipeline(state, header);
+    DrawBatchInstances(backend, state, pipeline, batch_args, batch_args.batch_count);
+    backend->stats.num_single_pass++;
+    return cmd_ptr.cmd_bytes;
+}
+
+// Records the instances of a draw instances command in chunks that fit in the rest of the winding buffer. Each chunk
+// is drawn with one instanced draw per pass, the instances read their transform and region from the instance buffer.
+static void SubmitDrawInstances(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, const IvgContext* ctx,
+                                const IvgBackendVulkanStream& stream, const IvgDrawInstancesCmd& command)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    IvgBackendVulkanBuffer& winding_buffer = GetWindingBuffer(backend);
+    // Contexts only record instances for backends reporting IvgBackendFeatures_Instances
+    if (state.instance_polygon == VK_NULL_HANDLE || state.instance_fill == VK_NULL_HANDLE)
+        return;
+
+    const IvgPathInstance* instances = ctx->instances_.Data + command.instance_offset;
+    uint32_t count = command.instance_count;
+    auto region_end = [&](uint32_t i) { return i + 1 < count ? instances[i + 1].region_offset : command.region_size; };
+
+    // The instances carry their own color, the draw state of the stream is left untouched
+    IvgBackendVulkanDrawArgs draw_args = state.draw_args;
+    draw_args.vtx_offset = stream.vtx_base + command.vtx_offset;
+    draw_args.fill_mode = command.fill_mode;
+    draw_args.translation = IvgV2();
+    draw_args.winding_format = WINDING_FORMAT_32;
+
+    uint32_t first = 0;
+    while (first < count) {
+        uint32_t region_begin = instances[first].region_offset;
+        uint32_t last = first;
+        while (last < count && state.winding_offset + (region_end(last) - region_begin) <= winding_buffer.count)
+            last++;
+
+        if (last == first) {
+            // Start again from the beginning of the winding buffer, previous batches have cleared their regions
+            uint32_t size = region_end(first) - region_begin;
+            WrapWindingBuffer(backend, state, size);
+            continue;
+        }
+
+        BindResourceDescriptors(backend, state, stream.vtx_buffer, winding_buffer.buffer);
+
+        // Region offsets are relative to the first instance of the command. The subtraction may wrap around, the
+        // unsigned addition in the shaders wraps back.
+        draw_args.winding_offset = state.winding_offset - region_begin;
+        fn.vkCmdPushConstants(state.cmd_buf, backend->pipeline_layout,
+                              VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+                              0, sizeof(IvgBackendVulkanDrawArgs), &draw_args);
+
+        // 1. draw to pixel coverage
+        uint32_t first_instance = state.instance_base + command.instance_offset + first;
+        fn.vkCmdBindPipeline(state.cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, state.instance_polygon);
+        fn.vkCmdDraw(state.cmd_buf, command.vtx_count * 6, last - first, 0, first_instance);
+        CoverageBarrier(backend, state);
+
+        // 2. fill covered pixel
+        fn.vkCmdBindPipeline(state.cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, state.instance_fill);
+        fn.vkCmdDraw(state.cmd_buf, 6, last - first, 0, first_instance);
+        CoverageBarrier(backend, state);
+
+        state.winding_offset += region_end(last - 1) - region_begin;
+        EndWindingBatch(backend, state, last < count);
+        first = last;
+    }
+}
+
+static void SubmitCommandStream(IvgBackendVulkan* backend, IvgBackendVulkanSubmitState& state, const IvgContext* ctx,
+                                const IvgBackendVulkanStream& stream)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    const IvgDrawListCmd* replay = stream.replay;
+    IvgCmdBufPtr cmd_ptr{ stream.cmd_begin };
+    while (cmd_ptr.cmd_bytes != stream.cmd_end) {
+        const IvgBackendCommand* command = cmd_ptr.cmd_data;
+        switch (command->header) {
+            case IvgCommandHeader_SetDrawState:
+            {
+                ApplyDrawState(state.draw_args, command->set_draw_state);
+                cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+                break;
+            }
+            case IvgCommandHeader_SetClipRect:
+            {
+                state.scissor = GetClipScissor(command->set_clip_rect, replay);
+                fn.vkCmdSetScissor(state.cmd_buf, 0, 1, &state.scissor);
+                cmd_ptr.cmd_bytes += sizeof(IvgSetClipRectCmd);
+                break;
+            }
+            case IvgCommandHeader_Draw:
+            case IvgCommandHeader_DrawCurves:
+            {
+                cmd_ptr.cmd_bytes = SubmitDrawBatch(backend, state, stream, cmd_ptr.cmd_bytes);
+                break;
+            }
+            case IvgCommandHeader_Stroke:
+            {
+                cmd_ptr.cmd_bytes = SubmitStrokeBatch(backend, state, stream, cmd_ptr.cmd_bytes);
+                break;
+            }
+            case IvgCommandHeader_DrawRect:
+            case IvgCommandHeader_DrawConvex:
+            {
+                if (GetSinglePassPipeline(state, command->header) != VK_NULL_HANDLE)
+                    cmd_ptr.cmd_bytes = SubmitSinglePassBatch(backend, state, stream, cmd_ptr.cmd_bytes);
+                else
+                    cmd_ptr.cmd_bytes = SubmitDrawBatch(backend, state, stream, cmd_ptr.cmd_bytes);
+                break;
+            }
+            case IvgCommandHeader_DrawInstances:
+            {
+                IVG_ASSERT(!replay && "Draw lists cannot contain instanced draws");
+                SubmitDrawInstances(backend, state, ctx, stream, command->draw_instances);
+                cmd_ptr.cmd_bytes += sizeof(IvgDrawInstancesCmd);
+                break;
+            }
+            case IvgCommandHeader_DrawList:
+            {
+                IVG_ASSERT(!replay && "Draw lists cannot be nested");
+                const IvgDrawList* list = ctx->draw_lists_[command->draw_list.list_index];
+                IvgBackendVulkanStream list_stream;
+                list_stream.cmd_begin = list->cmd_buf_;
+                list_stream.cmd_end = list->cmd_buf_ + list->cmd_size_;
+                list_stream.replay = &command->draw_list;
+                list_stream.translation = command->draw_list.translation;
+                list_stream.vtx_buffer = GetDrawListBuffer(backend, list)->buffer;
+                list_stream.vtx_base = 0;
+                SubmitCommandStream(backend, state, ctx, list_stream);
+                cmd_ptr.cmd_bytes += sizeof(IvgDrawListCmd);
+                break;
+            }
+            default:
+                IVG_ASSERT(false && "Unknown command");
+                return;
+        }
+    }
 }
 
 void IvgBackendVulkan_LoadFunctions(IvgBackendVulkan_LoaderFunc instance_loader_fn, IvgBackendVulkan_LoaderFunc device_loader_fn, void* userdata, IvgBackendVulkanFn* fn)
 {
     fn->vkGetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties)instance_loader_fn("vkGetPhysicalDeviceImageFormatProperties", userdata);
     fn->vkGetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties)instance_loader_fn("vkGetPhysicalDeviceMemoryProperties", userdata);
+    fn->vkGetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties)instance_loader_fn("vkGetPhysicalDeviceProperties", userdata);
     fn->vkGetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements)device_loader_fn("vkGetBufferMemoryRequirements", userdata);
+    fn->vkGetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements)device_loader_fn("vkGetImageMemoryRequirements", userdata);
     fn->vkAllocateMemory = (PFN_vkAllocateMemory)device_loader_fn("vkAllocateMemory", userdata);
     fn->vkFreeMemory = (PFN_vkFreeMemory)device_loader_fn("vkFreeMemory", userdata);
     fn->vkMapMemory = (PFN_vkMapMemory)device_loader_fn("vkMapMemory", userdata);
     fn->vkFlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges)device_loader_fn("vkFlushMappedMemoryRanges", userdata);
     fn->vkCreateBuffer = (PFN_vkCreateBuffer)device_loader_fn("vkCreateBuffer", userdata);
     fn->vkCreateImage = (PFN_vkCreateImage)device_loader_fn("vkCreateImage", userdata);
+    fn->vkCreateImageView = (PFN_vkCreateImageView)device_loader_fn("vkCreateImageView", userdata);
     fn->vkCreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout)device_loader_fn("vkCreateDescriptorSetLayout", userdata);
     fn->vkCreateDescriptorPool = (PFN_vkCreateDescriptorPool)device_loader_fn("vkCreateDescriptorPool", userdata);
     fn->vkCreateShaderModule = (PFN_vkCreateShaderModule)device_loader_fn("vkCreateShaderModule", userdata);
     fn->vkCreatePipelineLayout = (PFN_vkCreatePipelineLayout)device_loader_fn("vkCreatePipelineLayout", userdata);
     fn->vkCreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines)device_loader_fn("vkCreateGraphicsPipelines", userdata);
+    fn->vkCreateComputePipelines = (PFN_vkCreateComputePipelines)device_loader_fn("vkCreateComputePipelines", userdata);
+    fn->vkCreatePipelineCache = (PFN_vkCreatePipelineCache)device_loader_fn("vkCreatePipelineCache", userdata);
+    fn->vkGetPipelineCacheData = (PFN_vkGetPipelineCacheData)device_loader_fn("vkGetPipelineCacheData", userdata);
+    fn->vkDestroyPipelineCache = (PFN_vkDestroyPipelineCache)device_loader_fn("vkDestroyPipelineCache", userdata);
     fn->vkBindBufferMemory = (PFN_vkBindBufferMemory)device_loader_fn("vkBindBufferMemory", userdata);
     fn->vkBindImageMemory = (PFN_vkBindImageMemory)device_loader_fn("vkBindImageMemory", userdata);
     fn->vkAllocateDescriptorSets = (PFN_vkAllocateDescriptorSets)device_loader_fn("vkAllocateDescriptorSets", userdata);
@@ -405,6 +1651,7 @@ void IvgBackendVulkan_LoadFunctions(IvgBackendVulkan_LoaderFunc instance_loader_
     fn->vkResetDescriptorPool = (PFN_vkResetDescriptorPool)device_loader_fn("vkResetDescriptorPool", userdata);
     fn->vkDestroyBuffer = (PFN_vkDestroyBuffer)device_loader_fn("vkDestroyBuffer", userdata);
     fn->vkDestroyImage = (PFN_vkDestroyImage)device_loader_fn("vkDestroyImage", userdata);
+    fn->vkDestroyImageView = (PFN_vkDestroyImageView)device_loader_fn("vkDestroyImageView", userdata);
     fn->vkDestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout)device_loader_fn("vkDestroyDescriptorSetLayout", userdata);
     fn->vkDestroyDescriptorPool = (PFN_vkDestroyDescriptorPool)device_loader_fn("vkDestroyDescriptorPool", userdata);
     fn->vkDestroyShaderModule = (PFN_vkDestroyShaderModule)device_loader_fn("vkDestroyShaderModule", userdata);
@@ -412,12 +1659,246 @@ void IvgBackendVulkan_LoadFunctions(IvgBackendVulkan_LoaderFunc instance_loader_
     fn->vkDestroyPipeline = (PFN_vkDestroyPipeline)device_loader_fn("vkDestroyPipeline", userdata);
     fn->vkCmdBindPipeline = (PFN_vkCmdBindPipeline)device_loader_fn("vkCmdBindPipeline", userdata);
     fn->vkCmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets)device_loader_fn("vkCmdBindDescriptorSets", userdata);
+    fn->vkCmdPushDescriptorSetKHR = (PFN_vkCmdPushDescriptorSetKHR)device_loader_fn("vkCmdPushDescriptorSetKHR", userdata);
     fn->vkCmdPushConstants = (PFN_vkCmdPushConstants)device_loader_fn("vkCmdPushConstants", userdata);
     fn->vkCmdDraw = (PFN_vkCmdDraw)device_loader_fn("vkCmdDraw", userdata);
+    fn->vkCmdDispatch = (PFN_vkCmdDispatch)device_loader_fn("vkCmdDispatch", userdata);
     fn->vkCmdSetScissor = (PFN_vkCmdSetScissor)device_loader_fn("vkCmdSetScissor", userdata);
     fn->vkCmdSetViewport = (PFN_vkCmdSetViewport)device_loader_fn("vkCmdSetViewport", userdata);
     fn->vkCmdFillBuffer = (PFN_vkCmdFillBuffer)device_loader_fn("vkCmdFillBuffer", userdata);
+    fn->vkCmdCopyBuffer = (PFN_vkCmdCopyBuffer)device_loader_fn("vkCmdCopyBuffer", userdata);
     fn->vkCmdPipelineBarrier = (PFN_vkCmdPipelineBarrier)device_loader_fn("vkCmdPipelineBarrier", userdata);
+    fn->vkCmdBeginRendering = (PFN_vkCmdBeginRendering)device_loader_fn("vkCmdBeginRendering", userdata);
+    fn->vkCmdEndRendering = (PFN_vkCmdEndRendering)device_loader_fn("vkCmdEndRendering", userdata);
+    if (!fn->vkCmdBeginRendering || !fn->vkCmdEndRendering) {
+        fn->vkCmdBeginRendering = (PFN_vkCmdBeginRendering)device_loader_fn("vkCmdBeginRenderingKHR", userdata);
+        fn->vkCmdEndRendering = (PFN_vkCmdEndRendering)device_loader_fn("vkCmdEndRenderingKHR", userdata);
+    }
+}
+
+// Creates every pipeline used by submits into a target
+static IvgBackendVulkanPipeline CreatePipelines(IvgBackendVulkan* backend, const IvgBackendVulkanTarget& target)
+{
+    VkPipeline polygon = CreatePipeline(backend, __spirv_vulkan_polygon_vs_shader, __spirv_vulkan_polygon_vs_size,
+                                        __spirv_vulkan_polygon_fs_shader, __spirv_vulkan_polygon_fs_size,
+                                        false, false, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                        backend->pipeline_layout, target);
+    // The backdrop and curve coverage shaders write row differences and need the resolve pass
+    VkPipeline polygon_curve = VK_NULL_HANDLE;
+    VkPipeline resolve = CreatePipeline(backend, __spirv_vulkan_resolve_vs_shader, __spirv_vulkan_resolve_vs_size,
+                                        __spirv_vulkan_resolve_fs_shader, __spirv_vulkan_resolve_fs_size,
+                                        false, false, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                        backend->pipeline_layout, target);
+    VkPipeline polygon_backdrop = CreatePipeline(backend, __spirv_vulkan_polygon_backdrop_vs_shader, __spirv_vulkan_polygon_backdrop_vs_size,
+                                                 __spirv_vulkan_polygon_backdrop_fs_shader, __spirv_vulkan_polygon_backdrop_fs_size,
+                                                 false, false, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                                 backend->pipeline_layout, target);
+    // Without both the segments would be drawn from the top of the region and resolved again, or not drawn
+    if (resolve == VK_NULL_HANDLE || polygon_backdrop == VK_NULL_HANDLE) {
+        backend->fn.vkDestroyPipeline(backend->device, resolve, nullptr);
+        backend->fn.vkDestroyPipeline(backend->device, polygon_backdrop, nullptr);
+        resolve = VK_NULL_HANDLE;
+        polygon_backdrop = VK_NULL_HANDLE;
+    }
+    if (resolve != VK_NULL_HANDLE) {
+        polygon_curve = CreatePipeline(backend, __spirv_vulkan_polygon_curve_vs_shader, __spirv_vulkan_polygon_curve_vs_size,
+                                       __spirv_vulkan_polygon_curve_fs_shader, __spirv_vulkan_polygon_curve_fs_size,
+                                       false, false, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                       backend->pipeline_layout, target);
+    }
+    VkPipeline fill = CreatePipeline(backend, __spirv_vulkan_fill_vs_shader, __spirv_vulkan_fill_vs_size,
+                                     __spirv_vulkan_fill_fs_shader, __spirv_vulkan_fill_fs_size,
+                                     true, true, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                     backend->pipeline_layout, target);
+    // The batch shaders replace every pipeline of the fill passes
+    VkPipeline batch[4];
+    batch[0] = CreatePipeline(backend, __spirv_vulkan_polygon_batch_vs_shader, __spirv_vulkan_polygon_batch_vs_size,
+                              __spirv_vulkan_polygon_batch_fs_shader, __spirv_vulkan_polygon_batch_fs_size,
+                              false, false, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                              backend->pipeline_layout, target);
+    batch[1] = CreatePipeline(backend, __spirv_vulkan_polygon_curve_batch_vs_shader, __spirv_vulkan_polygon_curve_batch_vs_size,
+                              __spirv_vulkan_polygon_curve_batch_fs_shader, __spirv_vulkan_polygon_curve_batch_fs_size,
+                              false, false, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                              backend->pipeline_layout, target);
+    batch[2] = CreatePipeline(backend, __spirv_vulkan_resolve_batch_vs_shader, __spirv_vulkan_resolve_batch_vs_size,
+                              __spirv_vulkan_resolve_batch_fs_shader, __spirv_vulkan_resolve_batch_fs_size,
+                              false, false, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                              backend->pipeline_layout, target);
+    batch[3] = CreatePipeline(backend, __spirv_vulkan_fill_batch_vs_shader, __spirv_vulkan_fill_batch_vs_size,
+                              __spirv_vulkan_fill_batch_fs_shader, __spirv_vulkan_fill_batch_fs_size,
+                              true, true, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                              backend->pipeline_layout, target);
+    bool batched = batch[0] != VK_NULL_HANDLE && batch[1] != VK_NULL_HANDLE && batch[2] != VK_NULL_HANDLE && batch[3] != VK_NULL_HANDLE;
+    if (batched) {
+        VkPipeline replaced[] = { polygon_backdrop, polygon_curve, resolve, fill };
+        for (VkPipeline pipeline : replaced)
+            backend->fn.vkDestroyPipeline(backend->device, pipeline, nullptr);
+        polygon_backdrop = batch[0];
+        polygon_curve = batch[1];
+        resolve = batch[2];
+        fill = batch[3];
+    }
+    else {
+        for (VkPipeline pipeline : batch)
+            backend->fn.vkDestroyPipeline(backend->device, pipeline, nullptr);
+    }
+    VkPipeline stroke = CreatePipeline(backend, __spirv_vulkan_stroke_vs_shader, __spirv_vulkan_stroke_vs_size,
+                                       __spirv_vulkan_stroke_fs_shader, __spirv_vulkan_stroke_fs_size,
+                                       true, true, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                       backend->pipeline_layout, target);
+    VkPipeline instance_polygon = CreatePipeline(backend, __spirv_vulkan_instance_polygon_vs_shader, __spirv_vulkan_instance_polygon_vs_size,
+                                                 __spirv_vulkan_instance_polygon_fs_shader, __spirv_vulkan_instance_polygon_fs_size,
+                                                 false, false, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                                 backend->pipeline_layout, target);
+    VkPipeline instance_fill = CreatePipeline(backend, __spirv_vulkan_instance_fill_vs_shader, __spirv_vulkan_instance_fill_vs_size,
+                                              __spirv_vulkan_instance_fill_fs_shader, __spirv_vulkan_instance_fill_fs_size,
+                                              true, true, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                              backend->pipeline_layout, target);
+    VkPipeline rect = CreatePipeline(backend, __spirv_vulkan_rect_vs_shader, __spirv_vulkan_rect_vs_size,
+                                     __spirv_vulkan_rect_fs_shader, __spirv_vulkan_rect_fs_size,
+                                     true, true, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                     backend->pipeline_layout, target);
+    VkPipeline rect_opaque = CreatePipeline(backend, __spirv_vulkan_rect_vs_shader, __spirv_vulkan_rect_vs_size,
+                                            __spirv_vulkan_rect_fs_shader, __spirv_vulkan_rect_fs_size,
+                                            false, true, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                            backend->pipeline_layout, target);
+    VkPipeline convex = CreatePipeline(backend, __spirv_vulkan_convex_vs_shader, __spirv_vulkan_convex_vs_size,
+                                       __spirv_vulkan_convex_fs_shader, __spirv_vulkan_convex_fs_size,
+                                       true, true, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                       backend->pipeline_layout, target);
+    return IvgBackendVulkanPipeline{ polygon, polygon_backdrop, polygon_curve, resolve, fill, stroke, instance_polygon, instance_fill,
+                                     rect, rect_opaque, convex, batched };
+}
+
+static void DisposePipelines(IvgBackendVulkan* backend, const IvgBackendVulkanPipeline& pipelines)
+{
+    VkPipeline pipeline[] = { pipelines.polygon, pipelines.polygon_backdrop, pipelines.polygon_curve, pipelines.resolve, pipelines.fill,
+                              pipelines.stroke, pipelines.instance_polygon, pipelines.instance_fill, pipelines.rect, pipelines.rect_opaque,
+                              pipelines.convex };
+    for (VkPipeline p : pipeline)
+        DisposePipeline(backend, p);
+}
+
+static void DisposePipelines(IvgBackendVulkan* backend, const IvgBackendVulkanCompositePipeline& composite)
+{
+    DisposePipeline(backend, composite.pipeline);
+}
+
+static IvgBackendVulkanPipelineKey GetPipelineKey(const IvgBackendVulkanTarget& target)
+{
+    IVG_ASSERT((target.render_pass != VK_NULL_HANDLE || target.color_format != VK_FORMAT_UNDEFINED) && "Dynamic rendering targets need a format");
+    IvgBackendVulkanPipelineKey key;
+    key.render_pass = target.color_format == VK_FORMAT_UNDEFINED ? target.render_pass : VK_NULL_HANDLE;
+    key.color_format = target.color_format;
+    key.samples = target.samples;
+    key.dynamic = target.render_pass == VK_NULL_HANDLE;
+    return key;
+}
+
+// Disposes the least recently used entries until the map holds at most max_size of them. In flight frames may still
+// use them, so they are destroyed with the other resources.
+template <typename T>
+static void EvictPipelines(IvgBackendVulkan* backend, IvgBackendVulkanPipelineMap<T>& map, size_t max_size)
+{
+    while (map.size() > max_size) {
+        auto oldest = map.begin();
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            if (it->second.frame_stamp < oldest->second.frame_stamp)
+                oldest = it;
+        }
+        DisposePipelines(backend, oldest->second);
+        map.erase(oldest);
+    }
+}
+
+// Compiles the targets queued by RequestPipelines until the backend shuts down
+static void CompileThread(IvgBackendVulkan* backend)
+{
+    std::unique_lock<std::mutex> lock(backend->compile_mutex);
+    for (;;) {
+        backend->compile_request_cv.wait(lock, [backend] { return backend->compile_exit || !backend->compile_requests.empty(); });
+        if (backend->compile_exit)
+            return;
+        IvgBackendVulkanTarget target = backend->compile_requests.front();
+        backend->compile_requests.pop_front();
+        lock.unlock();
+        IvgBackendVulkanPipeline pipelines = CreatePipelines(backend, target);
+        lock.lock();
+        backend->compiled_pipelines.emplace(GetPipelineKey(target), pipelines);
+        backend->compile_done_cv.notify_all();
+    }
+}
+
+// Queues a target on the compile thread unless its key is already known. Must hold compile_mutex.
+static void RequestPipelines(IvgBackendVulkan* backend, const IvgBackendVulkanTarget& target)
+{
+    IvgBackendVulkanPipelineKey key = GetPipelineKey(target);
+    if (backend->pipeline_cache.count(key) != 0 || !backend->compile_pending.insert(key).second)
+        return;
+    backend->compile_requests.push_back(target);
+    backend->compile_request_cv.notify_one();
+}
+
+// Returns the pipelines of a target, or nullptr when they are compiled asynchronously and were not ready within
+// timeout_ns. Without async_pipelines they are created on the spot.
+static const IvgBackendVulkanPipeline* FindPipelines(IvgBackendVulkan* backend, const IvgBackendVulkanTarget& target, uint64_t timeout_ns)
+{
+    IvgBackendVulkanPipelineKey key = GetPipelineKey(target);
+    auto pipeline = backend->pipeline_cache.find(key);
+    if (pipeline == backend->pipeline_cache.end()) {
+        IvgBackendVulkanPipeline pipelines;
+        if (backend->async_pipelines) {
+            std::unique_lock<std::mutex> lock(backend->compile_mutex);
+            RequestPipelines(backend, target);
+            auto ready = [backend, &key] { return backend->compiled_pipelines.count(key) != 0; };
+            if (timeout_ns == UINT64_MAX)
+                backend->compile_done_cv.wait(lock, ready);
+            else if (!backend->compile_done_cv.wait_for(lock, std::chrono::nanoseconds(timeout_ns), ready))
+                return nullptr;
+
+            auto compiled = backend->compiled_pipelines.find(key);
+            pipelines = compiled->second;
+            backend->compiled_pipelines.erase(compiled);
+            backend->compile_pending.erase(key);
+        }
+        else {
+            pipelines = CreatePipelines(backend, target);
+        }
+        EvictPipelines(backend, backend->pipeline_cache, backend->max_pipeline_sets - 1);
+        pipeline = backend->pipeline_cache.emplace(key, pipelines).first;
+    }
+    pipeline->second.frame_stamp = backend->frame_count;
+    return &pipeline->second;
+}
+
+static VkPipeline GetCompositePipeline(IvgBackendVulkan* backend, const IvgBackendVulkanTarget& target)
+{
+    IvgBackendVulkanPipelineKey key = GetPipelineKey(target);
+    auto pipeline = backend->composite_pipeline_cache.find(key);
+    if (pipeline == backend->composite_pipeline_cache.end()) {
+        IvgBackendVulkanCompositePipeline composite;
+        composite.pipeline = CreatePipeline(backend, __spirv_vulkan_composite_vs_shader, __spirv_vulkan_composite_vs_size,
+                                            __spirv_vulkan_composite_fs_shader, __spirv_vulkan_composite_fs_size,
+                                            true, true, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+                                            backend->compute_pipeline_layout, target);
+        EvictPipelines(backend, backend->composite_pipeline_cache, backend->max_pipeline_sets - 1);
+        pipeline = backend->composite_pipeline_cache.emplace(key, composite).first;
+    }
+    pipeline->second.frame_stamp = backend->frame_count;
+    return pipeline->second.pipeline;
+}
+
+// Drivers are expected to reject foreign cache data themselves, the header is checked anyway as not all of them do
+static bool IsPipelineCacheCompatible(const VkPhysicalDeviceProperties& properties, const void* data, size_t size)
+{
+    const size_t header_size = 4 * sizeof(uint32_t) + VK_UUID_SIZE;
+    if (size < header_size)
+        return false;
+    uint32_t header[4];
+    std::memcpy(header, data, sizeof(header));
+    return header[0] >= header_size && header[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE && header[2] == properties.vendorID &&
+           header[3] == properties.deviceID &&
+           std::memcmp((const uint8_t*)data + sizeof(header), properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
 }
 
 bool IvgBackendVulkan_Initialize(const IvgBackendVulkanInit* init, IvgBackendVulkan** backend)
@@ -435,17 +1916,31 @@ bool IvgBackendVulkan_Initialize(const IvgBackendVulkanInit* init, IvgBackendVul
     new_backend->num_frames_in_flight = init->num_frames_in_flight;
     new_backend->min_allocation_size = init->min_allocation_size;
     new_backend->min_winding_buffer_size = init->min_winding_buffer_size + (init->min_winding_buffer_size % 4);
-
-    VkDescriptorSetLayoutBinding shader_binding[2]{
-        { 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr }, // Vertex buffer
+    new_backend->share_winding_buffer = init->share_winding_buffer;
+    new_backend->stage_vertices = init->stage_vertices;
+    new_backend->async_pipelines = init->async_pipelines;
+    new_backend->max_pipeline_sets = init->max_pipeline_sets != 0 ? init->max_pipeline_sets : 8;
+    new_backend->render_pass_format = init->render_pass_format;
+    new_backend->dynamic_rendering_local_read = init->dynamic_rendering_local_read;
+    new_backend->push_descriptors = init->push_descriptors && new_backend->fn.vkCmdPushDescriptorSetKHR != nullptr;
+
+    VkPhysicalDeviceProperties device_properties;
+    new_backend->fn.vkGetPhysicalDeviceProperties(init->physical_device, &device_properties);
+    new_backend->non_coherent_atom_size = IvgMax(device_properties.limits.nonCoherentAtomSize, (VkDeviceSize)1);
+    new_backend->compact_coverage = init->compact_coverage;
+
+    VkDescriptorSetLayoutBinding shader_binding[4]{
+        { 0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, nullptr }, // Vertex buffer
         { 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr }, // Winding/coverage buffer
+        { 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr }, // Path instance buffer
+        { 3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, nullptr }, // Batch draw buffer
     };
 
     VkDescriptorSetLayoutCreateInfo set_layout_info;
     set_layout_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     set_layout_info.pNext = {};
-    set_layout_info.flags = {};
-    set_layout_info.bindingCount = 2;
+    set_layout_info.flags = new_backend->push_descriptors ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR : 0;
+    set_layout_info.bindingCount = 4;
     set_layout_info.pBindings = shader_binding;
     if (IVG_VK_FAILED(new_backend->fn.vkCreateDescriptorSetLayout(init->device, &set_layout_info, nullptr, &new_backend->descriptor_set_layout))) {
         IVG_FREE(new_backend);
@@ -471,53 +1966,140 @@ bool IvgBackendVulkan_Initialize(const IvgBackendVulkanInit* init, IvgBackendVul
         return false;
     }
 
-    VkDescriptorPoolSize descriptor_pool_size;
-    descriptor_pool_size.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-    descriptor_pool_size.descriptorCount = 2048;
+    // Compute rasterizer, the target image is also read by the composite pass
+    VkDescriptorSetLayoutBinding compute_binding[10];
+    for (uint32_t i = 0; i < 9; i++)
+        compute_binding[i] = { i, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr };
+    compute_binding[9] = { 9, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, VK_SHADER_STAGE_COMPUTE_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, nullptr };
+    set_layout_info.flags = {};
+    set_layout_info.bindingCount = 10;
+    set_layout_info.pBindings = compute_binding;
+    if (IVG_VK_FAILED(new_backend->fn.vkCreateDescriptorSetLayout(init->device, &set_layout_info, nullptr, &new_backend->compute_descriptor_set_layout))) {
+        new_backend->fn.vkDestroyPipelineLayout(init->device, new_backend->pipeline_layout, nullptr);
+        IVG_FREE(new_backend);
+        return false;
+    }
 
-    VkDescriptorPoolCreateInfo descriptor_pool_info;
-    descriptor_pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-    descriptor_pool_info.pNext = {};
-    descriptor_pool_info.flags = {};
-    descriptor_pool_info.maxSets = 1024;
-    descriptor_pool_info.poolSizeCount = 1;
-    descriptor_pool_info.pPoolSizes = &descriptor_pool_size;
+    push_constant.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+    push_constant.size = sizeof(IvgBackendVulkanComputeArgs);
+    layout_info.pSetLayouts = &new_backend->compute_descriptor_set_layout;
+    if (IVG_VK_FAILED(new_backend->fn.vkCreatePipelineLayout(init->device, &layout_info, nullptr, &new_backend->compute_pipeline_layout))) {
+        new_backend->fn.vkDestroyPipelineLayout(init->device, new_backend->pipeline_layout, nullptr);
+        IVG_FREE(new_backend);
+        return false;
+    }
 
     for (uint32_t i = 0; i < init->num_frames_in_flight; i++) {
-        IvgBackendVulkanDescriptorStream& ds = new_backend->descriptor_stream[i];
-        if (IVG_VK_FAILED(new_backend->fn.vkCreateDescriptorPool(init->device, &descriptor_pool_info, nullptr, &ds.pool))) {
+        VkDescriptorPool pool = CreateDescriptorPool(new_backend);
+        if (pool == VK_NULL_HANDLE) {
             new_backend->fn.vkDestroyPipelineLayout(init->device, new_backend->pipeline_layout, nullptr);
             for (uint32_t j = 0; j < i; j++)
-                new_backend->fn.vkDestroyDescriptorPool(init->device, new_backend->descriptor_stream[j].pool, nullptr);
+                new_backend->fn.vkDestroyDescriptorPool(init->device, new_backend->descriptor_stream[j].pools[0], nullptr);
+            new_backend->~IvgBackendVulkan();
             IVG_FREE(new_backend);
             return false;
         }
+        new_backend->descriptor_stream[i].pools.push_back(pool);
+    }
+
+    // Seed the pipeline cache with the blob of a previous run when it was saved by the same device and driver
+    const void* cache_data = init->pipeline_cache_data;
+    size_t cache_size = init->pipeline_cache_size;
+    if (cache_data && !IsPipelineCacheCompatible(device_properties, cache_data, cache_size)) {
+        cache_data = nullptr;
+        cache_size = 0;
+    }
+    VkPipelineCacheCreateInfo cache_info;
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.pNext = {};
+    cache_info.flags = {};
+    cache_info.initialDataSize = cache_data ? cache_size : 0;
+    cache_info.pInitialData = cache_data;
+    if (IVG_VK_FAILED(new_backend->fn.vkCreatePipelineCache(init->device, &cache_info, nullptr, &new_backend->vk_pipeline_cache)))
+        new_backend->vk_pipeline_cache = VK_NULL_HANDLE;
+
+    // Compute pipelines do not depend on the render pass and are created up front
+    IvgBackendVulkanComputePipeline& compute = new_backend->compute_pipeline;
+    VkPipelineLayout layout = new_backend->compute_pipeline_layout;
+    compute.path_count = CreateComputePipeline(new_backend, __spirv_vulkan_path_count_cs_shader, __spirv_vulkan_path_count_cs_size, layout);
+    compute.path_alloc = CreateComputePipeline(new_backend, __spirv_vulkan_path_alloc_cs_shader, __spirv_vulkan_path_alloc_cs_size, layout);
+    compute.path_scatter = CreateComputePipeline(new_backend, __spirv_vulkan_path_scatter_cs_shader, __spirv_vulkan_path_scatter_cs_size, layout);
+    compute.backdrop = CreateComputePipeline(new_backend, __spirv_vulkan_backdrop_cs_shader, __spirv_vulkan_backdrop_cs_size, layout);
+    compute.bin = CreateComputePipeline(new_backend, __spirv_vulkan_bin_cs_shader, __spirv_vulkan_bin_cs_size, layout);
+    compute.coarse = CreateComputePipeline(new_backend, __spirv_vulkan_coarse_cs_shader, __spirv_vulkan_coarse_cs_size, layout);
+    compute.fine = CreateComputePipeline(new_backend, __spirv_vulkan_fine_cs_shader, __spirv_vulkan_fine_cs_size, layout);
+    VkPipeline stages[] = { compute.path_count, compute.path_alloc, compute.path_scatter, compute.backdrop, compute.bin, compute.coarse, compute.fine };
+    for (VkPipeline stage : stages) {
+        if (stage != VK_NULL_HANDLE)
+            continue;
+        // The engine is only usable with every stage
+        for (VkPipeline pipeline : stages)
+            new_backend->fn.vkDestroyPipeline(init->device, pipeline, nullptr);
+        compute = {};
+        break;
     }
 
     /*VkPipeline pipeline = IvgBackendVulkan_CreatePipeline(new_backend, __spirv_vulkan_polygon_vs, sizeof(__spirv_vulkan_polygon_vs),
                                                           __spirv_vulkan_polygon_fs, sizeof(__spirv_vulkan_polygon_fs), false, false,
                                                           new_backend->pipeline_layout, new_backend->compatible_render_pass);*/
 
+    if (new_backend->async_pipelines)
+        new_backend->compile_thread = std::thread(CompileThread, new_backend);
+
     *backend = new_backend;
     return true;
 }
 
 void IvgBackendVulkan_Shutdown(IvgBackendVulkan* backend)
 {
+    if (backend->compile_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(backend->compile_mutex);
+            backend->compile_exit = true;
+        }
+        backend->compile_request_cv.notify_one();
+        backend->compile_thread.join();
+    }
+    for (auto& [_, pipelines] : backend->pipeline_cache)
+        DisposePipelines(backend, pipelines);
+    for (auto& [_, pipelines] : backend->compiled_pipelines)
+        DisposePipelines(backend, pipelines);
+    for (auto& [_, composite] : backend->composite_pipeline_cache)
+        DisposePipelines(backend, composite);
     DestroyResource(backend, backend->num_frames_in_flight, ~0ull);
     for (uint32_t i = 0; i < backend->num_frames_in_flight; i++) {
+        backend->fn.vkDestroyBuffer(backend->device, backend->winding_buffer[i].buffer, nullptr);
+        backend->fn.vkFreeMemory(backend->device, backend->winding_buffer[i].allocation, nullptr);
         IvgBackendVulkanBuffer& vtx_buffer = backend->vtx_buffer[i];
-        IvgBackendVulkanBuffer& winding_buffer = backend->winding_buffer[i];
+        IvgBackendVulkanBuffer& instance_buffer = backend->instance_buffer[i];
         backend->fn.vkDestroyBuffer(backend->device, vtx_buffer.buffer, nullptr);
         backend->fn.vkFreeMemory(backend->device, vtx_buffer.allocation, nullptr);
-        backend->fn.vkDestroyBuffer(backend->device, winding_buffer.buffer, nullptr);
-        backend->fn.vkFreeMemory(backend->device, winding_buffer.allocation, nullptr);
-        backend->fn.vkDestroyDescriptorPool(backend->device, backend->descriptor_stream[i].pool, nullptr);
+        backend->fn.vkDestroyBuffer(backend->device, instance_buffer.buffer, nullptr);
+        backend->fn.vkFreeMemory(backend->device, instance_buffer.allocation, nullptr);
+        backend->fn.vkDestroyBuffer(backend->device, backend->batch_buffer[i].buffer, nullptr);
+        backend->fn.vkFreeMemory(backend->device, backend->batch_buffer[i].allocation, nullptr);
+        backend->fn.vkDestroyBuffer(backend->device, backend->staged_vtx_buffer[i].buffer, nullptr);
+        backend->fn.vkFreeMemory(backend->device, backend->staged_vtx_buffer[i].allocation, nullptr);
+        backend->fn.vkDestroyBuffer(backend->device, backend->compute_draw_buffer[i].buffer, nullptr);
+        backend->fn.vkFreeMemory(backend->device, backend->compute_draw_buffer[i].allocation, nullptr);
+        backend->fn.vkDestroyBuffer(backend->device, backend->compute_scratch_buffer[i].buffer, nullptr);
+        backend->fn.vkFreeMemory(backend->device, backend->compute_scratch_buffer[i].allocation, nullptr);
+        backend->fn.vkDestroyImageView(backend->device, backend->compute_image[i].view, nullptr);
+        backend->fn.vkDestroyImage(backend->device, backend->compute_image[i].image, nullptr);
+        backend->fn.vkFreeMemory(backend->device, backend->compute_image[i].allocation, nullptr);
+        for (VkDescriptorPool pool : backend->descriptor_stream[i].pools)
+            backend->fn.vkDestroyDescriptorPool(backend->device, pool, nullptr);
     }
-    for (auto [_, pipelines] : backend->pipeline_cache) {
-        backend->fn.vkDestroyPipeline(backend->device, pipelines.polygon, nullptr);
-        backend->fn.vkDestroyPipeline(backend->device, pipelines.fill, nullptr);
+    for (auto& [_, buffer] : backend->draw_list_buffers) {
+        backend->fn.vkDestroyBuffer(backend->device, buffer.buffer, nullptr);
+        backend->fn.vkFreeMemory(backend->device, buffer.allocation, nullptr);
     }
+    const IvgBackendVulkanComputePipeline& compute = backend->compute_pipeline;
+    for (VkPipeline pipeline : { compute.path_count, compute.path_alloc, compute.path_scatter, compute.backdrop, compute.bin, compute.coarse, compute.fine })
+        backend->fn.vkDestroyPipeline(backend->device, pipeline, nullptr);
+    if (backend->vk_pipeline_cache) backend->fn.vkDestroyPipelineCache(backend->device, backend->vk_pipeline_cache, nullptr);
+    if (backend->compute_pipeline_layout) backend->fn.vkDestroyPipelineLayout(backend->device, backend->compute_pipeline_layout, nullptr);
+    if (backend->compute_descriptor_set_layout) backend->fn.vkDestroyDescriptorSetLayout(backend->device, backend->compute_descriptor_set_layout, nullptr);
     if (backend->pipeline_layout) backend->fn.vkDestroyPipelineLayout(backend->device, backend->pipeline_layout, nullptr);
     if (backend->descriptor_set_layout) backend->fn.vkDestroyDescriptorSetLayout(backend->device, backend->descriptor_set_layout, nullptr);
     backend->~IvgBackendVulkan();
@@ -530,34 +2112,175 @@ void IvgBackendVulkan_BeginFrame(IvgBackendVulkan* backend)
     IvgBackendVulkanDescriptorStream& ds = backend->descriptor_stream[backend->frame_id];
     DestroyResource(backend, backend->num_frames_in_flight, backend->frame_count);
     buffer.offset = 0;
-    backend->winding_offset = 0;
-    backend->fn.vkResetDescriptorPool(backend->device, ds.pool, 0);
+    backend->instance_buffer[backend->frame_id].offset = 0;
+    backend->batch_buffer[backend->frame_id].offset = 0;
+    backend->staged_vtx_buffer[backend->frame_id].offset = 0;
+    if (!backend->share_winding_buffer)
+        backend->winding_offset = 0;
+    backend->uploads.resize(0);
+    backend->stats = IvgBackendVulkanStats{};
+    for (VkDescriptorPool pool : ds.pools)
+        backend->fn.vkResetDescriptorPool(backend->device, pool, 0);
+    ds.current_pool = 0;
+}
+
+// Appends the vertices of a context to the vertex buffer of the frame and returns where they start in vtx_buffer.
+// Contexts uploaded with IvgBackendVulkan_UploadContext this frame are not uploaded again.
+static uint32_t UploadContextVertices(IvgBackendVulkan* backend, const IvgContext* ctx, VkBuffer& vtx_buffer_out)
+{
+    for (const IvgBackendVulkanUpload& upload : backend->uploads) {
+        if (upload.ctx == ctx) {
+            vtx_buffer_out = upload.vtx_buffer;
+            return upload.vtx_base;
+        }
+    }
+
+    IvgBackendVulkanBuffer& vtx_buffer = backend->vtx_buffer[backend->frame_id];
+    uint32_t vtx_count = ctx->vtx_offset_;
+    uint32_t vtx_base = vtx_buffer.offset;
+    ReserveUploadBuffer(backend, vtx_buffer, vtx_base + vtx_count, sizeof(IvgV2),
+                        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT, backend->vtx_high_water);
+    std::memcpy((IvgV2*)vtx_buffer.mapped_ptr + vtx_base, ctx->vtx_buf_, vtx_count * sizeof(IvgV2));
+    FlushBufferRange(backend, vtx_buffer, (VkDeviceSize)vtx_base * sizeof(IvgV2), (VkDeviceSize)vtx_count * sizeof(IvgV2));
+    vtx_buffer.offset = vtx_base + vtx_count;
+    vtx_buffer_out = vtx_buffer.buffer;
+    return vtx_base;
+}
+
+void IvgBackendVulkan_UploadContext(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, const IvgContext* ctx)
+{
+    IvgBackendVulkanUpload upload;
+    upload.ctx = ctx;
+    upload.vtx_base = UploadContextVertices(backend, ctx, upload.vtx_buffer);
+    IvgBackendVulkanBuffer& vtx_buffer = backend->vtx_buffer[backend->frame_id];
+    uint32_t vtx_count = ctx->vtx_offset_;
+    if (upload.vtx_buffer != vtx_buffer.buffer || !backend->stage_vertices || vtx_count == 0 ||
+        (vtx_buffer.memory_flags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)) {
+        if (upload.vtx_buffer == vtx_buffer.buffer)
+            backend->uploads.push_back(upload);
+        return;
+    }
+
+    // Copy the vertices just written to the device local buffer of the frame
+    IvgBackendVulkanBuffer& staged_buffer = backend->staged_vtx_buffer[backend->frame_id];
+    uint32_t staged_base = staged_buffer.offset;
+    if (staged_buffer.buffer == VK_NULL_HANDLE || staged_base + vtx_count > staged_buffer.count) {
+        uint32_t new_count = IvgMax(IvgMax(staged_base + vtx_count, backend->vtx_high_water), staged_buffer.count * 2);
+        CreateOrResizeBuffer(backend, staged_buffer, (VkDeviceSize)new_count * sizeof(IvgV2),
+                             VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        staged_buffer.count = (uint32_t)(staged_buffer.size / sizeof(IvgV2));
+    }
+
+    IvgBackendVulkanFn& fn = backend->fn;
+    VkBufferCopy region;
+    region.srcOffset = (VkDeviceSize)upload.vtx_base * sizeof(IvgV2);
+    region.dstOffset = (VkDeviceSize)staged_base * sizeof(IvgV2);
+    region.size = (VkDeviceSize)vtx_count * sizeof(IvgV2);
+    fn.vkCmdCopyBuffer(vk_cmd_buf, vtx_buffer.buffer, staged_buffer.buffer, 1, &region);
+
+    VkMemoryBarrier barrier;
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.pNext = nullptr;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    fn.vkCmdPipelineBarrier(vk_cmd_buf, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                            VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                            0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    staged_buffer.offset = staged_base + vtx_count;
+    upload.vtx_buffer = staged_buffer.buffer;
+    upload.vtx_base = staged_base;
+    backend->uploads.push_back(upload);
+}
+
+// Render passes passed without a target are single sampled, keyed by IvgBackendVulkanInit::render_pass_format or by
+// handle without it
+static IvgBackendVulkanTarget GetRenderPassTarget(const IvgBackendVulkan* backend, VkRenderPass render_pass)
+{
+    return IvgBackendVulkanTarget{ render_pass, backend->render_pass_format, VK_SAMPLE_COUNT_1_BIT, nullptr };
+}
+
+bool IvgBackendVulkan_PrewarmPipelines(IvgBackendVulkan* backend, const IvgBackendVulkanTarget& target)
+{
+    if (backend->compute_pipeline.fine != VK_NULL_HANDLE)
+        GetCompositePipeline(backend, target);
+    if (backend->async_pipelines) {
+        std::lock_guard<std::mutex> lock(backend->compile_mutex);
+        RequestPipelines(backend, target);
+        return true;
+    }
+    return FindPipelines(backend, target, UINT64_MAX)->polygon != VK_NULL_HANDLE;
+}
+
+bool IvgBackendVulkan_PrewarmPipelines(IvgBackendVulkan* backend, VkRenderPass render_pass)
+{
+    return IvgBackendVulkan_PrewarmPipelines(backend, GetRenderPassTarget(backend, render_pass));
+}
+
+void IvgBackendVulkan_SetPipelineTimeout(IvgBackendVulkan* backend, uint64_t timeout_ns)
+{
+    backend->pipeline_timeout_ns = timeout_ns;
+}
+
+bool IvgBackendVulkan_GetPipelineCacheData(const IvgBackendVulkan* backend, IvgVector<uint8_t>* data)
+{
+    data->resize(0);
+    if (backend->vk_pipeline_cache == VK_NULL_HANDLE)
+        return false;
+    size_t size = 0;
+    if (IVG_VK_FAILED(backend->fn.vkGetPipelineCacheData(backend->device, backend->vk_pipeline_cache, &size, nullptr)))
+        return false;
+    data->resize((int)size);
+    if (IVG_VK_FAILED(backend->fn.vkGetPipelineCacheData(backend->device, backend->vk_pipeline_cache, &size, data->Data))) {
+        data->resize(0);
+        return false;
+    }
+    data->resize((int)size);
+    return true;
 }
 
 bool IvgBackendVulkan_SubmitCommand(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, VkRenderPass render_pass, const VkExtent2D& fb_size, IvgContext* ctx)
+{
+    return IvgBackendVulkan_SubmitCommand(backend, vk_cmd_buf, GetRenderPassTarget(backend, render_pass), fb_size, ctx);
+}
+
+bool IvgBackendVulkan_SubmitCommand(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, const IvgBackendVulkanTarget& target, const VkExtent2D& fb_size,
+                                    IvgContext* ctx)
 {
     IvgBackendVulkanFn& fn = backend->fn;
-    IvgBackendVulkanBuffer& vtx_buffer = backend->vtx_buffer[backend->frame_id];
-    uint32_t required_vtx_count = ctx->vtx_offset_;
-    uint32_t new_vtx_count = vtx_buffer.offset + required_vtx_count;
-    bool buffer_resized = false;
-    if (vtx_buffer.buffer == VK_NULL_HANDLE || new_vtx_count > vtx_buffer.count) {
-        CreateOrResizeBuffer(backend, vtx_buffer, new_vtx_count * sizeof(IvgV2), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
-        IVG_VK_CHECK(fn.vkMapMemory(backend->device, vtx_buffer.allocation, 0, VK_WHOLE_SIZE, 0, &vtx_buffer.mapped_ptr));
-        vtx_buffer.count = new_vtx_count;
-        buffer_resized = true;
+    // Dynamic rendering scopes are ended around the coverage barriers, unless barriers may be recorded within them
+    const VkRenderingInfo* resume_rendering = nullptr;
+    if (target.render_pass == VK_NULL_HANDLE && !backend->dynamic_rendering_local_read) {
+        resume_rendering = GetResumeRendering(backend, target.rendering_info);
+        if (!resume_rendering)
+            return false;
     }
 
-    IvgV2* vtx_dst = (IvgV2*)vtx_buffer.mapped_ptr + vtx_buffer.offset;
-    std::memcpy(vtx_dst, ctx->vtx_buf_, required_vtx_count * sizeof(IvgV2));
+    const IvgBackendVulkanPipeline* pipeline = FindPipelines(backend, target, backend->pipeline_timeout_ns);
+    if (!pipeline) {
+        backend->stats.num_skipped_submits++;
+        return false;
+    }
 
-    VkMappedMemoryRange range{};
-    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-    range.pNext = {};
-    range.memory = vtx_buffer.allocation;
-    range.offset = 0;
-    range.size = VK_WHOLE_SIZE;
-    fn.vkFlushMappedMemoryRanges(backend->device, 1, &range);
+    VkBuffer vtx_buffer;
+    uint32_t vtx_base = UploadContextVertices(backend, ctx, vtx_buffer);
+
+    // The instance buffer is always bound, create it even when there are no instances to upload
+    IvgBackendVulkanBuffer& instance_buffer = backend->instance_buffer[backend->frame_id];
+    uint32_t required_instance_count = (uint32_t)ctx->instances_.Size;
+    uint32_t instance_base = instance_buffer.offset;
+    uint32_t new_instance_count = instance_base + required_instance_count;
+    ReserveUploadBuffer(backend, instance_buffer, new_instance_count, sizeof(IvgPathInstance), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                        backend->instance_high_water);
+    if (required_instance_count != 0) {
+        std::memcpy((IvgPathInstance*)instance_buffer.mapped_ptr + instance_base, ctx->instances_.Data, ctx->instances_.size_in_bytes());
+        FlushBufferRange(backend, instance_buffer, (VkDeviceSize)instance_base * sizeof(IvgPathInstance), ctx->instances_.size_in_bytes());
+    }
+
+    // The batch buffer is always bound as well
+    IvgBackendVulkanBuffer& batch_buffer = backend->batch_buffer[backend->frame_id];
+    ReserveUploadBuffer(backend, batch_buffer, batch_buffer.offset, sizeof(IvgBackendVulkanBatchDraw), VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                        backend->batch_high_water);
 
     VkViewport vp;
     vp.x = 0;
@@ -568,161 +2291,436 @@ bool IvgBackendVulkan_SubmitCommand(IvgBackendVulkan* backend, VkCommandBuffer v
     vp.maxDepth = 1.0f;
     fn.vkCmdSetViewport(vk_cmd_buf, 0, 1, &vp);
 
-    IvgBackendVulkanBuffer& winding_buffer = backend->winding_buffer[backend->frame_id];
-    IvgBackendVulkanDescriptorStream& ds = backend->descriptor_stream[backend->frame_id];
+    IvgBackendVulkanSubmitState state{};
+    state.cmd_buf = vk_cmd_buf;
+    state.polygon = pipeline->polygon;
+    state.polygon_backdrop = pipeline->polygon_backdrop;
+    state.polygon_curve = pipeline->polygon_curve;
+    state.resolve = pipeline->resolve;
+    state.fill = pipeline->fill;
+    state.stroke = pipeline->stroke;
+    state.instance_polygon = pipeline->instance_polygon;
+    state.instance_fill = pipeline->instance_fill;
+    state.rect = pipeline->rect;
+    state.rect_opaque = pipeline->rect_opaque;
+    state.convex = pipeline->convex;
+    state.instance_buffer = instance_buffer.buffer;
+    state.instance_base = instance_base;
+    state.batched = pipeline->batched;
+    state.resume_rendering = resume_rendering;
+    state.winding_base = backend->winding_offset;
+    state.winding_offset = backend->winding_offset;
+    state.winding_end = backend->winding_offset;
+    state.fb_scissor.offset = { 0, 0 };
+    state.fb_scissor.extent = fb_size;
+    state.scissor = state.fb_scissor;
+    state.draw_args.inv_viewport.x = 2.0f / vp.width;
+    state.draw_args.inv_viewport.y = 2.0f / vp.height;
+
+    IvgBackendVulkanStream stream;
+    stream.vtx_buffer = vtx_buffer;
+    stream.vtx_base = vtx_base;
+    stream.cmd_begin = ctx->cmd_buf_;
+    stream.cmd_end = ctx->cmd_buf_ + ctx->cmd_offset_;
+    stream.replay = nullptr;
+    stream.translation = IvgV2();
+    SubmitCommandStream(backend, state, ctx, stream);
+
+    instance_buffer.offset = new_instance_count;
+    backend->winding_offset = state.winding_end;
+    return true;
+}
 
-    if (vtx_buffer.buffer && winding_buffer.buffer)
-        PushResourceDescriptors(backend, vk_cmd_buf, vtx_buffer.buffer, winding_buffer.buffer);
+// Records a compute dispatch over count items, split over y when it exceeds the workgroup count limit
+static void DispatchLinear(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, VkPipeline pipeline, IvgBackendVulkanComputeArgs& args,
+                           uint32_t count)
+{
+    if (count == 0)
+        return;
+    IvgBackendVulkanFn& fn = backend->fn;
+    uint32_t num_groups = (count + COMPUTE_WORKGROUP_SIZE - 1) / COMPUTE_WORKGROUP_SIZE;
+    args.dispatch_width = IvgMin(num_groups, 65535u);
+    fn.vkCmdBindPipeline(vk_cmd_buf, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+    fn.vkCmdPushConstants(vk_cmd_buf, backend->compute_pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                          sizeof(IvgBackendVulkanComputeArgs), &args);
+    fn.vkCmdDispatch(vk_cmd_buf, args.dispatch_width, (num_groups + args.dispatch_width - 1) / args.dispatch_width, 1);
+}
 
-    uint32_t current_winding_offset = backend->winding_offset;
-    IvgCmdBufPtr ctx_cmd_buf{ ctx->cmd_buf_ };
-    IvgByte* ctx_cmd_buf_end = ctx->cmd_buf_ + ctx->cmd_offset_;
-    uint32_t cmd_buf_size = ctx->cmd_offset_;
-    uint32_t current_command_header;
-    IvgBackendVulkanDrawArgs draw_args;
-    draw_args.inv_viewport.x = 2.0f / vp.width;
-    draw_args.inv_viewport.y = 2.0f / vp.height;
+static void Dispatch2D(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, VkPipeline pipeline, const IvgBackendVulkanComputeArgs& args,
+                       uint32_t x, uint32_t y)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    fn.vkCmdBindPipeline(vk_cmd_buf, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+    fn.vkCmdPushConstants(vk_cmd_buf, backend->compute_pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                          sizeof(IvgBackendVulkanComputeArgs), &args);
+    fn.vkCmdDispatch(vk_cmd_buf, x, y, 1);
+}
 
-    // Find pipeline for this render pass in the cache
-    auto pipeline = backend->pipeline_cache.find(render_pass);
-    if (pipeline == backend->pipeline_cache.end()) {
-        VkPipeline polygon = CreatePipeline(backend, __spirv_vulkan_polygon_vs_shader, __spirv_vulkan_polygon_vs_size,
-                                            __spirv_vulkan_polygon_fs_shader, __spirv_vulkan_polygon_fs_size,
-                                            false, false, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
-                                            backend->pipeline_layout, render_pass);
-        VkPipeline fill = CreatePipeline(backend, __spirv_vulkan_fill_vs_shader, __spirv_vulkan_fill_vs_size,
-                                         __spirv_vulkan_fill_fs_shader, __spirv_vulkan_fill_fs_size,
-                                         true, true, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
-                                         backend->pipeline_layout, render_pass);
-        pipeline = backend->pipeline_cache.emplace(render_pass, IvgBackendVulkanPipeline{ polygon, fill }).first;
-    }
-
-    auto [polygon, fill] = pipeline->second;
-    while (ctx_cmd_buf.cmd_bytes != ctx_cmd_buf_end) {
-        const IvgBackendCommand* command = ctx_cmd_buf.cmd_data;
+static void ComputeBarrier(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, VkPipelineStageFlags src_stage)
+{
+    VkMemoryBarrier barrier;
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.pNext = nullptr;
+    barrier.srcAccessMask = src_stage == VK_PIPELINE_STAGE_TRANSFER_BIT ? VK_ACCESS_TRANSFER_WRITE_BIT : VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    backend->fn.vkCmdPipelineBarrier(vk_cmd_buf, src_stage, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+// Whether every command of a context can be rasterized by the compute pipelines
+static bool IsComputeSupported(const IvgContext* ctx)
+{
+    IvgCmdBufPtr cmd_ptr{ ctx->cmd_buf_ };
+    IvgByte* cmd_end = ctx->cmd_buf_ + ctx->cmd_offset_;
+    while (cmd_ptr.cmd_bytes != cmd_end) {
+        switch (cmd_ptr.cmd_data->header) {
+            case IvgCommandHeader_SetDrawState:
+                // The fine shader blends a single color per draw
+                if (cmd_ptr.cmd_data->set_draw_state.paint_type != IvgPaintType_Solid)
+                    return false;
+                cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+                continue;
+            case IvgCommandHeader_SetClipRect:
+                cmd_ptr.cmd_bytes += sizeof(IvgSetClipRectCmd);
+                continue;
+            case IvgCommandHeader_Draw:
+            case IvgCommandHeader_DrawRect:
+            case IvgCommandHeader_DrawConvex:
+                cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+                continue;
+            default:
+                // Curves, strokes, instanced draws and draw lists
+                return false;
+        }
+    }
+    return true;
+}
+
+bool IvgBackendVulkan_RenderCompute(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, const VkExtent2D& fb_size, IvgContext* ctx)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    const IvgBackendVulkanComputePipeline& pipelines = backend->compute_pipeline;
+    IVG_ASSERT(backend->compute_frame_stamp != backend->frame_count && "The compute rasterizer can only run once per frame");
+    backend->compute_frame_stamp = backend->frame_count;
+    backend->compute_fallback_ctx = nullptr;
+    if (fb_size.width == 0 || fb_size.height == 0)
+        return false;
+
+    // Without the compute pipelines, or with commands they cannot rasterize, the whole context is submitted to the
+    // raster pipelines by IvgBackendVulkan_CompositeCompute instead, which keeps the painter's order
+    if (pipelines.fine == VK_NULL_HANDLE || !IsComputeSupported(ctx)) {
+        backend->compute_fallback_ctx = ctx;
+        return false;
+    }
+
+    VkBuffer vtx_buffer;
+    uint32_t vtx_base = UploadContextVertices(backend, ctx, vtx_buffer);
+
+    // Build the draw records and size every list of the frame. Regions are clipped to the framebuffer, path tiles
+    // cover the region plus one row for the segments below it.
+    const int32_t tile_size = COMPUTE_TILE_SIZE;
+    IvgBackendVulkanComputeArgs args{};
+    args.fb_size[0] = fb_size.width;
+    args.fb_size[1] = fb_size.height;
+    args.tiles[0] = (fb_size.width + tile_size - 1) / tile_size;
+    args.tiles[1] = (fb_size.height + tile_size - 1) / tile_size;
+    args.bins[0] = (args.tiles[0] + COMPUTE_BIN_TILES - 1) / COMPUTE_BIN_TILES;
+    args.bins[1] = (args.tiles[1] + COMPUTE_BIN_TILES - 1) / COMPUTE_BIN_TILES;
+    uint32_t bin_capacity = 0;
+    uint32_t cmd_capacity = 0;
+    uint32_t color = 0;
+    uint32_t fill_mode = IvgFillMode_NonZero;
+    IvgVector<IvgBackendVulkanComputeDraw>& draws = backend->compute_draws;
+    draws.resize(0);
+
+    IvgCmdBufPtr cmd_ptr{ ctx->cmd_buf_ };
+    IvgByte* cmd_end = ctx->cmd_buf_ + ctx->cmd_offset_;
+    while (cmd_ptr.cmd_bytes != cmd_end) {
+        const IvgBackendCommand* command = cmd_ptr.cmd_data;
         switch (command->header) {
             case IvgCommandHeader_SetDrawState:
-            {
-                draw_args.fill_mode = command->set_draw_state.fill_mode;
-                draw_args.paint_type = command->set_draw_state.paint_type;
-                draw_args.color = command->set_draw_state.color[0];
-                ctx_cmd_buf.cmd_bytes += sizeof(IvgSetDrawStateCmd);
-                break;
-            }
+                fill_mode = command->set_draw_state.fill_mode;
+                color = command->set_draw_state.color[0];
+                cmd_ptr.cmd_bytes += sizeof(IvgSetDrawStateCmd);
+                continue;
             case IvgCommandHeader_SetClipRect:
-            {
-                VkRect2D rect;
-                rect.offset = { command->set_clip_rect.x, command->set_clip_rect.y };
-                rect.extent = { command->set_clip_rect.w, command->set_clip_rect.h };
-                fn.vkCmdSetScissor(vk_cmd_buf, 0, 1, &rect);
-                ctx_cmd_buf.cmd_bytes += sizeof(IvgSetClipRectCmd);
-                break;
-            }
+                // Draw regions are already clipped
+                cmd_ptr.cmd_bytes += sizeof(IvgSetClipRectCmd);
+                continue;
             case IvgCommandHeader_Draw:
-            {
-                uint32_t tmp_winding_offset = current_winding_offset;
-                IvgCmdBufPtr draw_cmd_ptr{ ctx_cmd_buf };
-                bool draw_skipped = false;
-
-                // 1. draw to pixel coverage
-                fn.vkCmdBindPipeline(vk_cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, polygon);
-                while (ctx_cmd_buf.cmd_bytes != ctx_cmd_buf_end) {
-                    const IvgBackendCommand* command = draw_cmd_ptr.cmd_data;
-                    if (command->header != IvgCommandHeader_Draw)
-                        break;
-
-                    // Check buffer size first!
-                    uint32_t width = command->draw.w;
-                    uint32_t height = command->draw.h;
-                    uint32_t size = width * height;
-                    uint32_t next_offset = current_winding_offset + size;
-                    if (winding_buffer.buffer != VK_NULL_HANDLE && next_offset > winding_buffer.count) {
-                        draw_skipped = true;
-                        break;
-                    }
-                    else if (size > winding_buffer.count) {
-                        VkDeviceSize required_size = IvgMax(backend->min_winding_buffer_size, size * sizeof(int32_t));
-                        CreateOrResizeBuffer(backend, winding_buffer, required_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
-                                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-                        winding_buffer.count = required_size / sizeof(int32_t);
-                        buffer_resized = true;
-                    }
-
-                    if (buffer_resized) {
-                        PushResourceDescriptors(backend, vk_cmd_buf, vtx_buffer.buffer, winding_buffer.buffer);
-                        buffer_resized = false;
-                    }
-
-                    draw_args.min_bb = command->draw.rect.min;
-                    draw_args.max_bb = command->draw.rect.max;
-                    draw_args.vtx_offset = command->draw.vtx_offset;
-                    draw_args.winding_stride = width;
-                    draw_args.winding_offset = current_winding_offset;
-
-                    fn.vkCmdPushConstants(vk_cmd_buf, backend->pipeline_layout,
-                                          VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-                                          0, sizeof(IvgBackendVulkanDrawArgs), &draw_args);
-                    fn.vkCmdDraw(vk_cmd_buf, command->draw.vtx_count * 6, 1, 0, 0);
-
-                    current_winding_offset = next_offset;
-                    draw_cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
-                }
-
-                VkMemoryBarrier barrier;
-                barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-                barrier.pNext = nullptr;
-                barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
-                barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
-                fn.vkCmdPipelineBarrier(vk_cmd_buf, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                                        VK_DEPENDENCY_BY_REGION_BIT, 1, &barrier, 0, nullptr, 0, nullptr);
-
-                // 2. fill covered pixel
-                draw_cmd_ptr = ctx_cmd_buf;
-                current_winding_offset = tmp_winding_offset;
-                fn.vkCmdBindPipeline(vk_cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, fill);
-                while (ctx_cmd_buf.cmd_bytes != ctx_cmd_buf_end) {
-                    const IvgBackendCommand* command = draw_cmd_ptr.cmd_data;
-                    if (command->header != IvgCommandHeader_Draw)
-                        break;
-
-                    uint32_t width = command->draw.w;
-                    uint32_t height = command->draw.h;
-                    uint32_t size = width * height;
-                    uint32_t next_offset = current_winding_offset + size;
-                    if (winding_buffer.buffer != VK_NULL_HANDLE && next_offset > winding_buffer.count) {
-                        break;
-                    }
-
-                    draw_args.min_bb = command->draw.rect.min;
-                    draw_args.max_bb = command->draw.rect.max;
-                    draw_args.vtx_offset = command->draw.vtx_offset;
-                    draw_args.winding_stride = width;
-                    draw_args.winding_offset = current_winding_offset;
-
-                    fn.vkCmdPushConstants(vk_cmd_buf, backend->pipeline_layout,
-                                          VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-                                          0, sizeof(IvgBackendVulkanDrawArgs), &draw_args);
-                    fn.vkCmdDraw(vk_cmd_buf, 6, 1, 0, 0);
-
-                    current_winding_offset = next_offset;
-                    draw_cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
-                }
-
-                fn.vkCmdPipelineBarrier(vk_cmd_buf, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-                                        VK_DEPENDENCY_BY_REGION_BIT, 1, &barrier, 0, nullptr, 0, nullptr);
-
-                if (draw_skipped)
-                    current_winding_offset = 0;
-
-                ctx_cmd_buf = draw_cmd_ptr;
+            case IvgCommandHeader_DrawRect:
+            case IvgCommandHeader_DrawConvex:
                 break;
-            }
+            default:
+                // Rejected by IsComputeSupported
+                return false;
+        }
+
+        const IvgDrawCmd& draw = command->draw;
+        cmd_ptr.cmd_bytes += sizeof(IvgDrawCmd);
+        IvgRect rect;
+        uint32_t width;
+        uint32_t height;
+        if (draw.vtx_count == 0 || !GetDrawRegion(draw, nullptr, rect, width, height))
+            continue;
+        int32_t min_x = IvgMax((int32_t)rect.min.x, 0);
+        int32_t min_y = IvgMax((int32_t)rect.min.y, 0);
+        int32_t max_x = IvgMin((int32_t)std::ceil(rect.max.x), (int32_t)fb_size.width);
+        int32_t max_y = IvgMin((int32_t)std::ceil(rect.max.y), (int32_t)fb_size.height);
+        if (max_x <= min_x || max_y <= min_y)
+            continue;
+
+        draws.push_back(IvgBackendVulkanComputeDraw{});
+        IvgBackendVulkanComputeDraw& d = draws.back();
+        int32_t tile_x = min_x / tile_size;
+        int32_t tile_y = min_y / tile_size;
+        int32_t tile_w = (max_x + tile_size - 1) / tile_size - tile_x;
+        int32_t tile_rows = (max_y + tile_size - 1) / tile_size - tile_y;
+        d.clip[0] = min_x;
+        d.clip[1] = min_y;
+        d.clip[2] = max_x;
+        d.clip[3] = max_y;
+        d.tile_rect[0] = (uint32_t)tile_x;
+        d.tile_rect[1] = (uint32_t)tile_y;
+        d.tile_rect[2] = (uint32_t)tile_w;
+        d.tile_rect[3] = (uint32_t)tile_rows + 1;
+        d.path_tile_offset = args.num_path_tiles;
+        d.segment_base = args.num_segments;
+        d.vtx_offset = vtx_base + draw.vtx_offset;
+        d.color = color;
+        d.fill_mode = fill_mode;
+        d.column_base = args.num_columns;
+        args.num_path_tiles += (uint32_t)(tile_w * (tile_rows + 1));
+        args.num_segments += draw.vtx_count;
+        args.num_columns += (uint32_t)(tile_w * tile_size);
+        bin_capacity += (uint32_t)(((tile_x + tile_w - 1) / COMPUTE_BIN_TILES - tile_x / COMPUTE_BIN_TILES + 1) *
+                                   ((tile_y + tile_rows - 1) / COMPUTE_BIN_TILES - tile_y / COMPUTE_BIN_TILES + 1));
+        cmd_capacity += (uint32_t)(tile_w * tile_rows);
+
+        // A piece of a segment per tile row touches the tile columns of its x range, consecutive pieces share a
+        // column, so a segment lands in at most rows + columns path tiles
+        const IvgV2* vtx = ctx->vtx_buf_ + draw.vtx_offset;
+        float inv_tile_size = 1.0f / (float)tile_size;
+        for (uint32_t i = 0; i < draw.vtx_count; i++) {
+            IvgV2 p0 = vtx[i];
+            IvgV2 p1 = vtx[i + 1];
+            int32_t rows = IvgMin((int32_t)std::floor(IvgMax(p0.y, p1.y) * inv_tile_size), tile_y + tile_rows - 1) -
+                           IvgMax((int32_t)std::floor(IvgMin(p0.y, p1.y) * inv_tile_size), tile_y) + 1;
+            int32_t columns = IvgMin((int32_t)std::floor(IvgMax(p0.x, p1.x) * inv_tile_size), tile_x + tile_w - 1) -
+                              IvgMax((int32_t)std::floor(IvgMin(p0.x, p1.x) * inv_tile_size), tile_x) + 1;
+            if (rows > 0 && columns > 0)
+                args.segment_capacity += (uint32_t)(rows + columns);
         }
     }
+    args.num_draws = (uint32_t)draws.Size;
+
+    // Draw records
+    IvgBackendVulkanBuffer& draw_buffer = backend->compute_draw_buffer[backend->frame_id];
+    VkDeviceSize draw_size = IvgMax((VkDeviceSize)draws.size_in_bytes(), (VkDeviceSize)sizeof(IvgBackendVulkanComputeDraw));
+    if (draw_buffer.buffer == VK_NULL_HANDLE || draw_size > draw_buffer.size) {
+        CreateOrResizeBuffer(backend, draw_buffer, draw_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        IVG_VK_CHECK(fn.vkMapMemory(backend->device, draw_buffer.allocation, 0, VK_WHOLE_SIZE, 0, &draw_buffer.mapped_ptr));
+    }
+    if (draws.Size != 0) {
+        std::memcpy(draw_buffer.mapped_ptr, draws.Data, draws.size_in_bytes());
+        FlushBufferRange(backend, draw_buffer, 0, draws.size_in_bytes());
+    }
+
+    // Scratch lists, bindings 2 to 8. The counters and path tiles come first so one fill clears them.
+    uint32_t num_bins = args.bins[0] * args.bins[1];
+    uint32_t num_tiles = args.tiles[0] * args.tiles[1];
+    VkDeviceSize list_size[7] = {
+        3 * sizeof(uint32_t),
+        (VkDeviceSize)args.num_path_tiles * COMPUTE_PATH_TILE_SIZE,
+        (VkDeviceSize)args.segment_capacity * sizeof(uint32_t),
+        (VkDeviceSize)num_bins * 2 * sizeof(uint32_t),
+        (VkDeviceSize)bin_capacity * sizeof(uint32_t),
+        (VkDeviceSize)num_tiles * 2 * sizeof(uint32_t),
+        (VkDeviceSize)cmd_capacity * sizeof(uint32_t),
+    };
+    VkDeviceSize list_offset[7];
+    VkDeviceSize scratch_size = 0;
+    for (uint32_t i = 0; i < 7; i++) {
+        // 256 is the largest minStorageBufferOffsetAlignment allowed
+        list_offset[i] = scratch_size;
+        list_size[i] = IvgMax(list_size[i], (VkDeviceSize)16);
+        scratch_size = AlignBufferSize(scratch_size + list_size[i], 256);
+    }
+    IvgBackendVulkanBuffer& scratch_buffer = backend->compute_scratch_buffer[backend->frame_id];
+    if (scratch_buffer.buffer == VK_NULL_HANDLE || scratch_size > scratch_buffer.size)
+        CreateOrResizeBuffer(backend, scratch_buffer, scratch_size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                             VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    IvgBackendVulkanImage& image = backend->compute_image[backend->frame_id];
+    if (image.image == VK_NULL_HANDLE || image.extent.width < fb_size.width || image.extent.height < fb_size.height)
+        CreateOrResizeStorageImage(backend, image, { IvgMax(fb_size.width, image.extent.width), IvgMax(fb_size.height, image.extent.height) });
+
+    // Descriptors, also used by IvgBackendVulkan_CompositeCompute
+    VkDescriptorSet descriptor_set = AllocateDescriptorSet(backend, backend->compute_descriptor_set_layout);
+    backend->compute_descriptor_set[backend->frame_id] = descriptor_set;
+
+    VkDescriptorBufferInfo buffer_descriptor[9];
+    buffer_descriptor[0] = { vtx_buffer, 0, VK_WHOLE_SIZE };
+    buffer_descriptor[1] = { draw_buffer.buffer, 0, VK_WHOLE_SIZE };
+    for (uint32_t i = 0; i < 7; i++)
+        buffer_descriptor[i + 2] = { scratch_buffer.buffer, list_offset[i], list_size[i] };
+    VkDescriptorImageInfo image_descriptor{};
+    image_descriptor.imageView = image.view;
+    image_descriptor.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+
+    VkWriteDescriptorSet write[10]{};
+    for (uint32_t i = 0; i < 10; i++) {
+        write[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write[i].dstSet = descriptor_set;
+        write[i].dstBinding = i;
+        write[i].descriptorCount = 1;
+        write[i].descriptorType = i < 9 ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        if (i < 9)
+            write[i].pBufferInfo = &buffer_descriptor[i];
+        else
+            write[i].pImageInfo = &image_descriptor;
+    }
+    fn.vkUpdateDescriptorSets(backend->device, 10, write, 0, nullptr);
+    fn.vkCmdBindDescriptorSets(vk_cmd_buf, VK_PIPELINE_BIND_POINT_COMPUTE, backend->compute_pipeline_layout, 0, 1, &descriptor_set, 0, nullptr);
+
+    fn.vkCmdFillBuffer(vk_cmd_buf, scratch_buffer.buffer, 0, list_offset[1] + list_size[1], 0);
+    ComputeBarrier(backend, vk_cmd_buf, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+    // 1. count the segments of every path tile and the widths they cover, bin the draws
+    DispatchLinear(backend, vk_cmd_buf, pipelines.path_count, args, args.num_segments);
+    Dispatch2D(backend, vk_cmd_buf, pipelines.bin, args, args.bins[0], args.bins[1]);
+    ComputeBarrier(backend, vk_cmd_buf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+    // 2. allocate the segment lists
+    DispatchLinear(backend, vk_cmd_buf, pipelines.path_alloc, args, args.num_path_tiles);
+    ComputeBarrier(backend, vk_cmd_buf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+    // 3. write the segment lists and sum the backdrops up every column
+    DispatchLinear(backend, vk_cmd_buf, pipelines.path_scatter, args, args.num_segments);
+    DispatchLinear(backend, vk_cmd_buf, pipelines.backdrop, args, args.num_columns);
+    ComputeBarrier(backend, vk_cmd_buf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+
+    // 4. per tile command lists
+    Dispatch2D(backend, vk_cmd_buf, pipelines.coarse, args, args.bins[0], args.bins[1]);
+
+    // The image is completely rewritten, its previous content is discarded
+    VkImageMemoryBarrier image_barrier{};
+    image_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    image_barrier.srcAccessMask = 0;
+    image_barrier.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    image_barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    image_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    image_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    image_barrier.image = image.image;
+    image_barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+    VkMemoryBarrier barrier;
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.pNext = nullptr;
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    fn.vkCmdPipelineBarrier(vk_cmd_buf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+                            1, &barrier, 0, nullptr, 1, &image_barrier);
+
+    // 5. fine rasterization
+    Dispatch2D(backend, vk_cmd_buf, pipelines.fine, args, args.tiles[0], args.tiles[1]);
+
+    image_barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    image_barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    image_barrier.oldLayout = VK_IMAGE_LAYOUT_GENERAL;
+    fn.vkCmdPipelineBarrier(vk_cmd_buf, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+                            0, nullptr, 0, nullptr, 1, &image_barrier);
+    return true;
+}
+
+void IvgBackendVulkan_CompositeCompute(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, VkRenderPass render_pass, const VkExtent2D& fb_size)
+{
+    IvgBackendVulkan_CompositeCompute(backend, vk_cmd_buf, GetRenderPassTarget(backend, render_pass), fb_size);
+}
+
+void IvgBackendVulkan_CompositeCompute(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, const IvgBackendVulkanTarget& target, const VkExtent2D& fb_size)
+{
+    IvgBackendVulkanFn& fn = backend->fn;
+    IVG_ASSERT(backend->compute_frame_stamp == backend->frame_count && "IvgBackendVulkan_RenderCompute was not called this frame");
+    if (backend->compute_frame_stamp != backend->frame_count || fb_size.width == 0 || fb_size.height == 0)
+        return;
+    if (backend->compute_fallback_ctx != nullptr) {
+        IvgBackendVulkan_SubmitCommand(backend, vk_cmd_buf, target, fb_size, backend->compute_fallback_ctx);
+        backend->compute_fallback_ctx = nullptr;
+        return;
+    }
 
-    vtx_buffer.offset = new_vtx_count;
-    backend->winding_offset = current_winding_offset;
-    return false;
+    VkPipeline pipeline = GetCompositePipeline(backend, target);
+    if (pipeline == VK_NULL_HANDLE)
+        return;
+
+    VkViewport vp;
+    vp.x = 0;
+    vp.y = 0;
+    vp.width = (float)fb_size.width;
+    vp.height = (float)fb_size.height;
+    vp.minDepth = 0.0f;
+    vp.maxDepth = 1.0f;
+    fn.vkCmdSetViewport(vk_cmd_buf, 0, 1, &vp);
+    VkRect2D scissor = { { 0, 0 }, fb_size };
+    fn.vkCmdSetScissor(vk_cmd_buf, 0, 1, &scissor);
+
+    fn.vkCmdBindPipeline(vk_cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+    fn.vkCmdBindDescriptorSets(vk_cmd_buf, VK_PIPELINE_BIND_POINT_GRAPHICS, backend->compute_pipeline_layout, 0, 1,
+                               &backend->compute_descriptor_set[backend->frame_id], 0, nullptr);
+    fn.vkCmdDraw(vk_cmd_buf, 3, 1, 0, 0);
+}
+
+void IvgBackendVulkan_UploadDrawList(IvgBackendVulkan* backend, VkCommandBuffer vk_cmd_buf, const IvgDrawList* list)
+{
+    if (list->cmd_size_ == 0 || backend->draw_list_buffers.find(list->id_) != backend->draw_list_buffers.end())
+        return;
+
+    IvgBackendVulkanFn& fn = backend->fn;
+    VkDeviceSize size = (VkDeviceSize)list->vtx_count_ * sizeof(IvgV2);
+    IvgBackendVulkanBuffer& buffer = backend->draw_list_buffers[list->id_];
+    CreateBuffer(backend, buffer, IvgMax(size, (VkDeviceSize)sizeof(IvgV2)),
+                 VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0);
+    buffer.count = list->vtx_count_;
+    if (size == 0)
+        return;
+
+    IvgBackendVulkanBuffer staging{};
+    CreateBuffer(backend, staging, size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, 0);
+    IVG_VK_CHECK(fn.vkMapMemory(backend->device, staging.allocation, 0, VK_WHOLE_SIZE, 0, &staging.mapped_ptr));
+    std::memcpy(staging.mapped_ptr, list->vtx_buf_, size);
+
+    VkMappedMemoryRange range{};
+    range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    range.memory = staging.allocation;
+    range.offset = 0;
+    range.size = VK_WHOLE_SIZE;
+    fn.vkFlushMappedMemoryRanges(backend->device, 1, &range);
+
+    VkBufferCopy region;
+    region.srcOffset = 0;
+    region.dstOffset = 0;
+    region.size = size;
+    fn.vkCmdCopyBuffer(vk_cmd_buf, staging.buffer, buffer.buffer, 1, &region);
+
+    VkMemoryBarrier barrier;
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.pNext = nullptr;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    fn.vkCmdPipelineBarrier(vk_cmd_buf, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+                            0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    // The staging buffer is destroyed once the copy is no longer in flight
+    DisposeBuffer(backend, staging);
+}
+
+void IvgBackendVulkan_ReleaseDrawList(IvgBackendVulkan* backend, const IvgDrawList* list)
+{
+    auto it = backend->draw_list_buffers.find(list->id_);
+    if (it == backend->draw_list_buffers.end())
+        return;
+    DisposeBuffer(backend, it->second);
+    backend->draw_list_buffers.erase(it);
 }
 
 void IvgBackendVulkan_EndFrame(IvgBackendVulkan* backend)
@@ -731,4 +2729,15 @@ void IvgBackendVulkan_EndFrame(IvgBackendVulkan* backend)
     backend->frame_count++;
 }
 
+const IvgBackendVulkanStats& IvgBackendVulkan_GetStats(const IvgBackendVulkan* backend)
+{
+    return backend->stats;
+}
+
+uint32_t IvgBackendVulkan_GetFeatures(const IvgBackendVulkan* backend)
+{
+    (void)backend;
+    return IvgBackendFeatures_All;
+}
+
 
@@ -22,18 +22,24 @@ struct IvgBackendVulkanFn
 {
     PFN_vkGetPhysicalDeviceImageFormatProperties vkGetPhysicalDeviceImageFormatProperties;
     PFN_vkGetPhysicalDeviceMemoryProperties vkGetPhysicalDeviceMemoryProperties;
+    PFN_vkGetPhysicalDeviceProperties vkGetPhysicalDeviceProperties;
     PFN_vkGetBufferMemoryRequirements vkGetBufferMemoryRequirements;
+    PFN_vkGetImageMemoryRequirements vkGetImageMemoryRequirements;
     PFN_vkAllocateMemory vkAllocateMemory;
     PFN_vkFreeMemory vkFreeMemory;
     PFN_vkMapMemory vkMapMemory;
     PFN_vkFlushMappedMemoryRanges vkFlushMappedMemoryRanges;
     PFN_vkCreateBuffer vkCreateBuffer;
     PFN_vkCreateImage vkCreateImage;
+    PFN_vkCreateImageView vkCreateImageView;
     PFN_vkCreateDescriptorSetLayout vkCreateDescriptorSetLayout;
     PFN_vkCreateDescriptorPool vkCreateDescriptorPool;
     PFN_vkCreateShaderModule vkCreateShaderModule;
     PFN_vkCreatePipelineLayout vkCreatePipelineLayout;
     PFN_vkCreateGraphicsPipelines vkCreateGraphicsPipelines;
+    PFN_vkCreateComputePipelines vkCreateComputePipelines;
+    PFN_vkCreatePipelineCache vkCreatePipelineCache;
+    PFN_vkGetPipelineCacheData vkGetPipelineCacheData;
     PFN_vkBindBufferMemory vkBindBufferMemory;
     PFN_vkBindImageMemory vkBindImageMemory;
     PFN_vkAllocateDescriptorSets vkAllocateDescriptorSets;
@@ -41,19 +47,26 @@ struct IvgBackendVulkanFn
     PFN_vkResetDescriptorPool vkResetDescriptorPool;
     PFN_vkDestroyBuffer vkDestroyBuffer;
     PFN_vkDestroyImage vkDestroyImage;
+    PFN_vkDestroyImageView vkDestroyImageView;
     PFN_vkDestroyDescriptorSetLayout vkDestroyDescriptorSetLayout;
     PFN_vkDestroyDescriptorPool vkDestroyDescriptorPool;
     PFN_vkDestroyShaderModule vkDestroyShaderModule;
     PFN_vkDestroyPipelineLayout vkDestroyPipelineLayout;
     PFN_vkDestroyPipeline vkDestroyPipeline;
+    PFN_vkDestroyPipelineCache vkDestroyPipelineCache;
     PFN_vkCmdBindPipeline vkCmdBindPipeline;
     PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets;
+    PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR; // Optional, VK_KHR_push_descriptor
     PFN_vkCmdPushConstants vkCmdPushConstants;
     PFN_vkCmdSetScissor vkCmdSetScissor;
     PFN_vkCmdSetViewport vkCmdSetViewport;
     PFN_vkCmdFillBuffer vkCmdFillBuffer;
+    PFN_vkCmdCopyBuffer vkCmdCopyBuffer;
     PFN_vkCmdDraw vkCmdDraw;
+    PFN_vkCmdDispatch vkCmdDispatch;
     PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier;
+    PFN_vkCmdBeginRendering vkCmdBeginRendering; // Optional, Vulkan 1.3 or VK_KHR_dynamic_rendering
+    PFN_vkCmdEndRendering vkCmdEndRendering;
 };
 
 struct IvgBackendVulkanInit
@@ -63,15 +76,115 @@ struct IvgBackendVulkanInit
     VkDevice device;
     uint32_t num_frames_in_flight;
     VkDeviceSize min_allocation_size;
-    VkDeviceSize min_winding_buffer_size;
+    VkDeviceSize min_winding_buffer_size;              // Per frame in flight, or for all of them with
+                                                       // share_winding_buffer
+    bool share_winding_buffer = false;                 // One winding buffer for all frames in flight instead of one
+                                                       // per frame. Saves memory but serializes the frames, see
+                                                       // IvgBackendVulkan_SubmitCommand
+    bool compact_coverage = false;                     // Store the coverage of draws with few segments in 16 bits
+    bool stage_vertices = false;                       // Copy vertices uploaded with IvgBackendVulkan_UploadContext to
+                                                       // device local memory when the upload buffer is not device local
+    bool push_descriptors = false;                     // VK_KHR_push_descriptor is enabled on the device, push the
+                                                       // buffers of submits instead of allocating descriptor sets
+    const void* pipeline_cache_data = nullptr;         // Optional blob from IvgBackendVulkan_GetPipelineCacheData of a
+    size_t pipeline_cache_size = 0;                    // previous run, ignored when it was saved by another device or
+                                                       // driver
+    bool async_pipelines = false;                      // Compile the pipelines of new render passes on a thread of the
+                                                       // backend, see IvgBackendVulkan_SetPipelineTimeout
+    uint32_t max_pipeline_sets = 0;                    // Targets whose pipelines are kept, the least recently used are
+                                                       // destroyed beyond it. 0 keeps 8.
+    VkFormat render_pass_format = VK_FORMAT_UNDEFINED; // Color attachment format of the render passes passed without a
+                                                       // target, so they share pipelines like targets do.
+                                                       // VK_FORMAT_UNDEFINED keys them by handle.
+    bool dynamic_rendering_local_read = false;         // The dynamicRenderingLocalRead feature of
+                                                       // VK_KHR_dynamic_rendering_local_read is enabled, barriers are
+                                                       // recorded within dynamic rendering scopes instead of ending them
+};
+
+// Attachment drawn into, pipelines are compiled for its format and sample count. render_pass is VK_NULL_HANDLE within
+// vkCmdBeginRendering (VK_KHR_dynamic_rendering), rendering_info then points to the info it was begun with. Without
+// IvgBackendVulkanInit::dynamic_rendering_local_read barriers are not allowed within dynamic rendering, so the backend
+// ends it around the barriers between fill passes and begins it again loading the attachments, which must be stored.
+// The scope must not be suspending. The caller ends the last scope as usual. Otherwise all render passes declared with
+// the same format and sample count must be compatible, they share the pipelines compiled against the first one, which
+// must stay alive until they are compiled. Overloads that take a VkRenderPass use
+// IvgBackendVulkanInit::render_pass_format.
+struct IvgBackendVulkanTarget
+{
+    VkRenderPass render_pass;
+    VkFormat color_format;
+    VkSampleCountFlagBits samples;
+    const VkRenderingInfo* rendering_info = nullptr;
+};
+
+// Use of the winding buffer by fill batches since the last IvgBackendVulkan_BeginFrame. A batch is split when the
+// regions of its draws do not fit in the winding buffer together, peak_winding_size / winding_buffer_size is how full
+// the buffer got.
+struct IvgBackendVulkanStats
+{
+    uint32_t num_batches;
+    uint32_t num_splits;
+    uint64_t region_size;         // winding buffer entries allocated to draw regions, summed over all batches
+    uint32_t peak_winding_size;   // largest number of entries used by one batch
+    uint32_t winding_buffer_size; // entries of the winding buffer
+    uint32_t num_single_pass;     // instanced draws of rects and convex polygons, which do not use the winding buffer
+    uint32_t num_batched_draws;   // draws of fill batches recorded with the batch shaders, one instanced draw per pass
+    uint64_t upload_bytes;        // bytes of vertices, instances and batches flushed to the upload buffers
+    uint32_t num_skipped_submits; // submits dropped because their pipelines were still compiling
 };
 
 void IvgBackendVulkan_LoadFunctions(IvgBackendVulkan_LoaderFunc instance_loader_fn, IvgBackendVulkan_LoaderFunc device_loader_fn, void* userdata, IvgBackendVulkanFn* fn);
 bool IvgBackendVulkan_Initialize(const IvgBackendVulkanInit* init, IvgBackendVulkan** backend);
 void IvgBackendVulkan_Shutdown(IvgBackendVulkan* backend);
 void IvgBackendVulkan_BeginFrame(IvgBackendVulkan* backend);
+// Render passes passed to IvgBackendVulkan_SubmitCommand must declare a fragment shader read/write self dependency.
+// With IvgBackendVulkanInit::share_winding_buffer all submissions share one winding buffer, and they must also declare
+// one from VK_SUBPASS_EXTERNAL so each submission waits for the previous one to leave the buffer cleared. This
+// serializes the frames in flight.
+// Returns false when nothing was recorded: because the pipelines of the render pass were still being compiled, see
+// IvgBackendVulkan_SetPipelineTimeout, or because a dynamic rendering scope could not be split, see
+// IvgBackendVulkanTarget.
 bool IvgBackendVulkan_SubmitCommand(IvgBackendVulkan* backend, VkCommandBuffer cmd_buf, VkRenderPass render_pass, const VkExtent2D& fb_size, IvgContext* ctx);
+bool IvgBackendVulkan_SubmitCommand(IvgBackendVulkan* backend, VkCommandBuffer cmd_buf, const IvgBackendVulkanTarget& target, const VkExtent2D& fb_size, IvgContext* ctx);
 void IvgBackendVulkan_EndFrame(IvgBackendVulkan* backend);
+const IvgBackendVulkanStats& IvgBackendVulkan_GetStats(const IvgBackendVulkan* backend);
+// IvgBackendFeatures flags for IvgContext::SetBackendFeatures, the commands the backend records natively
+uint32_t IvgBackendVulkan_GetFeatures(const IvgBackendVulkan* backend);
+
+// Creates the pipelines of IvgBackendVulkan_SubmitCommand and IvgBackendVulkan_CompositeCompute for a render pass,
+// which are otherwise created by the first submit into it. Returns false when the fill pipeline could not be created.
+// With IvgBackendVulkanInit::async_pipelines the submit pipelines are queued on the compile thread instead.
+bool IvgBackendVulkan_PrewarmPipelines(IvgBackendVulkan* backend, VkRenderPass render_pass);
+bool IvgBackendVulkan_PrewarmPipelines(IvgBackendVulkan* backend, const IvgBackendVulkanTarget& target);
+// How long a submit waits for asynchronously compiled pipelines before it is skipped. 0 never waits, UINT64_MAX, the
+// default, waits until they are ready.
+void IvgBackendVulkan_SetPipelineTimeout(IvgBackendVulkan* backend, uint64_t timeout_ns);
+// Serializes the pipeline cache, to be passed to IvgBackendVulkanInit::pipeline_cache_data by the next run. Call it
+// before IvgBackendVulkan_Shutdown.
+bool IvgBackendVulkan_GetPipelineCacheData(const IvgBackendVulkan* backend, IvgVector<uint8_t>* data);
+
+// Copies the vertices of a recorded draw list into device local memory. Must be recorded outside of a render pass.
+// Lists that are replayed without being uploaded first are kept in host visible memory instead.
+void IvgBackendVulkan_UploadDrawList(IvgBackendVulkan* backend, VkCommandBuffer cmd_buf, const IvgDrawList* list);
+void IvgBackendVulkan_ReleaseDrawList(IvgBackendVulkan* backend, const IvgDrawList* list);
+
+// Uploads the vertices of a context ahead of IvgBackendVulkan_SubmitCommand, which then uses them instead of uploading
+// its own. Must be recorded outside of a render pass, once per context and frame. Optional: the vertices are only
+// staged in device local memory with IvgBackendVulkanInit::stage_vertices and an upload buffer that is not.
+void IvgBackendVulkan_UploadContext(IvgBackendVulkan* backend, VkCommandBuffer cmd_buf, const IvgContext* ctx);
+
+// Rasterizes the fills of a context with compute shaders into an image of the frame, in a constant number of
+// dispatches. Must be recorded outside of a render pass, at most once per frame.
+// Only a subset of the commands is supported: fills flattened to lines (IvgContext::FillRect, FillTriangle,
+// FillPolygon and FillPath without curves), with either fill rule, solid paints and clip rects. Returns false when
+// nothing was dispatched, because the compute pipelines could not be created or the context holds anything else
+// (curves, strokes, gradients, instanced draws or draw lists). IvgBackendVulkan_CompositeCompute then submits the
+// context to the raster pipelines instead.
+bool IvgBackendVulkan_RenderCompute(IvgBackendVulkan* backend, VkCommandBuffer cmd_buf, const VkExtent2D& fb_size, IvgContext* ctx);
+// Blends the image written by IvgBackendVulkan_RenderCompute over the current subpass, or submits the context it
+// could not rasterize
+void IvgBackendVulkan_CompositeCompute(IvgBackendVulkan* backend, VkCommandBuffer cmd_buf, VkRenderPass render_pass, const VkExtent2D& fb_size);
+void IvgBackendVulkan_CompositeCompute(IvgBackendVulkan* backend, VkCommandBuffer cmd_buf, const IvgBackendVulkanTarget& target, const VkExtent2D& fb_size);
 
 template <typename InstanceLoaderFn, typename DeviceLoaderFn>
 inline static void IvgBackendVulkan_LoadFunctions(InstanceLoaderFn&& instance_loader_fn, DeviceLoaderFn&& device_loader_fn, IvgBackendVulkanFn* fn)
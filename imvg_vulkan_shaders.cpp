@@ -1,8 +1,42 @@
 #include <cstdint>
+// Generated from the GLSL sources by the build, or by shader/compile_debug_vk.bat
 #include "shader/vk_fill.vs.h"
 #include "shader/vk_fill.fs.h"
 #include "shader/vk_polygon.vs.h"
 #include "shader/vk_polygon.fs.h"
+#include "shader/vk_polygon_backdrop.vs.h"
+#include "shader/vk_polygon_backdrop.fs.h"
+#include "shader/vk_resolve.vs.h"
+#include "shader/vk_resolve.fs.h"
+#include "shader/vk_polygon_curve.vs.h"
+#include "shader/vk_polygon_curve.fs.h"
+#include "shader/vk_polygon_batch.vs.h"
+#include "shader/vk_polygon_batch.fs.h"
+#include "shader/vk_polygon_curve_batch.vs.h"
+#include "shader/vk_polygon_curve_batch.fs.h"
+#include "shader/vk_resolve_batch.vs.h"
+#include "shader/vk_resolve_batch.fs.h"
+#include "shader/vk_fill_batch.vs.h"
+#include "shader/vk_fill_batch.fs.h"
+#include "shader/vk_stroke.vs.h"
+#include "shader/vk_stroke.fs.h"
+#include "shader/vk_rect.vs.h"
+#include "shader/vk_rect.fs.h"
+#include "shader/vk_convex.vs.h"
+#include "shader/vk_convex.fs.h"
+#include "shader/vk_instance_polygon.vs.h"
+#include "shader/vk_instance_polygon.fs.h"
+#include "shader/vk_instance_fill.vs.h"
+#include "shader/vk_instance_fill.fs.h"
+#include "shader/vk_path_count.comp.h"
+#include "shader/vk_path_alloc.comp.h"
+#include "shader/vk_path_scatter.comp.h"
+#include "shader/vk_backdrop.comp.h"
+#include "shader/vk_bin.comp.h"
+#include "shader/vk_coarse.comp.h"
+#include "shader/vk_fine.comp.h"
+#include "shader/vk_composite.vs.h"
+#include "shader/vk_composite.fs.h"
 
 uint32_t __spirv_vulkan_fill_vs_size = sizeof(__spirv_vulkan_fill_vs);
 uint32_t __spirv_vulkan_fill_fs_size = sizeof(__spirv_vulkan_fill_fs);
@@ -13,3 +47,82 @@ uint32_t __spirv_vulkan_polygon_vs_size = sizeof(__spirv_vulkan_polygon_vs);
 uint32_t __spirv_vulkan_polygon_fs_size = sizeof(__spirv_vulkan_polygon_fs);
 const uint32_t* __spirv_vulkan_polygon_vs_shader = __spirv_vulkan_polygon_vs;
 const uint32_t* __spirv_vulkan_polygon_fs_shader = __spirv_vulkan_polygon_fs;
+
+uint32_t __spirv_vulkan_polygon_backdrop_vs_size = sizeof(__spirv_vulkan_polygon_backdrop_vs);
+uint32_t __spirv_vulkan_polygon_backdrop_fs_size = sizeof(__spirv_vulkan_polygon_backdrop_fs);
+const uint32_t* __spirv_vulkan_polygon_backdrop_vs_shader = __spirv_vulkan_polygon_backdrop_vs;
+const uint32_t* __spirv_vulkan_polygon_backdrop_fs_shader = __spirv_vulkan_polygon_backdrop_fs;
+
+uint32_t __spirv_vulkan_resolve_vs_size = sizeof(__spirv_vulkan_resolve_vs);
+uint32_t __spirv_vulkan_resolve_fs_size = sizeof(__spirv_vulkan_resolve_fs);
+const uint32_t* __spirv_vulkan_resolve_vs_shader = __spirv_vulkan_resolve_vs;
+const uint32_t* __spirv_vulkan_resolve_fs_shader = __spirv_vulkan_resolve_fs;
+
+uint32_t __spirv_vulkan_polygon_curve_vs_size = sizeof(__spirv_vulkan_polygon_curve_vs);
+uint32_t __spirv_vulkan_polygon_curve_fs_size = sizeof(__spirv_vulkan_polygon_curve_fs);
+const uint32_t* __spirv_vulkan_polygon_curve_vs_shader = __spirv_vulkan_polygon_curve_vs;
+const uint32_t* __spirv_vulkan_polygon_curve_fs_shader = __spirv_vulkan_polygon_curve_fs;
+
+uint32_t __spirv_vulkan_polygon_batch_vs_size = sizeof(__spirv_vulkan_polygon_batch_vs);
+uint32_t __spirv_vulkan_polygon_batch_fs_size = sizeof(__spirv_vulkan_polygon_batch_fs);
+const uint32_t* __spirv_vulkan_polygon_batch_vs_shader = __spirv_vulkan_polygon_batch_vs;
+const uint32_t* __spirv_vulkan_polygon_batch_fs_shader = __spirv_vulkan_polygon_batch_fs;
+
+uint32_t __spirv_vulkan_polygon_curve_batch_vs_size = sizeof(__spirv_vulkan_polygon_curve_batch_vs);
+uint32_t __spirv_vulkan_polygon_curve_batch_fs_size = sizeof(__spirv_vulkan_polygon_curve_batch_fs);
+const uint32_t* __spirv_vulkan_polygon_curve_batch_vs_shader = __spirv_vulkan_polygon_curve_batch_vs;
+const uint32_t* __spirv_vulkan_polygon_curve_batch_fs_shader = __spirv_vulkan_polygon_curve_batch_fs;
+
+uint32_t __spirv_vulkan_resolve_batch_vs_size = sizeof(__spirv_vulkan_resolve_batch_vs);
+uint32_t __spirv_vulkan_resolve_batch_fs_size = sizeof(__spirv_vulkan_resolve_batch_fs);
+const uint32_t* __spirv_vulkan_resolve_batch_vs_shader = __spirv_vulkan_resolve_batch_vs;
+const uint32_t* __spirv_vulkan_resolve_batch_fs_shader = __spirv_vulkan_resolve_batch_fs;
+
+uint32_t __spirv_vulkan_fill_batch_vs_size = sizeof(__spirv_vulkan_fill_batch_vs);
+uint32_t __spirv_vulkan_fill_batch_fs_size = sizeof(__spirv_vulkan_fill_batch_fs);
+const uint32_t* __spirv_vulkan_fill_batch_vs_shader = __spirv_vulkan_fill_batch_vs;
+const uint32_t* __spirv_vulkan_fill_batch_fs_shader = __spirv_vulkan_fill_batch_fs;
+
+uint32_t __spirv_vulkan_stroke_vs_size = sizeof(__spirv_vulkan_stroke_vs);
+uint32_t __spirv_vulkan_stroke_fs_size = sizeof(__spirv_vulkan_stroke_fs);
+const uint32_t* __spirv_vulkan_stroke_vs_shader = __spirv_vulkan_stroke_vs;
+const uint32_t* __spirv_vulkan_stroke_fs_shader = __spirv_vulkan_stroke_fs;
+
+uint32_t __spirv_vulkan_rect_vs_size = sizeof(__spirv_vulkan_rect_vs);
+uint32_t __spirv_vulkan_rect_fs_size = sizeof(__spirv_vulkan_rect_fs);
+const uint32_t* __spirv_vulkan_rect_vs_shader = __spirv_vulkan_rect_vs;
+const uint32_t* __spirv_vulkan_rect_fs_shader = __spirv_vulkan_rect_fs;
+
+uint32_t __spirv_vulkan_convex_vs_size = sizeof(__spirv_vulkan_convex_vs);
+uint32_t __spirv_vulkan_convex_fs_size = sizeof(__spirv_vulkan_convex_fs);
+const uint32_t* __spirv_vulkan_convex_vs_shader = __spirv_vulkan_convex_vs;
+const uint32_t* __spirv_vulkan_convex_fs_shader = __spirv_vulkan_convex_fs;
+
+uint32_t __spirv_vulkan_instance_polygon_vs_size = sizeof(__spirv_vulkan_instance_polygon_vs);
+uint32_t __spirv_vulkan_instance_polygon_fs_size = sizeof(__spirv_vulkan_instance_polygon_fs);
+const uint32_t* __spirv_vulkan_instance_polygon_vs_shader = __spirv_vulkan_instance_polygon_vs;
+const uint32_t* __spirv_vulkan_instance_polygon_fs_shader = __spirv_vulkan_instance_polygon_fs;
+
+uint32_t __spirv_vulkan_instance_fill_vs_size = sizeof(__spirv_vulkan_instance_fill_vs);
+uint32_t __spirv_vulkan_instance_fill_fs_size = sizeof(__spirv_vulkan_instance_fill_fs);
+const uint32_t* __spirv_vulkan_instance_fill_vs_shader = __spirv_vulkan_instance_fill_vs;
+const uint32_t* __spirv_vulkan_instance_fill_fs_shader = __spirv_vulkan_instance_fill_fs;
+
+uint32_t __spirv_vulkan_path_count_cs_size = sizeof(__spirv_vulkan_path_count_cs);
+uint32_t __spirv_vulkan_path_alloc_cs_size = sizeof(__spirv_vulkan_path_alloc_cs);
+uint32_t __spirv_vulkan_path_scatter_cs_size = sizeof(__spirv_vulkan_path_scatter_cs);
+uint32_t __spirv_vulkan_backdrop_cs_size = sizeof(__spirv_vulkan_backdrop_cs);
+uint32_t __spirv_vulkan_bin_cs_size = sizeof(__spirv_vulkan_bin_cs);
+uint32_t __spirv_vulkan_coarse_cs_size = sizeof(__spirv_vulkan_coarse_cs);
+uint32_t __spirv_vulkan_fine_cs_size = sizeof(__spirv_vulkan_fine_cs);
+uint32_t __spirv_vulkan_composite_vs_size = sizeof(__spirv_vulkan_composite_vs);
+uint32_t __spirv_vulkan_composite_fs_size = sizeof(__spirv_vulkan_composite_fs);
+const uint32_t* __spirv_vulkan_path_count_cs_shader = __spirv_vulkan_path_count_cs;
+const uint32_t* __spirv_vulkan_path_alloc_cs_shader = __spirv_vulkan_path_alloc_cs;
+const uint32_t* __spirv_vulkan_path_scatter_cs_shader = __spirv_vulkan_path_scatter_cs;
+const uint32_t* __spirv_vulkan_backdrop_cs_shader = __spirv_vulkan_backdrop_cs;
+const uint32_t* __spirv_vulkan_bin_cs_shader = __spirv_vulkan_bin_cs;
+const uint32_t* __spirv_vulkan_coarse_cs_shader = __spirv_vulkan_coarse_cs;
+const uint32_t* __spirv_vulkan_fine_cs_shader = __spirv_vulkan_fine_cs;
+const uint32_t* __spirv_vulkan_composite_vs_shader = __spirv_vulkan_composite_vs;
+const uint32_t* __spirv_vulkan_composite_fs_shader = __spirv_vulkan_composite_fs;
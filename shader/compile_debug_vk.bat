@@ -3,3 +3,43 @@ glslang -S frag -V100 -g -gVS -o vk_fill.fs.h --vn __spirv_vulkan_fill_fs vk_fil
 
 glslang -S vert -V100 -g -gVS -o vk_polygon.vs.h --vn __spirv_vulkan_polygon_vs vk_polygon.vs
 glslang -S frag -V100 -g -gVS -o vk_polygon.fs.h --vn __spirv_vulkan_polygon_fs vk_polygon.fs
+glslang -S vert -V100 -g -gVS -DIVG_BACKDROP -o vk_polygon_backdrop.vs.h --vn __spirv_vulkan_polygon_backdrop_vs vk_polygon.vs
+glslang -S frag -V100 -g -gVS -DIVG_BACKDROP -o vk_polygon_backdrop.fs.h --vn __spirv_vulkan_polygon_backdrop_fs vk_polygon.fs
+glslang -S vert -V100 -g -gVS -DIVG_CURVES -DIVG_BACKDROP -o vk_polygon_curve.vs.h --vn __spirv_vulkan_polygon_curve_vs vk_polygon.vs
+glslang -S frag -V100 -g -gVS -DIVG_CURVES -DIVG_BACKDROP -o vk_polygon_curve.fs.h --vn __spirv_vulkan_polygon_curve_fs vk_polygon.fs
+
+glslang -S vert -V100 -g -gVS -o vk_resolve.vs.h --vn __spirv_vulkan_resolve_vs vk_resolve.vs
+glslang -S frag -V100 -g -gVS -o vk_resolve.fs.h --vn __spirv_vulkan_resolve_fs vk_resolve.fs
+
+glslang -S vert -V100 -g -gVS -DIVG_BACKDROP -DIVG_BATCH -o vk_polygon_batch.vs.h --vn __spirv_vulkan_polygon_batch_vs vk_polygon.vs
+glslang -S frag -V100 -g -gVS -DIVG_BACKDROP -DIVG_BATCH -o vk_polygon_batch.fs.h --vn __spirv_vulkan_polygon_batch_fs vk_polygon.fs
+glslang -S vert -V100 -g -gVS -DIVG_CURVES -DIVG_BACKDROP -DIVG_BATCH -o vk_polygon_curve_batch.vs.h --vn __spirv_vulkan_polygon_curve_batch_vs vk_polygon.vs
+glslang -S frag -V100 -g -gVS -DIVG_CURVES -DIVG_BACKDROP -DIVG_BATCH -o vk_polygon_curve_batch.fs.h --vn __spirv_vulkan_polygon_curve_batch_fs vk_polygon.fs
+glslang -S vert -V100 -g -gVS -DIVG_BATCH -o vk_resolve_batch.vs.h --vn __spirv_vulkan_resolve_batch_vs vk_resolve.vs
+glslang -S frag -V100 -g -gVS -DIVG_BATCH -o vk_resolve_batch.fs.h --vn __spirv_vulkan_resolve_batch_fs vk_resolve.fs
+glslang -S vert -V100 -g -gVS -DIVG_BATCH -o vk_fill_batch.vs.h --vn __spirv_vulkan_fill_batch_vs vk_fill.vs
+glslang -S frag -V100 -g -gVS -DIVG_BATCH -o vk_fill_batch.fs.h --vn __spirv_vulkan_fill_batch_fs vk_fill.fs
+
+glslang -S vert -V100 -g -gVS -o vk_stroke.vs.h --vn __spirv_vulkan_stroke_vs vk_stroke.vs
+glslang -S frag -V100 -g -gVS -o vk_stroke.fs.h --vn __spirv_vulkan_stroke_fs vk_stroke.fs
+
+glslang -S vert -V100 -g -gVS -DIVG_BATCH -o vk_rect.vs.h --vn __spirv_vulkan_rect_vs vk_rect.vs
+glslang -S frag -V100 -g -gVS -DIVG_BATCH -o vk_rect.fs.h --vn __spirv_vulkan_rect_fs vk_rect.fs
+glslang -S vert -V100 -g -gVS -DIVG_BATCH -o vk_convex.vs.h --vn __spirv_vulkan_convex_vs vk_convex.vs
+glslang -S frag -V100 -g -gVS -DIVG_BATCH -o vk_convex.fs.h --vn __spirv_vulkan_convex_fs vk_convex.fs
+
+glslang -S vert -V100 -g -gVS -o vk_instance_polygon.vs.h --vn __spirv_vulkan_instance_polygon_vs vk_instance_polygon.vs
+glslang -S frag -V100 -g -gVS -o vk_instance_polygon.fs.h --vn __spirv_vulkan_instance_polygon_fs vk_instance_polygon.fs
+
+glslang -S vert -V100 -g -gVS -o vk_instance_fill.vs.h --vn __spirv_vulkan_instance_fill_vs vk_instance_fill.vs
+glslang -S frag -V100 -g -gVS -o vk_instance_fill.fs.h --vn __spirv_vulkan_instance_fill_fs vk_instance_fill.fs
+
+glslang -S comp -V100 -g -gVS -o vk_path_count.comp.h --vn __spirv_vulkan_path_count_cs vk_path_tiles.comp
+glslang -S comp -V100 -g -gVS -o vk_path_alloc.comp.h --vn __spirv_vulkan_path_alloc_cs vk_path_alloc.comp
+glslang -S comp -V100 -g -gVS -DIVG_SCATTER -o vk_path_scatter.comp.h --vn __spirv_vulkan_path_scatter_cs vk_path_tiles.comp
+glslang -S comp -V100 -g -gVS -o vk_backdrop.comp.h --vn __spirv_vulkan_backdrop_cs vk_backdrop.comp
+glslang -S comp -V100 -g -gVS -o vk_bin.comp.h --vn __spirv_vulkan_bin_cs vk_bin.comp
+glslang -S comp -V100 -g -gVS -o vk_coarse.comp.h --vn __spirv_vulkan_coarse_cs vk_coarse.comp
+glslang -S comp -V100 -g -gVS -o vk_fine.comp.h --vn __spirv_vulkan_fine_cs vk_fine.comp
+glslang -S vert -V100 -g -gVS -o vk_composite.vs.h --vn __spirv_vulkan_composite_vs vk_composite.vs
+glslang -S frag -V100 -g -gVS -o vk_composite.fs.h --vn __spirv_vulkan_composite_fs vk_composite.fs
@@ -0,0 +1,10 @@
+#version 450 core
+
+layout(set = 0, binding = 9, rgba8) restrict readonly uniform image2D target;
+
+layout(location = 0) out vec4 out_color;
+
+// Blends the image written by vk_fine.comp over the render pass attachment
+void main() {
+    out_color = imageLoad(target, ivec2(gl_FragCoord.xy));
+}
@@ -0,0 +1,34 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+// Only built with IVG_BATCH
+#include "vk_common.glsli"
+
+layout(set = 0, binding = 0) readonly buffer VertexBuffer {
+    vec2 points[];
+} vertex_input;
+
+layout(location = 0) flat in uint draw_id;
+layout(location = 1) flat in float orientation;
+
+layout(location = 0) out vec4 out_color;
+
+// Coverage of a convex polygon from the distance of the pixel center to its closest edge, which is exact along the
+// edges and slightly too high at the pixels around sharp corners
+void main() {
+    load_draw(draw_id);
+    uint count = batch_draws[draw_id].vtx_count;
+    vec2 p = gl_FragCoord.xy;
+    float dist = 1e30;
+    vec2 a = vertex_input.points[vtx_offset] + translation;
+    for (uint i = 0; i < count; i++) {
+        vec2 b = vertex_input.points[vtx_offset + i + 1] + translation;
+        vec2 edge = b - a;
+        float len = length(edge);
+        if (len > 0.0)
+            dist = min(dist, orientation * (edge.x * (p.y - a.y) - edge.y * (p.x - a.x)) / len);
+        a = b;
+    }
+    out_color = unpackUnorm4x8(color);
+    out_color.a *= clamp(dist + 0.5, 0.0, 1.0);
+}
@@ -0,0 +1,35 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+// Only built with IVG_BATCH, the polygons of a run are read from the batch buffer
+#include "vk_common.glsli"
+
+layout(set = 0, binding = 0) readonly buffer VertexBuffer {
+    vec2 points[];
+} vertex_input;
+
+layout(location = 0) flat out uint draw_id;
+layout(location = 1) flat out float orientation;
+
+void main() {
+    // One instance per polygon, the quad covers its clipped pixel region
+    draw_id = batch_first + gl_InstanceIndex;
+    load_draw(draw_id);
+    uint index = gl_VertexIndex;
+    float x = (index & 1) == 1 ? ceil(max_bb.x) : floor(min_bb.x);
+    float y = ((index >> (index / 3 + 1)) & 1) == 1 ? ceil(max_bb.y) : floor(min_bb.y);
+
+    // Sign of the area, so the edge distances are positive inside for both windings
+    uint count = batch_draws[draw_id].vtx_count;
+    float area = 0.0;
+    for (uint i = 0; i < count; i++) {
+        vec2 a = vertex_input.points[vtx_offset + i];
+        vec2 b = vertex_input.points[vtx_offset + i + 1];
+        area += a.x * b.y - b.x * a.y;
+    }
+    orientation = area < 0.0 ? -1.0 : 1.0;
+    gl_Position.x = x * inv_viewport.x - 1.0f;
+    gl_Position.y = y * inv_viewport.y - 1.0f;
+    gl_Position.z = 0.0;
+    gl_Position.w = 1.0;
+}
@@ -3,7 +3,16 @@
 
 #include "vk_common.glsli"
 
+#ifdef IVG_BATCH
+layout(location = 4) flat out uint draw_id;
+#endif
+
 void main() {
+#ifdef IVG_BATCH
+    // One instance per draw of the batch
+    draw_id = batch_first + gl_InstanceIndex;
+    load_draw(draw_id);
+#endif
     uint index = gl_VertexIndex;
     float x = (index & 1) == 1 ? ceil(max_bb.x) : floor(min_bb.x);
     float y = ((index >> (index / 3 + 1)) & 1) == 1 ? ceil(max_bb.y) : floor(min_bb.y);
@@ -1,207 +0,0 @@
-	// 1115.0.0
-	 #pragma once
-const uint32_t __spirv_vulkan_fill_vs[] = {
-	0x07230203,0x00010000,0x0008000b,0x000000ba,0x00000000,0x00020011,0x00000001,0x0008000a,
-	0x5f565053,0x5f52484b,0x5f6e6f6e,0x616d6573,0x6369746e,0x666e695f,0x0000006f,0x000b000b,
-	0x00000001,0x536e6f4e,0x6e616d65,0x2e636974,0x64616853,0x442e7265,0x67756265,0x6f666e49,
-	0x3030312e,0x00000000,0x0006000b,0x00000004,0x4c534c47,0x6474732e,0x3035342e,0x00000000,
-	0x0003000e,0x00000000,0x00000001,0x0007000f,0x00000000,0x0000000f,0x6e69616d,0x00000000,
-	0x0000002a,0x0000009c,0x00050007,0x00000002,0x665f6b76,0x2e6c6c69,0x00007376,0x00070007,
-	0x00000003,0x6b762f2e,0x6d6f635f,0x2e6e6f6d,0x6c736c67,0x00000069,0x00040007,0x00000009,
-	0x746e6975,0x00000000,0x00040007,0x00000011,0x6e69616d,0x00000000,0x00910007,0x00000014,
-	0x4f202f2f,0x646f4d70,0x50656c75,0x65636f72,0x64657373,0x696c6320,0x20746e65,0x6b6c7576,
-	0x30316e61,0x2f2f0a30,0x4d704f20,0x6c75646f,0x6f725065,0x73736563,0x74206465,0x65677261,
-	0x6e652d74,0x75762076,0x6e616b6c,0x0a302e31,0x4f202f2f,0x646f4d70,0x50656c75,0x65636f72,
-	0x64657373,0x746e6520,0x702d7972,0x746e696f,0x69616d20,0x6c230a6e,0x20656e69,0x76230a31,
-	0x69737265,0x34206e6f,0x63203035,0x0a65726f,0x74786523,0x69736e65,0x47206e6f,0x4f475f4c,
-	0x454c474f,0x636e695f,0x6564756c,0x7269645f,0x69746365,0x3a206576,0x71657220,0x65726975,
-	0x69230a0a,0x756c636e,0x22206564,0x635f6b76,0x6f6d6d6f,0x6c672e6e,0x22696c73,0x6f760a0a,
-	0x6d206469,0x286e6961,0x0a7b2029,0x20202020,0x746e6975,0x646e6920,0x3d207865,0x5f6c6720,
-	0x74726556,0x6e497865,0x3b786564,0x2020200a,0x6f6c6620,0x78207461,0x28203d20,0x65646e69,
-	0x20262078,0x3d202931,0x2031203d,0x6563203f,0x6d286c69,0x625f7861,0x29782e62,0x66203a20,
-	0x726f6f6c,0x6e696d28,0x2e62625f,0x0a3b2978,0x20202020,0x616f6c66,0x20792074,0x2828203d,
-	0x65646e69,0x3e3e2078,0x6e692820,0x20786564,0x2033202f,0x2931202b,0x20262029,0x3d202931,
-	0x2031203d,0x6563203f,0x6d286c69,0x625f7861,0x29792e62,0x66203a20,0x726f6f6c,0x6e696d28,
-	0x2e62625f,0x0a3b2979,0x20202020,0x505f6c67,0x7469736f,0x2e6e6f69,0x203d2078,0x202a2078,
-	0x5f766e69,0x77656976,0x74726f70,0x2d20782e,0x302e3120,0x200a3b66,0x67202020,0x6f505f6c,
-	0x69746973,0x792e6e6f,0x79203d20,0x69202a20,0x765f766e,0x70776569,0x2e74726f,0x202d2079,
-	0x66302e31,0x20200a3b,0x6c672020,0x736f505f,0x6f697469,0x207a2e6e,0x2e30203d,0x200a3b30,
-	0x67202020,0x6f505f6c,0x69746973,0x772e6e6f,0x31203d20,0x0a3b302e,0x00000a7d,0x00040007,
-	0x00000021,0x65646e69,0x00000078,0x00030007,0x00000026,0x00746e69,0x00060007,0x0000002c,
-	0x565f6c67,0x65747265,0x646e4978,0x00007865,0x00040007,0x00000031,0x616f6c66,0x00000074,
-	0x00030007,0x00000037,0x00000078,0x00040007,0x0000003d,0x6c6f6f62,0x00000000,0x00040007,
-	0x00000047,0x5f78616d,0x00006262,0x00040007,0x0000004c,0x6f6c6f63,0x00000072,0x00040007,
-	0x00000053,0x77617244,0x00646d43,0x00030007,0x00000059,0x00000000,0x00030007,0x0000006e,
-	0x00000079,0x00050007,0x0000008f,0x505f6c67,0x7469736f,0x006e6f69,0x00060007,0x00000092,
-	0x505f6c67,0x746e696f,0x657a6953,0x00000000,0x00060007,0x00000095,0x435f6c67,0x446c6c75,
-	0x61747369,0x0065636e,0x00060007,0x00000099,0x505f6c67,0x65567265,0x78657472,0x00000000,
-	0x000a0004,0x475f4c47,0x4c474f4f,0x70635f45,0x74735f70,0x5f656c79,0x656e696c,0x7269645f,
-	0x69746365,0x00006576,0x00080004,0x475f4c47,0x4c474f4f,0x6e695f45,0x64756c63,0x69645f65,
-	0x74636572,0x00657669,0x00040005,0x0000000f,0x6e69616d,0x00000000,0x00040005,0x0000001f,
-	0x65646e69,0x00000078,0x00060005,0x0000002a,0x565f6c67,0x65747265,0x646e4978,0x00007865,
-	0x00030005,0x00000035,0x00000078,0x00040005,0x00000045,0x77617244,0x00646d43,0x00070006,
-	0x00000045,0x00000000,0x5f766e69,0x77656976,0x74726f70,0x00000000,0x00050006,0x00000045,
-	0x00000001,0x5f6e696d,0x00006262,0x00050006,0x00000045,0x00000002,0x5f78616d,0x00006262,
-	0x00060006,0x00000045,0x00000003,0x5f787476,0x7366666f,0x00007465,0x00070006,0x00000045,
-	0x00000004,0x646e6977,0x5f676e69,0x69727473,0x00006564,0x00070006,0x00000045,0x00000005,
-	0x646e6977,0x5f676e69,0x7366666f,0x00007465,0x00060006,0x00000045,0x00000006,0x6c6c6966,
-	0x646f6d5f,0x00000065,0x00060006,0x00000045,0x00000007,0x6e696170,0x79745f74,0x00006570,
-	0x00050006,0x00000045,0x00000008,0x6f6c6f63,0x00000072,0x00030005,0x00000057,0x00000000,
-	0x00030005,0x0000006c,0x00000079,0x00060005,0x0000008d,0x505f6c67,0x65567265,0x78657472,
-	0x00000000,0x00060006,0x0000008d,0x00000000,0x505f6c67,0x7469736f,0x006e6f69,0x00070006,
-	0x0000008d,0x00000001,0x505f6c67,0x746e696f,0x657a6953,0x00000000,0x00070006,0x0000008d,
-	0x00000002,0x435f6c67,0x4470696c,0x61747369,0x0065636e,0x00070006,0x0000008d,0x00000003,
-	0x435f6c67,0x446c6c75,0x61747369,0x0065636e,0x00030005,0x0000009c,0x00000000,0x00040047,
-	0x0000002a,0x0000000b,0x0000002a,0x00030047,0x00000045,0x00000002,0x00050048,0x00000045,
-	0x00000000,0x00000023,0x00000000,0x00050048,0x00000045,0x00000001,0x00000023,0x00000008,
-	0x00050048,0x00000045,0x00000002,0x00000023,0x00000010,0x00050048,0x00000045,0x00000003,
-	0x00000023,0x00000018,0x00050048,0x00000045,0x00000004,0x00000023,0x0000001c,0x00050048,
-	0x00000045,0x00000005,0x00000023,0x00000020,0x00050048,0x00000045,0x00000006,0x00000023,
-	0x00000024,0x00050048,0x00000045,0x00000007,0x00000023,0x00000028,0x00050048,0x00000045,
-	0x00000008,0x00000023,0x0000002c,0x00030047,0x0000008d,0x00000002,0x00050048,0x0000008d,
-	0x00000000,0x0000000b,0x00000000,0x00050048,0x0000008d,0x00000001,0x0000000b,0x00000001,
-	0x00050048,0x0000008d,0x00000002,0x0000000b,0x00000003,0x00050048,0x0000008d,0x00000003,
-	0x0000000b,0x00000004,0x00020013,0x00000005,0x00030021,0x00000006,0x00000005,0x00040015,
-	0x00000008,0x00000020,0x00000000,0x0004002b,0x00000008,0x0000000b,0x00000020,0x0004002b,
-	0x00000008,0x0000000c,0x00000006,0x0004002b,0x00000008,0x0000000d,0x00000000,0x0009000c,
-	0x00000005,0x0000000a,0x00000001,0x00000002,0x00000009,0x0000000b,0x0000000c,0x0000000d,
-	0x0004002b,0x00000008,0x0000000e,0x00000003,0x0007000c,0x00000005,0x00000007,0x00000001,
-	0x00000008,0x0000000e,0x00000005,0x0007000c,0x00000005,0x00000013,0x00000001,0x00000023,
-	0x00000002,0x00000014,0x0004002b,0x00000008,0x00000016,0x00000001,0x0004002b,0x00000008,
-	0x00000017,0x00000004,0x0004002b,0x00000008,0x00000018,0x00000002,0x0009000c,0x00000005,
-	0x00000015,0x00000001,0x00000001,0x00000016,0x00000017,0x00000013,0x00000018,0x000e000c,
-	0x00000005,0x00000012,0x00000001,0x00000014,0x00000011,0x00000007,0x00000013,0x0000000c,
-	0x0000000d,0x00000015,0x00000011,0x0000000e,0x0000000c,0x00040020,0x0000001c,0x00000007,
-	0x00000008,0x0004002b,0x00000008,0x0000001d,0x00000007,0x0008000c,0x00000005,0x0000001e,
-	0x00000001,0x00000003,0x0000000a,0x0000001d,0x0000000d,0x000c000c,0x00000005,0x00000020,
-	0x00000001,0x0000001a,0x00000021,0x0000000a,0x00000013,0x0000001d,0x0000000d,0x00000012,
-	0x00000017,0x0005000c,0x00000005,0x00000023,0x00000001,0x0000001f,0x00040015,0x00000025,
-	0x00000020,0x00000001,0x0009000c,0x00000005,0x00000027,0x00000001,0x00000002,0x00000026,
-	0x0000000b,0x00000017,0x0000000d,0x00040020,0x00000028,0x00000001,0x00000025,0x0008000c,
-	0x00000005,0x00000029,0x00000001,0x00000003,0x00000027,0x00000016,0x0000000d,0x0004003b,
-	0x00000028,0x0000002a,0x00000001,0x0004002b,0x00000008,0x0000002d,0x00000008,0x000e000c,
-	0x00000005,0x0000002b,0x00000001,0x00000012,0x0000002c,0x00000027,0x00000013,0x0000001d,
-	0x0000000d,0x00000015,0x0000002c,0x0000002a,0x0000002d,0x00030016,0x00000030,0x00000020,
-	0x0009000c,0x00000005,0x00000032,0x00000001,0x00000002,0x00000031,0x0000000b,0x0000000e,
-	0x0000000d,0x00040020,0x00000033,0x00000007,0x00000030,0x0008000c,0x00000005,0x00000034,
-	0x00000001,0x00000003,0x00000032,0x0000001d,0x0000000d,0x000c000c,0x00000005,0x00000036,
-	0x00000001,0x0000001a,0x00000037,0x00000032,0x00000013,0x0000002d,0x0000000d,0x00000012,
-	0x00000017,0x00020014,0x0000003c,0x0009000c,0x00000005,0x0000003e,0x00000001,0x00000002,
-	0x0000003d,0x0000000b,0x00000018,0x0000000d,0x00040017,0x00000043,0x00000030,0x00000002,
-	0x0007000c,0x00000005,0x00000044,0x00000001,0x00000006,0x00000032,0x00000018,0x000b001e,
-	0x00000045,0x00000043,0x00000043,0x00000043,0x00000008,0x00000008,0x00000008,0x00000008,
-	0x00000008,0x00000008,0x0004002b,0x00000008,0x00000048,0x0000000a,0x000d000c,0x00000005,
-	0x00000046,0x00000001,0x0000000b,0x00000047,0x00000044,0x00000013,0x00000017,0x00000048,
-	0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x00000049,0x00000001,0x0000000b,
-	0x00000047,0x00000044,0x00000013,0x00000017,0x00000048,0x0000000d,0x0000000d,0x0000000e,
-	0x000d000c,0x00000005,0x0000004a,0x00000001,0x0000000b,0x00000047,0x00000044,0x00000013,
-	0x00000017,0x00000048,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x0000004b,
-	0x00000001,0x0000000b,0x0000004c,0x0000000a,0x00000013,0x00000048,0x00000048,0x0000000d,
-	0x0000000d,0x0000000e,0x000d000c,0x00000005,0x0000004d,0x00000001,0x0000000b,0x0000004c,
-	0x0000000a,0x00000013,0x00000048,0x00000048,0x0000000d,0x0000000d,0x0000000e,0x000d000c,
-	0x00000005,0x0000004e,0x00000001,0x0000000b,0x0000004c,0x0000000a,0x00000013,0x00000048,
-	0x00000048,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x0000004f,0x00000001,
-	0x0000000b,0x0000004c,0x0000000a,0x00000013,0x00000048,0x00000048,0x0000000d,0x0000000d,
-	0x0000000e,0x000d000c,0x00000005,0x00000050,0x00000001,0x0000000b,0x0000004c,0x0000000a,
-	0x00000013,0x00000048,0x00000048,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,
-	0x00000051,0x00000001,0x0000000b,0x0000004c,0x0000000a,0x00000013,0x00000048,0x00000048,
-	0x0000000d,0x0000000d,0x0000000e,0x0017000c,0x00000005,0x00000052,0x00000001,0x0000000a,
-	0x00000053,0x00000016,0x00000013,0x0000002d,0x0000000d,0x00000015,0x00000053,0x0000000d,
-	0x0000000e,0x00000046,0x00000049,0x0000004a,0x0000004b,0x0000004d,0x0000004e,0x0000004f,
-	0x00000050,0x00000051,0x00040020,0x00000054,0x00000009,0x00000045,0x0004002b,0x00000008,
-	0x00000055,0x00000009,0x0008000c,0x00000005,0x00000056,0x00000001,0x00000003,0x00000052,
-	0x00000055,0x0000000d,0x0004003b,0x00000054,0x00000057,0x00000009,0x000e000c,0x00000005,
-	0x00000058,0x00000001,0x00000012,0x00000059,0x00000052,0x00000013,0x0000002d,0x0000000d,
-	0x00000015,0x00000059,0x00000057,0x0000002d,0x0004002b,0x00000025,0x0000005a,0x00000002,
-	0x00040020,0x0000005b,0x00000009,0x00000030,0x0008000c,0x00000005,0x0000005c,0x00000001,
-	0x00000003,0x00000032,0x00000055,0x0000000d,0x0004002b,0x00000025,0x00000063,0x00000001,
-	0x000c000c,0x00000005,0x0000006d,0x00000001,0x0000001a,0x0000006e,0x00000032,0x00000013,
-	0x00000055,0x0000000d,0x00000012,0x00000017,0x00040017,0x00000089,0x00000030,0x00000004,
-	0x0007000c,0x00000005,0x0000008a,0x00000001,0x00000006,0x00000032,0x00000017,0x0004001c,
-	0x0000008b,0x00000030,0x00000016,0x0007000c,0x00000005,0x0000008c,0x00000001,0x00000005,
-	0x00000032,0x00000016,0x0006001e,0x0000008d,0x00000089,0x00000030,0x0000008b,0x0000008b,
-	0x0004002b,0x00000008,0x00000090,0x00000018,0x000d000c,0x00000005,0x0000008e,0x00000001,
-	0x0000000b,0x0000008f,0x0000008a,0x00000013,0x00000016,0x00000090,0x0000000d,0x0000000d,
-	0x0000000e,0x0004002b,0x00000008,0x00000093,0x0000002a,0x000d000c,0x00000005,0x00000091,
-	0x00000001,0x0000000b,0x00000092,0x00000032,0x00000013,0x00000016,0x00000093,0x0000000d,
-	0x0000000d,0x0000000e,0x0004002b,0x00000008,0x00000096,0x00000055,0x000d000c,0x00000005,
-	0x00000094,0x00000001,0x0000000b,0x00000095,0x0000008c,0x00000013,0x00000016,0x00000096,
-	0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x00000097,0x00000001,0x0000000b,
-	0x00000095,0x0000008c,0x00000013,0x00000016,0x00000096,0x0000000d,0x0000000d,0x0000000e,
-	0x0012000c,0x00000005,0x00000098,0x00000001,0x0000000a,0x00000099,0x00000016,0x00000013,
-	0x00000048,0x0000000d,0x00000015,0x00000099,0x0000000d,0x0000000e,0x0000008e,0x00000091,
-	0x00000094,0x00000097,0x00040020,0x0000009a,0x00000003,0x0000008d,0x0008000c,0x00000005,
-	0x0000009b,0x00000001,0x00000003,0x00000098,0x0000000e,0x0000000d,0x0004003b,0x0000009a,
-	0x0000009c,0x00000003,0x000e000c,0x00000005,0x0000009d,0x00000001,0x00000012,0x00000059,
-	0x00000098,0x00000013,0x00000048,0x0000000d,0x00000015,0x00000059,0x0000009c,0x0000002d,
-	0x0004002b,0x00000025,0x0000009e,0x00000000,0x0004002b,0x00000030,0x000000a4,0x3f800000,
-	0x00040020,0x000000a6,0x00000003,0x00000030,0x0008000c,0x00000005,0x000000a7,0x00000001,
-	0x00000003,0x00000032,0x0000000e,0x0000000d,0x0004002b,0x00000008,0x000000ab,0x0000000b,
-	0x0004002b,0x00000030,0x000000b1,0x00000000,0x0004002b,0x00000008,0x000000b4,0x0000000c,
-	0x0004002b,0x00000008,0x000000b7,0x0000000d,0x0004002b,0x00000008,0x000000b9,0x0000000e,
-	0x00050036,0x00000005,0x0000000f,0x00000000,0x00000006,0x000200f8,0x00000010,0x0004003b,
-	0x0000001c,0x0000001f,0x00000007,0x0004003b,0x00000033,0x00000035,0x00000007,0x0004003b,
-	0x00000033,0x00000040,0x00000007,0x0004003b,0x00000033,0x0000006c,0x00000007,0x0004003b,
-	0x00000033,0x00000078,0x00000007,0x0006000c,0x00000005,0x0000001a,0x00000001,0x00000017,
-	0x00000012,0x000a000c,0x00000005,0x0000001b,0x00000001,0x00000067,0x00000013,0x0000000c,
-	0x0000000c,0x0000000d,0x0000000d,0x0007000c,0x00000005,0x00000019,0x00000001,0x00000065,
-	0x00000012,0x0000000f,0x000a000c,0x00000005,0x00000024,0x00000001,0x00000067,0x00000013,
-	0x0000001d,0x0000001d,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x00000022,0x00000001,
-	0x0000001c,0x00000020,0x0000001f,0x00000023,0x0004003d,0x00000025,0x0000002e,0x0000002a,
-	0x0004007c,0x00000008,0x0000002f,0x0000002e,0x0003003e,0x0000001f,0x0000002f,0x000a000c,
-	0x00000005,0x00000039,0x00000001,0x00000067,0x00000013,0x0000002d,0x0000002d,0x0000000d,
-	0x0000000d,0x0008000c,0x00000005,0x00000038,0x00000001,0x0000001c,0x00000036,0x00000035,
-	0x00000023,0x0004003d,0x00000008,0x0000003a,0x0000001f,0x000500c7,0x00000008,0x0000003b,
-	0x0000003a,0x00000016,0x000500aa,0x0000003c,0x0000003f,0x0000003b,0x00000016,0x000300f7,
-	0x00000042,0x00000000,0x000400fa,0x0000003f,0x00000041,0x00000062,0x000200f8,0x00000041,
-	0x0006000c,0x00000005,0x0000005e,0x00000001,0x00000017,0x00000012,0x000a000c,0x00000005,
-	0x0000005f,0x00000001,0x00000067,0x00000013,0x0000002d,0x0000002d,0x0000000d,0x0000000d,
-	0x00060041,0x0000005b,0x0000005d,0x00000057,0x0000005a,0x0000000d,0x0004003d,0x00000030,
-	0x00000060,0x0000005d,0x0006000c,0x00000030,0x00000061,0x00000004,0x00000009,0x00000060,
-	0x0003003e,0x00000040,0x00000061,0x000200f9,0x00000042,0x000200f8,0x00000062,0x0006000c,
-	0x00000005,0x00000065,0x00000001,0x00000017,0x00000012,0x000a000c,0x00000005,0x00000066,
-	0x00000001,0x00000067,0x00000013,0x0000002d,0x0000002d,0x0000000d,0x0000000d,0x00060041,
-	0x0000005b,0x00000064,0x00000057,0x00000063,0x0000000d,0x0004003d,0x00000030,0x00000067,
-	0x00000064,0x0006000c,0x00000030,0x00000068,0x00000004,0x00000008,0x00000067,0x0003003e,
-	0x00000040,0x00000068,0x000200f9,0x00000042,0x000200f8,0x00000042,0x0006000c,0x00000005,
-	0x0000006a,0x00000001,0x00000017,0x00000012,0x000a000c,0x00000005,0x0000006b,0x00000001,
-	0x00000067,0x00000013,0x0000002d,0x0000002d,0x0000000d,0x0000000d,0x0004003d,0x00000030,
-	0x00000069,0x00000040,0x0003003e,0x00000035,0x00000069,0x000a000c,0x00000005,0x00000070,
-	0x00000001,0x00000067,0x00000013,0x00000055,0x00000055,0x0000000d,0x0000000d,0x0008000c,
-	0x00000005,0x0000006f,0x00000001,0x0000001c,0x0000006d,0x0000006c,0x00000023,0x0004003d,
-	0x00000008,0x00000071,0x0000001f,0x0004003d,0x00000008,0x00000072,0x0000001f,0x00050086,
-	0x00000008,0x00000073,0x00000072,0x0000000e,0x00050080,0x00000008,0x00000074,0x00000073,
-	0x00000016,0x000500c2,0x00000008,0x00000075,0x00000071,0x00000074,0x000500c7,0x00000008,
-	0x00000076,0x00000075,0x00000016,0x000500aa,0x0000003c,0x00000077,0x00000076,0x00000016,
-	0x000300f7,0x0000007a,0x00000000,0x000400fa,0x00000077,0x00000079,0x00000080,0x000200f8,
-	0x00000079,0x0006000c,0x00000005,0x0000007c,0x00000001,0x00000017,0x00000012,0x000a000c,
-	0x00000005,0x0000007d,0x00000001,0x00000067,0x00000013,0x00000055,0x00000055,0x0000000d,
-	0x0000000d,0x00060041,0x0000005b,0x0000007b,0x00000057,0x0000005a,0x00000016,0x0004003d,
-	0x00000030,0x0000007e,0x0000007b,0x0006000c,0x00000030,0x0000007f,0x00000004,0x00000009,
-	0x0000007e,0x0003003e,0x00000078,0x0000007f,0x000200f9,0x0000007a,0x000200f8,0x00000080,
-	0x0006000c,0x00000005,0x00000082,0x00000001,0x00000017,0x00000012,0x000a000c,0x00000005,
-	0x00000083,0x00000001,0x00000067,0x00000013,0x00000055,0x00000055,0x0000000d,0x0000000d,
-	0x00060041,0x0000005b,0x00000081,0x00000057,0x00000063,0x00000016,0x0004003d,0x00000030,
-	0x00000084,0x00000081,0x0006000c,0x00000030,0x00000085,0x00000004,0x00000008,0x00000084,
-	0x0003003e,0x00000078,0x00000085,0x000200f9,0x0000007a,0x000200f8,0x0000007a,0x0006000c,
-	0x00000005,0x00000087,0x00000001,0x00000017,0x00000012,0x000a000c,0x00000005,0x00000088,
-	0x00000001,0x00000067,0x00000013,0x00000055,0x00000055,0x0000000d,0x0000000d,0x0004003d,
-	0x00000030,0x00000086,0x00000078,0x0003003e,0x0000006c,0x00000086,0x000a000c,0x00000005,
-	0x000000a0,0x00000001,0x00000067,0x00000013,0x00000048,0x00000048,0x0000000d,0x0000000d,
-	0x0004003d,0x00000030,0x0000009f,0x00000035,0x00060041,0x0000005b,0x000000a1,0x00000057,
-	0x0000009e,0x0000000d,0x0004003d,0x00000030,0x000000a2,0x000000a1,0x00050085,0x00000030,
-	0x000000a3,0x0000009f,0x000000a2,0x00050083,0x00000030,0x000000a5,0x000000a3,0x000000a4,
-	0x00060041,0x000000a6,0x000000a8,0x0000009c,0x0000009e,0x0000000d,0x0003003e,0x000000a8,
-	0x000000a5,0x000a000c,0x00000005,0x000000aa,0x00000001,0x00000067,0x00000013,0x000000ab,
-	0x000000ab,0x0000000d,0x0000000d,0x0004003d,0x00000030,0x000000a9,0x0000006c,0x00060041,
-	0x0000005b,0x000000ac,0x00000057,0x0000009e,0x00000016,0x0004003d,0x00000030,0x000000ad,
-	0x000000ac,0x00050085,0x00000030,0x000000ae,0x000000a9,0x000000ad,0x00050083,0x00000030,
-	0x000000af,0x000000ae,0x000000a4,0x00060041,0x000000a6,0x000000b0,0x0000009c,0x0000009e,
-	0x00000016,0x0003003e,0x000000b0,0x000000af,0x000a000c,0x00000005,0x000000b3,0x00000001,
-	0x00000067,0x00000013,0x000000b4,0x000000b4,0x0000000d,0x0000000d,0x00060041,0x000000a6,
-	0x000000b2,0x0000009c,0x0000009e,0x00000018,0x0003003e,0x000000b2,0x000000b1,0x000a000c,
-	0x00000005,0x000000b6,0x00000001,0x00000067,0x00000013,0x000000b7,0x000000b7,0x0000000d,
-	0x0000000d,0x00060041,0x000000a6,0x000000b5,0x0000009c,0x0000009e,0x0000000e,0x0003003e,
-	0x000000b5,0x000000a4,0x000a000c,0x00000005,0x000000b8,0x00000001,0x00000067,0x00000013,
-	0x000000b9,0x000000b9,0x0000000d,0x0000000d,0x000100fd,0x00010038
-};
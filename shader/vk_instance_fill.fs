@@ -0,0 +1,23 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+#include "vk_common.glsli"
+
+layout(location = 0) flat in uvec2 region;
+layout(location = 1) flat in vec2 region_origin;
+layout(location = 2) flat in uint instance_color;
+
+layout(set = 0, binding = 1) restrict coherent buffer WindingBuffer {
+    int coverage[];
+};
+
+layout(location = 0) out vec4 out_color;
+
+void main() {
+    uvec2 orig_coord = uvec2(gl_FragCoord.xy - region_origin);
+    uint winding_idx = orig_coord.x + orig_coord.y * region.y;
+    int coverage = atomicExchange(coverage[region.x + winding_idx], 0);
+    float a = float(coverage) / 256.0;
+    out_color = unpackUnorm4x8(instance_color);
+    out_color.a *= min(abs(a), 1.0);
+}
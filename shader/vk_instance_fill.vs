@@ -0,0 +1,23 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+#include "vk_common.glsli"
+#include "vk_instance.glsli"
+
+layout(location = 0) flat out uvec2 region;
+layout(location = 1) flat out vec2 region_origin;
+layout(location = 2) flat out uint instance_color;
+
+void main() {
+    PathInstance inst = instances[gl_InstanceIndex];
+    uint index = gl_VertexIndex;
+    float x = (index & 1) == 1 ? ceil(inst.rect.z) : floor(inst.rect.x);
+    float y = ((index >> (index / 3 + 1)) & 1) == 1 ? ceil(inst.rect.w) : floor(inst.rect.y);
+    region = instance_region(inst);
+    region_origin = floor(inst.rect.xy);
+    instance_color = inst.color;
+    gl_Position.x = x * inv_viewport.x - 1.0f;
+    gl_Position.y = y * inv_viewport.y - 1.0f;
+    gl_Position.z = 0.0;
+    gl_Position.w = 1.0;
+}
@@ -0,0 +1,41 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+#include "vk_common.glsli"
+
+layout(location = 0) in vec2 point_a;
+layout(location = 1) in vec2 point_b;
+layout(location = 2) flat in uvec2 region;
+layout(location = 3) flat in vec2 region_origin;
+
+layout(set = 0, binding = 1) restrict coherent buffer WindingBuffer {
+    int coverage[];
+};
+
+// Same as vk_polygon.fs
+float signed_area2(vec2 p, vec2 va, vec2 vb) {
+    vec2 v0 = va - p;
+    vec2 v1 = vb - p;
+    vec2 window = clamp(vec2(v0.x, v1.x), -0.5f, 0.5f);
+    float width = window.y - window.x;
+    vec2 dv = v1 - v0;
+    if (abs(dv.y) > 0.0) {
+        float slope = dv.y/dv.x;
+        float midx = 0.5f*(window.x + window.y);
+        float y = v0.y + (midx - v0.x) * slope;
+        float dy = abs(slope*width);
+        vec4 sides = vec4(y + 0.5f*dy, y - 0.5f*dy, (0.5f - y)/dy, (-0.5f - y)/dy);
+        sides = clamp(sides + 0.5f, 0.0f, 1.0f);
+        float area = 0.5f*(sides.z - sides.z*sides.y - 1.0f - sides.x + sides.x*sides.w);
+        return width == 0.0f ? 0.0f : area * width;
+    }
+    return -clamp(v0.y + 0.5, 0.0, 1.0) * width;
+}
+
+void main() {
+    vec2 frag_coord = gl_FragCoord.xy;
+    uvec2 orig_coord = uvec2(frag_coord - region_origin);
+    uint winding_idx = orig_coord.x + orig_coord.y * region.y;
+    int area = int(signed_area2(frag_coord, point_b, point_a) * 256.0);
+    atomicAdd(coverage[region.x + winding_idx], area);
+}
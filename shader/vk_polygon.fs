@@ -5,10 +5,20 @@
 
 layout(location = 0) in vec2 point_a;
 layout(location = 1) in vec2 point_b;
+#ifdef IVG_CURVES
+layout(location = 2) flat in vec2 point_c;
 
-layout(set = 0, binding = 1) restrict coherent buffer WindingBuffer {
-    int coverage[];
-};
+// Number of lines the part of a quadratic segment inside a pixel column is split into
+#define CURVE_STEPS 4
+#endif
+#ifdef IVG_BACKDROP
+layout(location = 3) flat in float first_row;
+#endif
+#ifdef IVG_BATCH
+layout(location = 4) flat in uint draw_id;
+#endif
+
+#include "vk_winding.glsli"
 
 // This produce incorrect edge
 // float signed_area(vec2 p, vec2 t) {
@@ -39,13 +49,79 @@ float signed_area2(vec2 p, vec2 va, vec2 vb) {
         float area = 0.5f*(sides.z - sides.z*sides.y - 1.0f - sides.x + sides.x*sides.w);
         return width == 0.0f ? 0.0f : area * width;
     }
-    return clamp(v0.y + 0.5, 0.0, 1.0) * width;
+    return -clamp(v0.y + 0.5, 0.0, 1.0) * width;
+}
+
+#ifdef IVG_CURVES
+vec2 eval_quad(float t) {
+    return mix(mix(point_a, point_c, t), mix(point_c, point_b, t), t);
+}
+
+// Parameter where the segment crosses x. Segments are monotonic in x and x is within their range, so one of the
+// roots lies in [0, 1].
+float solve_quad_x(float x) {
+    float a = point_a.x - 2.0f*point_c.x + point_b.x;
+    float b = 2.0f*(point_c.x - point_a.x);
+    float c = point_a.x - x;
+    if (abs(a) < 1e-6f)
+        return b != 0.0f ? clamp(-c/b, 0.0f, 1.0f) : 0.0f;
+    float s = sqrt(max(b*b - 4.0f*a*c, 0.0f));
+    float q = -0.5f*(b + (b < 0.0f ? -s : s));
+    float t0 = q/a;
+    float t1 = q != 0.0f ? c/q : t0;
+    return abs(t0 - clamp(t0, 0.0f, 1.0f)) <= abs(t1 - clamp(t1, 0.0f, 1.0f)) ? clamp(t0, 0.0f, 1.0f) : clamp(t1, 0.0f, 1.0f);
+}
+
+// The part of the segment inside the pixel column is split into lines whose areas are summed
+float signed_area_quad(vec2 p) {
+    vec2 range = vec2(min(point_a.x, point_b.x), max(point_a.x, point_b.x));
+    float t0 = solve_quad_x(clamp(p.x - 0.5f, range.x, range.y));
+    float t1 = solve_quad_x(clamp(p.x + 0.5f, range.x, range.y));
+    vec2 t = vec2(min(t0, t1), max(t0, t1));
+    vec2 prev = eval_quad(t.x);
+    float area = 0.0f;
+    for (int i = 1; i <= CURVE_STEPS; i++) {
+        vec2 next = eval_quad(mix(t.x, t.y, float(i) / float(CURVE_STEPS)));
+        area += signed_area2(p, next, prev);
+        prev = next;
+    }
+    return area;
+}
+#endif
+
+float segment_area(vec2 p) {
+#ifdef IVG_CURVES
+    return signed_area_quad(p);
+#else
+    return signed_area2(p, point_b, point_a);
+#endif
+}
+
+#ifdef IVG_BACKDROP
+// Coverage of the segment on pixels below it. It is quantized from the end points so the backdrops of a closed path
+// cancel out exactly.
+int backdrop(vec2 p) {
+    return int(clamp(point_a.x - p.x, -0.5f, 0.5f) * 256.0) - int(clamp(point_b.x - p.x, -0.5f, 0.5f) * 256.0);
 }
+#endif
 
 void main() {
+#ifdef IVG_BATCH
+    load_draw(draw_id);
+#endif
     vec2 frag_coord = gl_FragCoord.xy;
     uvec2 orig_coord = uvec2(frag_coord - floor(min_bb));
     uint winding_idx = orig_coord.x + orig_coord.y * winding_stride;
-    int area = int(signed_area2(frag_coord, point_b, point_a) * 256.0);
-    atomicAdd(coverage[winding_offset + winding_idx], area);
+#ifdef IVG_BACKDROP
+    // Store the change from the row above, the resolve pass sums the rows of each column back up
+    int column_backdrop = backdrop(frag_coord);
+    int area = int(segment_area(frag_coord) * 256.0) + column_backdrop;
+    if (frag_coord.y - 0.5f != first_row)
+        area -= int(segment_area(frag_coord - vec2(0.0f, 1.0f)) * 256.0) + column_backdrop;
+    if (area != 0)
+        add_coverage(winding_idx, area);
+#else
+    int area = int(segment_area(frag_coord) * 256.0);
+    add_coverage(winding_idx, area);
+#endif
 }
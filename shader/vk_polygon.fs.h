@@ -1,410 +0,0 @@
-	// 1115.0.0
-	 #pragma once
-const uint32_t __spirv_vulkan_polygon_fs[] = {
-	0x07230203,0x00010000,0x0008000b,0x0000018e,0x00000000,0x00020011,0x00000001,0x0008000a,
-	0x5f565053,0x5f52484b,0x5f6e6f6e,0x616d6573,0x6369746e,0x666e695f,0x0000006f,0x000b000b,
-	0x00000001,0x536e6f4e,0x6e616d65,0x2e636974,0x64616853,0x442e7265,0x67756265,0x6f666e49,
-	0x3030312e,0x00000000,0x0006000b,0x00000004,0x4c534c47,0x6474732e,0x3035342e,0x00000000,
-	0x0003000e,0x00000000,0x00000001,0x0008000f,0x00000004,0x0000000f,0x6e69616d,0x00000000,
-	0x00000117,0x00000164,0x00000167,0x00030010,0x0000000f,0x00000007,0x00060007,0x00000002,
-	0x705f6b76,0x67796c6f,0x662e6e6f,0x00000073,0x00070007,0x00000003,0x6b762f2e,0x6d6f635f,
-	0x2e6e6f6d,0x6c736c67,0x00000069,0x00040007,0x00000009,0x746e6975,0x00000000,0x00040007,
-	0x00000012,0x616f6c66,0x00000074,0x00060007,0x00000021,0x6e676973,0x615f6465,0x32616572,
-	0x00000000,0x01dd0007,0x00000024,0x4f202f2f,0x646f4d70,0x50656c75,0x65636f72,0x64657373,
-	0x696c6320,0x20746e65,0x6b6c7576,0x30316e61,0x2f2f0a30,0x4d704f20,0x6c75646f,0x6f725065,
-	0x73736563,0x74206465,0x65677261,0x6e652d74,0x75762076,0x6e616b6c,0x0a302e31,0x4f202f2f,
-	0x646f4d70,0x50656c75,0x65636f72,0x64657373,0x746e6520,0x702d7972,0x746e696f,0x69616d20,
-	0x6c230a6e,0x20656e69,0x76230a31,0x69737265,0x34206e6f,0x63203035,0x0a65726f,0x74786523,
-	0x69736e65,0x47206e6f,0x4f475f4c,0x454c474f,0x636e695f,0x6564756c,0x7269645f,0x69746365,
-	0x3a206576,0x71657220,0x65726975,0x69230a0a,0x756c636e,0x22206564,0x635f6b76,0x6f6d6d6f,
-	0x6c672e6e,0x22696c73,0x616c0a0a,0x74756f79,0x636f6c28,0x6f697461,0x203d206e,0x69202930,
-	0x6576206e,0x70203263,0x746e696f,0x0a3b615f,0x6f79616c,0x6c287475,0x7461636f,0x206e6f69,
-	0x2931203d,0x206e6920,0x32636576,0x696f7020,0x625f746e,0x6c0a0a3b,0x756f7961,0x65732874,
-	0x203d2074,0x62202c30,0x69646e69,0x3d20676e,0x20293120,0x74736572,0x74636972,0x686f6320,
-	0x6e657265,0x75622074,0x72656666,0x6e695720,0x676e6964,0x66667542,0x7b207265,0x2020200a,
-	0x746e6920,0x766f6320,0x67617265,0x3b5d5b65,0x0a3b7d0a,0x202f2f0a,0x73696854,0x6f727020,
-	0x65637564,0x636e6920,0x6572726f,0x65207463,0x0a656764,0x66202f2f,0x74616f6c,0x67697320,
-	0x5f64656e,0x61657261,0x63657628,0x2c702032,0x63657620,0x29742032,0x2f0a7b20,0x2020202f,
-	0x65762020,0x76203263,0x203d2030,0x6e696f70,0x69775f74,0x776f646e,0x3b79782e,0x202f2f0a,
-	0x20202020,0x32636576,0x6e697720,0x20776f64,0x6f70203d,0x5f746e69,0x646e6977,0x7a2e776f,
-	0x2f0a3b77,0x2020202f,0x65762020,0x76203263,0x70203d20,0x76202d20,0x2f0a3b30,0x2020202f,
-	0x6c662020,0x2074616f,0x203d2064,0x2a792e74,0x20782e76,0x2e74202d,0x2e762a78,0x2f0a3b79,
-	0x2020202f,0x65762020,0x77203263,0x6f646e69,0x72615f77,0x3d206165,0x616c6320,0x7628706d,
-	0x28326365,0x646e6977,0x792e776f,0x70202d20,0x202c782e,0x646e6977,0x782e776f,0x70202d20,
-	0x2c29782e,0x2e302d20,0x202c6635,0x66352e30,0x2f0a3b29,0x2020202f,0x6c662020,0x2074616f,
-	0x74646977,0x203d2068,0x646e6977,0x615f776f,0x2e616572,0x202d2079,0x646e6977,0x615f776f,
-	0x2e616572,0x2f0a3b78,0x2020202f,0x20642020,0x6c63203d,0x28706d61,0x30202c64,0x202c302e,
-	0x29302e31,0x2f2f0a3b,0x20202020,0x74657220,0x206e7275,0x202a2064,0x74646977,0x2f0a3b68,
-	0x0a7d202f,0x202f2f0a,0x65666552,0x636e6572,0x66206465,0x206d6f72,0x6f6e616e,0x43586776,
-	0x74697720,0x6c732068,0x74686769,0x646f6d20,0x63696669,0x6f697461,0x660a736e,0x74616f6c,
-	0x67697320,0x5f64656e,0x61657261,0x65762832,0x70203263,0x6576202c,0x76203263,0x76202c61,
-	0x20326365,0x20296276,0x20200a7b,0x65762020,0x76203263,0x203d2030,0x2d206176,0x0a3b7020,
-	0x20202020,0x32636576,0x20317620,0x6276203d,0x70202d20,0x20200a3b,0x65762020,0x77203263,
-	0x6f646e69,0x203d2077,0x6d616c63,0x65762870,0x76283263,0x2c782e30,0x2e317620,0x202c2978,
-	0x352e302d,0x30202c66,0x2966352e,0x20200a3b,0x6c662020,0x2074616f,0x74646977,0x203d2068,
-	0x646e6977,0x792e776f,0x77202d20,0x6f646e69,0x3b782e77,0x2020200a,0x63657620,0x76642032,
-	0x76203d20,0x202d2031,0x0a3b3076,0x20202020,0x28206669,0x28736261,0x792e7664,0x203e2029,
-	0x29302e30,0x200a7b20,0x20202020,0x66202020,0x74616f6c,0x6f6c7320,0x3d206570,0x2e766420,
-	0x76642f79,0x0a3b782e,0x20202020,0x20202020,0x616f6c66,0x696d2074,0x3d207864,0x352e3020,
-	0x77282a66,0x6f646e69,0x20782e77,0x6977202b,0x776f646e,0x3b29792e,0x2020200a,0x20202020,
-	0x6f6c6620,0x79207461,0x76203d20,0x20792e30,0x6d28202b,0x20786469,0x3076202d,0x2029782e,
-	0x6c73202a,0x3b65706f,0x2020200a,0x20202020,0x6f6c6620,0x64207461,0x203d2079,0x28736261,
-	0x706f6c73,0x69772a65,0x29687464,0x20200a3b,0x20202020,0x65762020,0x73203463,0x73656469,
-	0x76203d20,0x28346365,0x202b2079,0x66352e30,0x2c79642a,0x2d207920,0x352e3020,0x79642a66,
-	0x3028202c,0x2066352e,0x2979202d,0x2c79642f,0x302d2820,0x2066352e,0x2979202d,0x2979642f,
-	0x20200a3b,0x20202020,0x69732020,0x20736564,0x6c63203d,0x28706d61,0x65646973,0x202b2073,
-	0x66352e30,0x2e30202c,0x202c6630,0x66302e31,0x200a3b29,0x20202020,0x66202020,0x74616f6c,
-	0x65726120,0x203d2061,0x66352e30,0x6973282a,0x2e736564,0x202d207a,0x65646973,0x2a7a2e73,
-	0x65646973,0x20792e73,0x2e31202d,0x2d206630,0x64697320,0x782e7365,0x73202b20,0x73656469,
-	0x732a782e,0x73656469,0x3b29772e,0x2020200a,0x20202020,0x74657220,0x206e7275,0x74646977,
-	0x3d3d2068,0x302e3020,0x203f2066,0x66302e30,0x61203a20,0x20616572,0x6977202a,0x3b687464,
-	0x2020200a,0x200a7d20,0x72202020,0x72757465,0x6c63206e,0x28706d61,0x792e3076,0x30202b20,
-	0x202c352e,0x2c302e30,0x302e3120,0x202a2029,0x74646977,0x7d0a3b68,0x6f760a0a,0x6d206469,
-	0x286e6961,0x0a7b2029,0x20202020,0x32636576,0x61726620,0x6f635f67,0x2064726f,0x6c67203d,
-	0x6172465f,0x6f6f4367,0x782e6472,0x200a3b79,0x75202020,0x32636576,0x69726f20,0x6f635f67,
-	0x2064726f,0x7675203d,0x28326365,0x67617266,0x6f6f635f,0x2d206472,0x6f6c6620,0x6d28726f,
-	0x625f6e69,0x3b292962,0x2020200a,0x6e697520,0x69772074,0x6e69646e,0x64695f67,0x203d2078,
-	0x6769726f,0x6f6f635f,0x782e6472,0x6f202b20,0x5f676972,0x726f6f63,0x20792e64,0x6977202a,
-	0x6e69646e,0x74735f67,0x65646972,0x20200a3b,0x6e692020,0x72612074,0x3d206165,0x746e6920,
-	0x67697328,0x5f64656e,0x61657261,0x72662832,0x635f6761,0x64726f6f,0x6f70202c,0x5f746e69,
-	0x70202c62,0x746e696f,0x2029615f,0x3532202a,0x29302e36,0x20200a3b,0x74612020,0x63696d6f,
-	0x28646441,0x65766f63,0x65676172,0x6e69775b,0x676e6964,0x66666f5f,0x20746573,0x6977202b,
-	0x6e69646e,0x64695f67,0x202c5d78,0x61657261,0x7d0a3b29,0x0000000a,0x00030007,0x0000002a,
-	0x00000070,0x00030007,0x00000030,0x00006176,0x00030007,0x00000033,0x00006276,0x00040007,
-	0x00000035,0x6e69616d,0x00000000,0x00030007,0x0000003b,0x00003076,0x00030007,0x00000044,
-	0x00003176,0x00040007,0x0000004d,0x646e6977,0x0000776f,0x00040007,0x0000005f,0x74646977,
-	0x00000068,0x00030007,0x0000006a,0x00007664,0x00040007,0x00000077,0x6c6f6f62,0x00000000,
-	0x00040007,0x0000007f,0x706f6c73,0x00000065,0x00040007,0x0000008b,0x7864696d,0x00000000,
-	0x00030007,0x00000097,0x00000079,0x00030007,0x000000a6,0x00007964,0x00040007,0x000000b4,
-	0x65646973,0x00000073,0x00040007,0x000000d4,0x61657261,0x00000000,0x00050007,0x00000111,
-	0x67617266,0x6f6f635f,0x00006472,0x00060007,0x00000119,0x465f6c67,0x43676172,0x64726f6f,
-	0x00000000,0x00050007,0x00000123,0x6769726f,0x6f6f635f,0x00006472,0x00040007,0x0000012a,
-	0x5f78616d,0x00006262,0x00040007,0x0000012f,0x6f6c6f63,0x00000072,0x00040007,0x00000136,
-	0x77617244,0x00646d43,0x00030007,0x0000013c,0x00000000,0x00030007,0x0000013e,0x00746e69,
-	0x00050007,0x0000014c,0x646e6977,0x5f676e69,0x00786469,0x00040007,0x00000166,0x6e696f70,
-	0x00625f74,0x00040007,0x00000169,0x6e696f70,0x00615f74,0x00050007,0x00000178,0x65766f63,
-	0x65676172,0x00000000,0x00060007,0x0000017a,0x646e6957,0x42676e69,0x65666675,0x00000072,
-	0x000a0004,0x475f4c47,0x4c474f4f,0x70635f45,0x74735f70,0x5f656c79,0x656e696c,0x7269645f,
-	0x69746365,0x00006576,0x00080004,0x475f4c47,0x4c474f4f,0x6e695f45,0x64756c63,0x69645f65,
-	0x74636572,0x00657669,0x00040005,0x0000000f,0x6e69616d,0x00000000,0x00090005,0x0000001f,
-	0x6e676973,0x615f6465,0x32616572,0x32667628,0x3266763b,0x3266763b,0x0000003b,0x00030005,
-	0x0000001c,0x00000070,0x00030005,0x0000001d,0x00006176,0x00030005,0x0000001e,0x00006276,
-	0x00030005,0x00000039,0x00003076,0x00030005,0x00000042,0x00003176,0x00040005,0x0000004b,
-	0x646e6977,0x0000776f,0x00040005,0x0000005d,0x74646977,0x00000068,0x00030005,0x00000068,
-	0x00007664,0x00040005,0x0000007d,0x706f6c73,0x00000065,0x00040005,0x00000089,0x7864696d,
-	0x00000000,0x00030005,0x00000095,0x00000079,0x00030005,0x000000a4,0x00007964,0x00040005,
-	0x000000b2,0x65646973,0x00000073,0x00040005,0x000000d2,0x61657261,0x00000000,0x00050005,
-	0x0000010f,0x67617266,0x6f6f635f,0x00006472,0x00060005,0x00000117,0x465f6c67,0x43676172,
-	0x64726f6f,0x00000000,0x00050005,0x00000121,0x6769726f,0x6f6f635f,0x00006472,0x00040005,
-	0x00000128,0x77617244,0x00646d43,0x00070006,0x00000128,0x00000000,0x5f766e69,0x77656976,
-	0x74726f70,0x00000000,0x00050006,0x00000128,0x00000001,0x5f6e696d,0x00006262,0x00050006,
-	0x00000128,0x00000002,0x5f78616d,0x00006262,0x00060006,0x00000128,0x00000003,0x5f787476,
-	0x7366666f,0x00007465,0x00070006,0x00000128,0x00000004,0x646e6977,0x5f676e69,0x69727473,
-	0x00006564,0x00070006,0x00000128,0x00000005,0x646e6977,0x5f676e69,0x7366666f,0x00007465,
-	0x00060006,0x00000128,0x00000006,0x6c6c6966,0x646f6d5f,0x00000065,0x00060006,0x00000128,
-	0x00000007,0x6e696170,0x79745f74,0x00006570,0x00050006,0x00000128,0x00000008,0x6f6c6f63,
-	0x00000072,0x00030005,0x0000013a,0x00000000,0x00050005,0x0000014a,0x646e6977,0x5f676e69,
-	0x00786469,0x00040005,0x0000015d,0x61657261,0x00000000,0x00040005,0x00000164,0x6e696f70,
-	0x00625f74,0x00040005,0x00000167,0x6e696f70,0x00615f74,0x00040005,0x0000016a,0x61726170,
-	0x0000006d,0x00040005,0x0000016c,0x61726170,0x0000006d,0x00040005,0x0000016e,0x61726170,
-	0x0000006d,0x00060005,0x00000176,0x646e6957,0x42676e69,0x65666675,0x00000072,0x00060006,
-	0x00000176,0x00000000,0x65766f63,0x65676172,0x00000000,0x00030005,0x0000017e,0x00000000,
-	0x00040047,0x00000117,0x0000000b,0x0000000f,0x00030047,0x00000128,0x00000002,0x00050048,
-	0x00000128,0x00000000,0x00000023,0x00000000,0x00050048,0x00000128,0x00000001,0x00000023,
-	0x00000008,0x00050048,0x00000128,0x00000002,0x00000023,0x00000010,0x00050048,0x00000128,
-	0x00000003,0x00000023,0x00000018,0x00050048,0x00000128,0x00000004,0x00000023,0x0000001c,
-	0x00050048,0x00000128,0x00000005,0x00000023,0x00000020,0x00050048,0x00000128,0x00000006,
-	0x00000023,0x00000024,0x00050048,0x00000128,0x00000007,0x00000023,0x00000028,0x00050048,
-	0x00000128,0x00000008,0x00000023,0x0000002c,0x00040047,0x00000164,0x0000001e,0x00000001,
-	0x00040047,0x00000167,0x0000001e,0x00000000,0x00040047,0x00000174,0x00000006,0x00000004,
-	0x00030047,0x00000176,0x00000003,0x00040048,0x00000176,0x00000000,0x00000013,0x00040048,
-	0x00000176,0x00000000,0x00000017,0x00050048,0x00000176,0x00000000,0x00000023,0x00000000,
-	0x00030047,0x0000017e,0x00000013,0x00030047,0x0000017e,0x00000017,0x00040047,0x0000017e,
-	0x00000021,0x00000001,0x00040047,0x0000017e,0x00000022,0x00000000,0x00020013,0x00000005,
-	0x00030021,0x00000006,0x00000005,0x00040015,0x00000008,0x00000020,0x00000000,0x0004002b,
-	0x00000008,0x0000000b,0x00000020,0x0004002b,0x00000008,0x0000000c,0x00000006,0x0004002b,
-	0x00000008,0x0000000d,0x00000000,0x0009000c,0x00000005,0x0000000a,0x00000001,0x00000002,
-	0x00000009,0x0000000b,0x0000000c,0x0000000d,0x0004002b,0x00000008,0x0000000e,0x00000003,
-	0x0007000c,0x00000005,0x00000007,0x00000001,0x00000008,0x0000000e,0x00000005,0x00030016,
-	0x00000011,0x00000020,0x0009000c,0x00000005,0x00000013,0x00000001,0x00000002,0x00000012,
-	0x0000000b,0x0000000e,0x0000000d,0x00040017,0x00000014,0x00000011,0x00000002,0x0004002b,
-	0x00000008,0x00000015,0x00000002,0x0007000c,0x00000005,0x00000016,0x00000001,0x00000006,
-	0x00000013,0x00000015,0x00040020,0x00000017,0x00000007,0x00000014,0x0004002b,0x00000008,
-	0x00000018,0x00000007,0x0008000c,0x00000005,0x00000019,0x00000001,0x00000003,0x00000016,
-	0x00000018,0x0000000d,0x00060021,0x0000001a,0x00000011,0x00000017,0x00000017,0x00000017,
-	0x000a000c,0x00000005,0x0000001b,0x00000001,0x00000008,0x0000000e,0x00000013,0x00000016,
-	0x00000016,0x00000016,0x0007000c,0x00000005,0x00000023,0x00000001,0x00000023,0x00000002,
-	0x00000024,0x0004002b,0x00000008,0x00000025,0x0000001a,0x0004002b,0x00000008,0x00000027,
-	0x00000001,0x0004002b,0x00000008,0x00000028,0x00000004,0x0009000c,0x00000005,0x00000026,
-	0x00000001,0x00000001,0x00000027,0x00000028,0x00000023,0x00000015,0x000e000c,0x00000005,
-	0x00000022,0x00000001,0x00000014,0x00000021,0x0000001b,0x00000023,0x00000025,0x0000000d,
-	0x00000026,0x00000021,0x0000000e,0x00000025,0x000d000c,0x00000005,0x00000029,0x00000001,
-	0x0000001a,0x0000002a,0x00000016,0x00000023,0x00000025,0x0000000d,0x00000022,0x00000028,
-	0x00000027,0x0005000c,0x00000005,0x0000002c,0x00000001,0x0000001f,0x000d000c,0x00000005,
-	0x0000002f,0x00000001,0x0000001a,0x00000030,0x00000016,0x00000023,0x00000025,0x0000000d,
-	0x00000022,0x00000028,0x00000015,0x000d000c,0x00000005,0x00000032,0x00000001,0x0000001a,
-	0x00000033,0x00000016,0x00000023,0x00000025,0x0000000d,0x00000022,0x00000028,0x0000000e,
-	0x0004002b,0x00000008,0x00000037,0x0000002d,0x000e000c,0x00000005,0x00000036,0x00000001,
-	0x00000014,0x00000035,0x00000007,0x00000023,0x00000037,0x0000000d,0x00000026,0x00000035,
-	0x0000000e,0x00000037,0x0004002b,0x00000008,0x0000003c,0x0000001b,0x000c000c,0x00000005,
-	0x0000003a,0x00000001,0x0000001a,0x0000003b,0x00000016,0x00000023,0x0000003c,0x0000000d,
-	0x00000022,0x00000028,0x0004002b,0x00000008,0x00000045,0x0000001c,0x000c000c,0x00000005,
-	0x00000043,0x00000001,0x0000001a,0x00000044,0x00000016,0x00000023,0x00000045,0x0000000d,
-	0x00000022,0x00000028,0x0004002b,0x00000008,0x0000004e,0x0000001d,0x000c000c,0x00000005,
-	0x0000004c,0x00000001,0x0000001a,0x0000004d,0x00000016,0x00000023,0x0000004e,0x0000000d,
-	0x00000022,0x00000028,0x00040020,0x00000051,0x00000007,0x00000011,0x0008000c,0x00000005,
-	0x00000052,0x00000001,0x00000003,0x00000013,0x00000018,0x0000000d,0x0004002b,0x00000011,
-	0x00000058,0xbf000000,0x0004002b,0x00000011,0x00000059,0x3f000000,0x0004002b,0x00000008,
-	0x00000060,0x0000001e,0x000c000c,0x00000005,0x0000005e,0x00000001,0x0000001a,0x0000005f,
-	0x00000013,0x00000023,0x00000060,0x0000000d,0x00000022,0x00000028,0x0004002b,0x00000008,
-	0x0000006b,0x0000001f,0x000c000c,0x00000005,0x00000069,0x00000001,0x0000001a,0x0000006a,
-	0x00000016,0x00000023,0x0000006b,0x0000000d,0x00000022,0x00000028,0x0004002b,0x00000011,
-	0x00000075,0x00000000,0x00020014,0x00000076,0x0009000c,0x00000005,0x00000078,0x00000001,
-	0x00000002,0x00000077,0x0000000b,0x00000015,0x0000000d,0x0009000c,0x00000005,0x0000007c,
-	0x00000001,0x00000015,0x00000023,0x0000000d,0x0000000d,0x00000022,0x0004002b,0x00000008,
-	0x00000080,0x00000021,0x000c000c,0x00000005,0x0000007e,0x00000001,0x0000001a,0x0000007f,
-	0x00000013,0x00000023,0x00000080,0x0000000d,0x0000007c,0x00000028,0x0004002b,0x00000008,
-	0x0000008c,0x00000022,0x000c000c,0x00000005,0x0000008a,0x00000001,0x0000001a,0x0000008b,
-	0x00000013,0x00000023,0x0000008c,0x0000000d,0x0000007c,0x00000028,0x0004002b,0x00000008,
-	0x00000098,0x00000023,0x000c000c,0x00000005,0x00000096,0x00000001,0x0000001a,0x00000097,
-	0x00000013,0x00000023,0x00000098,0x0000000d,0x0000007c,0x00000028,0x0004002b,0x00000008,
-	0x000000a7,0x00000024,0x000c000c,0x00000005,0x000000a5,0x00000001,0x0000001a,0x000000a6,
-	0x00000013,0x00000023,0x000000a7,0x0000000d,0x0000007c,0x00000028,0x00040017,0x000000ae,
-	0x00000011,0x00000004,0x0007000c,0x00000005,0x000000af,0x00000001,0x00000006,0x00000013,
-	0x00000028,0x00040020,0x000000b0,0x00000007,0x000000ae,0x0008000c,0x00000005,0x000000b1,
-	0x00000001,0x00000003,0x000000af,0x00000018,0x0000000d,0x0004002b,0x00000008,0x000000b5,
-	0x00000025,0x000c000c,0x00000005,0x000000b3,0x00000001,0x0000001a,0x000000b4,0x000000af,
-	0x00000023,0x000000b5,0x0000000d,0x0000007c,0x00000028,0x0004002b,0x00000008,0x000000cb,
-	0x00000026,0x0004002b,0x00000011,0x000000ce,0x3f800000,0x0004002b,0x00000008,0x000000d5,
-	0x00000027,0x000c000c,0x00000005,0x000000d3,0x00000001,0x0000001a,0x000000d4,0x00000013,
-	0x00000023,0x000000d5,0x0000000d,0x0000007c,0x00000028,0x0004002b,0x00000008,0x000000ed,
-	0x00000028,0x0004002b,0x00000008,0x00000101,0x0000002a,0x0004002b,0x00000008,0x0000010b,
-	0x0000002b,0x0004002b,0x00000008,0x00000112,0x0000002e,0x000c000c,0x00000005,0x00000110,
-	0x00000001,0x0000001a,0x00000111,0x00000016,0x00000023,0x00000112,0x0000000d,0x00000036,
-	0x00000028,0x00040020,0x00000115,0x00000001,0x000000ae,0x0008000c,0x00000005,0x00000116,
-	0x00000001,0x00000003,0x000000af,0x00000027,0x0000000d,0x0004003b,0x00000115,0x00000117,
-	0x00000001,0x0004002b,0x00000008,0x0000011a,0x00000008,0x000e000c,0x00000005,0x00000118,
-	0x00000001,0x00000012,0x00000119,0x000000af,0x00000023,0x00000112,0x0000000d,0x00000026,
-	0x00000119,0x00000117,0x0000011a,0x00040017,0x0000011d,0x00000008,0x00000002,0x0007000c,
-	0x00000005,0x0000011e,0x00000001,0x00000006,0x0000000a,0x00000015,0x00040020,0x0000011f,
-	0x00000007,0x0000011d,0x0008000c,0x00000005,0x00000120,0x00000001,0x00000003,0x0000011e,
-	0x00000018,0x0000000d,0x0004002b,0x00000008,0x00000124,0x0000002f,0x000c000c,0x00000005,
-	0x00000122,0x00000001,0x0000001a,0x00000123,0x0000011e,0x00000023,0x00000124,0x0000000d,
-	0x00000036,0x00000028,0x000b001e,0x00000128,0x00000014,0x00000014,0x00000014,0x00000008,
-	0x00000008,0x00000008,0x00000008,0x00000008,0x00000008,0x0004002b,0x00000008,0x0000012b,
-	0x0000000a,0x000d000c,0x00000005,0x00000129,0x00000001,0x0000000b,0x0000012a,0x00000016,
-	0x00000023,0x00000028,0x0000012b,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,
-	0x0000012c,0x00000001,0x0000000b,0x0000012a,0x00000016,0x00000023,0x00000028,0x0000012b,
-	0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x0000012d,0x00000001,0x0000000b,
-	0x0000012a,0x00000016,0x00000023,0x00000028,0x0000012b,0x0000000d,0x0000000d,0x0000000e,
-	0x000d000c,0x00000005,0x0000012e,0x00000001,0x0000000b,0x0000012f,0x0000000a,0x00000023,
-	0x0000012b,0x0000012b,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x00000130,
-	0x00000001,0x0000000b,0x0000012f,0x0000000a,0x00000023,0x0000012b,0x0000012b,0x0000000d,
-	0x0000000d,0x0000000e,0x000d000c,0x00000005,0x00000131,0x00000001,0x0000000b,0x0000012f,
-	0x0000000a,0x00000023,0x0000012b,0x0000012b,0x0000000d,0x0000000d,0x0000000e,0x000d000c,
-	0x00000005,0x00000132,0x00000001,0x0000000b,0x0000012f,0x0000000a,0x00000023,0x0000012b,
-	0x0000012b,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x00000133,0x00000001,
-	0x0000000b,0x0000012f,0x0000000a,0x00000023,0x0000012b,0x0000012b,0x0000000d,0x0000000d,
-	0x0000000e,0x000d000c,0x00000005,0x00000134,0x00000001,0x0000000b,0x0000012f,0x0000000a,
-	0x00000023,0x0000012b,0x0000012b,0x0000000d,0x0000000d,0x0000000e,0x0017000c,0x00000005,
-	0x00000135,0x00000001,0x0000000a,0x00000136,0x00000027,0x00000023,0x00000124,0x0000000d,
-	0x00000026,0x00000136,0x0000000d,0x0000000e,0x00000129,0x0000012c,0x0000012d,0x0000012e,
-	0x00000130,0x00000131,0x00000132,0x00000133,0x00000134,0x00040020,0x00000137,0x00000009,
-	0x00000128,0x0004002b,0x00000008,0x00000138,0x00000009,0x0008000c,0x00000005,0x00000139,
-	0x00000001,0x00000003,0x00000135,0x00000138,0x0000000d,0x0004003b,0x00000137,0x0000013a,
-	0x00000009,0x000e000c,0x00000005,0x0000013b,0x00000001,0x00000012,0x0000013c,0x00000135,
-	0x00000023,0x00000124,0x0000000d,0x00000026,0x0000013c,0x0000013a,0x0000011a,0x00040015,
-	0x0000013d,0x00000020,0x00000001,0x0009000c,0x00000005,0x0000013f,0x00000001,0x00000002,
-	0x0000013e,0x0000000b,0x00000028,0x0000000d,0x0004002b,0x0000013d,0x00000140,0x00000001,
-	0x00040020,0x00000141,0x00000009,0x00000014,0x0008000c,0x00000005,0x00000142,0x00000001,
-	0x00000003,0x00000016,0x00000138,0x0000000d,0x00040020,0x00000148,0x00000007,0x00000008,
-	0x0008000c,0x00000005,0x00000149,0x00000001,0x00000003,0x0000000a,0x00000018,0x0000000d,
-	0x0004002b,0x00000008,0x0000014d,0x00000030,0x000c000c,0x00000005,0x0000014b,0x00000001,
-	0x0000001a,0x0000014c,0x0000000a,0x00000023,0x0000014d,0x0000000d,0x00000036,0x00000028,
-	0x0004002b,0x0000013d,0x00000154,0x00000004,0x00040020,0x00000155,0x00000009,0x00000008,
-	0x0008000c,0x00000005,0x00000156,0x00000001,0x00000003,0x0000000a,0x00000138,0x0000000d,
-	0x00040020,0x0000015b,0x00000007,0x0000013d,0x0008000c,0x00000005,0x0000015c,0x00000001,
-	0x00000003,0x0000013f,0x00000018,0x0000000d,0x0004002b,0x00000008,0x0000015f,0x00000031,
-	0x000c000c,0x00000005,0x0000015e,0x00000001,0x0000001a,0x000000d4,0x0000013f,0x00000023,
-	0x0000015f,0x0000000d,0x00000036,0x00000028,0x00040020,0x00000162,0x00000001,0x00000014,
-	0x0008000c,0x00000005,0x00000163,0x00000001,0x00000003,0x00000016,0x00000027,0x0000000d,
-	0x0004003b,0x00000162,0x00000164,0x00000001,0x000e000c,0x00000005,0x00000165,0x00000001,
-	0x00000012,0x00000166,0x00000016,0x00000023,0x0000015f,0x0000000d,0x00000026,0x00000166,
-	0x00000164,0x0000011a,0x0004003b,0x00000162,0x00000167,0x00000001,0x000e000c,0x00000005,
-	0x00000168,0x00000001,0x00000012,0x00000169,0x00000016,0x00000023,0x0000015f,0x0000000d,
-	0x00000026,0x00000169,0x00000167,0x0000011a,0x0004002b,0x00000011,0x00000171,0x43800000,
-	0x0003001d,0x00000174,0x0000013d,0x0007000c,0x00000005,0x00000175,0x00000001,0x00000005,
-	0x0000013f,0x0000000d,0x0003001e,0x00000176,0x00000174,0x000d000c,0x00000005,0x00000177,
-	0x00000001,0x0000000b,0x00000178,0x00000175,0x00000023,0x0000012b,0x00000138,0x0000000d,
-	0x0000000d,0x0000000e,0x0004002b,0x00000008,0x0000017b,0x00000032,0x000f000c,0x00000005,
-	0x00000179,0x00000001,0x0000000a,0x0000017a,0x00000027,0x00000023,0x0000017b,0x0000000d,
-	0x00000026,0x0000017a,0x0000000d,0x0000000e,0x00000177,0x00040020,0x0000017c,0x00000002,
-	0x00000176,0x0008000c,0x00000005,0x0000017d,0x00000001,0x00000003,0x00000179,0x00000015,
-	0x0000000d,0x0004003b,0x0000017c,0x0000017e,0x00000002,0x000e000c,0x00000005,0x0000017f,
-	0x00000001,0x00000012,0x0000013c,0x00000179,0x00000023,0x0000017b,0x0000000d,0x00000026,
-	0x0000013c,0x0000017e,0x0000011a,0x0004002b,0x0000013d,0x00000180,0x00000000,0x0004002b,
-	0x0000013d,0x00000181,0x00000005,0x00040020,0x00000187,0x00000002,0x0000013d,0x0008000c,
-	0x00000005,0x00000188,0x00000001,0x00000003,0x0000013f,0x00000015,0x0000000d,0x0004002b,
-	0x00000008,0x0000018d,0x00000033,0x00050036,0x00000005,0x0000000f,0x00000000,0x00000006,
-	0x000200f8,0x00000010,0x0004003b,0x00000017,0x0000010f,0x00000007,0x0004003b,0x0000011f,
-	0x00000121,0x00000007,0x0004003b,0x00000148,0x0000014a,0x00000007,0x0004003b,0x0000015b,
-	0x0000015d,0x00000007,0x0004003b,0x00000017,0x0000016a,0x00000007,0x0004003b,0x00000017,
-	0x0000016c,0x00000007,0x0004003b,0x00000017,0x0000016e,0x00000007,0x0006000c,0x00000005,
-	0x0000010d,0x00000001,0x00000017,0x00000036,0x000a000c,0x00000005,0x0000010e,0x00000001,
-	0x00000067,0x00000023,0x00000037,0x00000037,0x0000000d,0x0000000d,0x0007000c,0x00000005,
-	0x0000010c,0x00000001,0x00000065,0x00000036,0x0000000f,0x000a000c,0x00000005,0x00000114,
-	0x00000001,0x00000067,0x00000023,0x00000112,0x00000112,0x0000000d,0x0000000d,0x0008000c,
-	0x00000005,0x00000113,0x00000001,0x0000001c,0x00000110,0x0000010f,0x0000002c,0x0004003d,
-	0x000000ae,0x0000011b,0x00000117,0x0007004f,0x00000014,0x0000011c,0x0000011b,0x0000011b,
-	0x00000000,0x00000001,0x0003003e,0x0000010f,0x0000011c,0x000a000c,0x00000005,0x00000126,
-	0x00000001,0x00000067,0x00000023,0x00000124,0x00000124,0x0000000d,0x0000000d,0x0008000c,
-	0x00000005,0x00000125,0x00000001,0x0000001c,0x00000122,0x00000121,0x0000002c,0x0004003d,
-	0x00000014,0x00000127,0x0000010f,0x00050041,0x00000141,0x00000143,0x0000013a,0x00000140,
-	0x0004003d,0x00000014,0x00000144,0x00000143,0x0006000c,0x00000014,0x00000145,0x00000004,
-	0x00000008,0x00000144,0x00050083,0x00000014,0x00000146,0x00000127,0x00000145,0x0004006d,
-	0x0000011d,0x00000147,0x00000146,0x0003003e,0x00000121,0x00000147,0x000a000c,0x00000005,
-	0x0000014f,0x00000001,0x00000067,0x00000023,0x0000014d,0x0000014d,0x0000000d,0x0000000d,
-	0x0008000c,0x00000005,0x0000014e,0x00000001,0x0000001c,0x0000014b,0x0000014a,0x0000002c,
-	0x00050041,0x00000148,0x00000150,0x00000121,0x0000000d,0x0004003d,0x00000008,0x00000151,
-	0x00000150,0x00050041,0x00000148,0x00000152,0x00000121,0x00000027,0x0004003d,0x00000008,
-	0x00000153,0x00000152,0x00050041,0x00000155,0x00000157,0x0000013a,0x00000154,0x0004003d,
-	0x00000008,0x00000158,0x00000157,0x00050084,0x00000008,0x00000159,0x00000153,0x00000158,
-	0x00050080,0x00000008,0x0000015a,0x00000151,0x00000159,0x0003003e,0x0000014a,0x0000015a,
-	0x000a000c,0x00000005,0x00000161,0x00000001,0x00000067,0x00000023,0x0000015f,0x0000015f,
-	0x0000000d,0x0000000d,0x0008000c,0x00000005,0x00000160,0x00000001,0x0000001c,0x0000015e,
-	0x0000015d,0x0000002c,0x0004003d,0x00000014,0x0000016b,0x0000010f,0x0003003e,0x0000016a,
-	0x0000016b,0x0004003d,0x00000014,0x0000016d,0x00000164,0x0003003e,0x0000016c,0x0000016d,
-	0x0004003d,0x00000014,0x0000016f,0x00000167,0x0003003e,0x0000016e,0x0000016f,0x00070039,
-	0x00000011,0x00000170,0x0000001f,0x0000016a,0x0000016c,0x0000016e,0x00050085,0x00000011,
-	0x00000172,0x00000170,0x00000171,0x0004006e,0x0000013d,0x00000173,0x00000172,0x0003003e,
-	0x0000015d,0x00000173,0x000a000c,0x00000005,0x00000183,0x00000001,0x00000067,0x00000023,
-	0x0000017b,0x0000017b,0x0000000d,0x0000000d,0x00050041,0x00000155,0x00000182,0x0000013a,
-	0x00000181,0x0004003d,0x00000008,0x00000184,0x00000182,0x0004003d,0x00000008,0x00000185,
-	0x0000014a,0x00050080,0x00000008,0x00000186,0x00000184,0x00000185,0x00060041,0x00000187,
-	0x00000189,0x0000017e,0x00000180,0x00000186,0x0004003d,0x0000013d,0x0000018a,0x0000015d,
-	0x000700ea,0x0000013d,0x0000018b,0x00000189,0x00000027,0x0000000d,0x0000018a,0x000a000c,
-	0x00000005,0x0000018c,0x00000001,0x00000067,0x00000023,0x0000018d,0x0000018d,0x0000000d,
-	0x0000000d,0x000100fd,0x00010038,0x00050036,0x00000011,0x0000001f,0x00000000,0x0000001a,
-	0x00030037,0x00000017,0x0000001c,0x00030037,0x00000017,0x0000001d,0x00030037,0x00000017,
-	0x0000001e,0x000200f8,0x00000020,0x0004003b,0x00000017,0x00000039,0x00000007,0x0004003b,
-	0x00000017,0x00000042,0x00000007,0x0004003b,0x00000017,0x0000004b,0x00000007,0x0004003b,
-	0x00000051,0x0000005d,0x00000007,0x0004003b,0x00000017,0x00000068,0x00000007,0x0004003b,
-	0x00000051,0x0000007d,0x00000007,0x0004003b,0x00000051,0x00000089,0x00000007,0x0004003b,
-	0x00000051,0x00000095,0x00000007,0x0004003b,0x00000051,0x000000a4,0x00000007,0x0004003b,
-	0x000000b0,0x000000b2,0x00000007,0x0004003b,0x00000051,0x000000d2,0x00000007,0x0004003b,
-	0x00000051,0x000000ef,0x00000007,0x0006000c,0x00000005,0x0000002d,0x00000001,0x00000017,
-	0x00000022,0x000a000c,0x00000005,0x0000002e,0x00000001,0x00000067,0x00000023,0x00000025,
-	0x00000025,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x0000002b,0x00000001,0x0000001c,
-	0x00000029,0x0000001c,0x0000002c,0x0008000c,0x00000005,0x00000031,0x00000001,0x0000001c,
-	0x0000002f,0x0000001d,0x0000002c,0x0008000c,0x00000005,0x00000034,0x00000001,0x0000001c,
-	0x00000032,0x0000001e,0x0000002c,0x0007000c,0x00000005,0x00000038,0x00000001,0x00000065,
-	0x00000022,0x0000001f,0x000a000c,0x00000005,0x0000003e,0x00000001,0x00000067,0x00000023,
-	0x0000003c,0x0000003c,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x0000003d,0x00000001,
-	0x0000001c,0x0000003a,0x00000039,0x0000002c,0x0004003d,0x00000014,0x0000003f,0x0000001d,
-	0x0004003d,0x00000014,0x00000040,0x0000001c,0x00050083,0x00000014,0x00000041,0x0000003f,
-	0x00000040,0x0003003e,0x00000039,0x00000041,0x000a000c,0x00000005,0x00000047,0x00000001,
-	0x00000067,0x00000023,0x00000045,0x00000045,0x0000000d,0x0000000d,0x0008000c,0x00000005,
-	0x00000046,0x00000001,0x0000001c,0x00000043,0x00000042,0x0000002c,0x0004003d,0x00000014,
-	0x00000048,0x0000001e,0x0004003d,0x00000014,0x00000049,0x0000001c,0x00050083,0x00000014,
-	0x0000004a,0x00000048,0x00000049,0x0003003e,0x00000042,0x0000004a,0x000a000c,0x00000005,
-	0x00000050,0x00000001,0x00000067,0x00000023,0x0000004e,0x0000004e,0x0000000d,0x0000000d,
-	0x0008000c,0x00000005,0x0000004f,0x00000001,0x0000001c,0x0000004c,0x0000004b,0x0000002c,
-	0x00050041,0x00000051,0x00000053,0x00000039,0x0000000d,0x0004003d,0x00000011,0x00000054,
-	0x00000053,0x00050041,0x00000051,0x00000055,0x00000042,0x0000000d,0x0004003d,0x00000011,
-	0x00000056,0x00000055,0x00050050,0x00000014,0x00000057,0x00000054,0x00000056,0x00050050,
-	0x00000014,0x0000005a,0x00000058,0x00000058,0x00050050,0x00000014,0x0000005b,0x00000059,
-	0x00000059,0x0008000c,0x00000014,0x0000005c,0x00000004,0x0000002b,0x00000057,0x0000005a,
-	0x0000005b,0x0003003e,0x0000004b,0x0000005c,0x000a000c,0x00000005,0x00000062,0x00000001,
-	0x00000067,0x00000023,0x00000060,0x00000060,0x0000000d,0x0000000d,0x0008000c,0x00000005,
-	0x00000061,0x00000001,0x0000001c,0x0000005e,0x0000005d,0x0000002c,0x00050041,0x00000051,
-	0x00000063,0x0000004b,0x00000027,0x0004003d,0x00000011,0x00000064,0x00000063,0x00050041,
-	0x00000051,0x00000065,0x0000004b,0x0000000d,0x0004003d,0x00000011,0x00000066,0x00000065,
-	0x00050083,0x00000011,0x00000067,0x00000064,0x00000066,0x0003003e,0x0000005d,0x00000067,
-	0x000a000c,0x00000005,0x0000006d,0x00000001,0x00000067,0x00000023,0x0000006b,0x0000006b,
-	0x0000000d,0x0000000d,0x0008000c,0x00000005,0x0000006c,0x00000001,0x0000001c,0x00000069,
-	0x00000068,0x0000002c,0x0004003d,0x00000014,0x0000006e,0x00000042,0x0004003d,0x00000014,
-	0x0000006f,0x00000039,0x00050083,0x00000014,0x00000070,0x0000006e,0x0000006f,0x0003003e,
-	0x00000068,0x00000070,0x000a000c,0x00000005,0x00000072,0x00000001,0x00000067,0x00000023,
-	0x0000000b,0x0000000b,0x0000000d,0x0000000d,0x00050041,0x00000051,0x00000071,0x00000068,
-	0x00000027,0x0004003d,0x00000011,0x00000073,0x00000071,0x0006000c,0x00000011,0x00000074,
-	0x00000004,0x00000004,0x00000073,0x000500ba,0x00000076,0x00000079,0x00000074,0x00000075,
-	0x000300f7,0x0000007b,0x00000000,0x000400fa,0x00000079,0x0000007a,0x0000007b,0x000200f8,
-	0x0000007a,0x0006000c,0x00000005,0x00000082,0x00000001,0x00000017,0x0000007c,0x000a000c,
-	0x00000005,0x00000083,0x00000001,0x00000067,0x00000023,0x00000080,0x00000080,0x0000000d,
-	0x0000000d,0x0008000c,0x00000005,0x00000081,0x00000001,0x0000001c,0x0000007e,0x0000007d,
-	0x0000002c,0x00050041,0x00000051,0x00000084,0x00000068,0x00000027,0x0004003d,0x00000011,
-	0x00000085,0x00000084,0x00050041,0x00000051,0x00000086,0x00000068,0x0000000d,0x0004003d,
-	0x00000011,0x00000087,0x00000086,0x00050088,0x00000011,0x00000088,0x00000085,0x00000087,
-	0x0003003e,0x0000007d,0x00000088,0x000a000c,0x00000005,0x0000008e,0x00000001,0x00000067,
-	0x00000023,0x0000008c,0x0000008c,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x0000008d,
-	0x00000001,0x0000001c,0x0000008a,0x00000089,0x0000002c,0x00050041,0x00000051,0x0000008f,
-	0x0000004b,0x0000000d,0x0004003d,0x00000011,0x00000090,0x0000008f,0x00050041,0x00000051,
-	0x00000091,0x0000004b,0x00000027,0x0004003d,0x00000011,0x00000092,0x00000091,0x00050081,
-	0x00000011,0x00000093,0x00000090,0x00000092,0x00050085,0x00000011,0x00000094,0x00000059,
-	0x00000093,0x0003003e,0x00000089,0x00000094,0x000a000c,0x00000005,0x0000009a,0x00000001,
-	0x00000067,0x00000023,0x00000098,0x00000098,0x0000000d,0x0000000d,0x0008000c,0x00000005,
-	0x00000099,0x00000001,0x0000001c,0x00000096,0x00000095,0x0000002c,0x00050041,0x00000051,
-	0x0000009b,0x00000039,0x00000027,0x0004003d,0x00000011,0x0000009c,0x0000009b,0x0004003d,
-	0x00000011,0x0000009d,0x00000089,0x00050041,0x00000051,0x0000009e,0x00000039,0x0000000d,
-	0x0004003d,0x00000011,0x0000009f,0x0000009e,0x00050083,0x00000011,0x000000a0,0x0000009d,
-	0x0000009f,0x0004003d,0x00000011,0x000000a1,0x0000007d,0x00050085,0x00000011,0x000000a2,
-	0x000000a0,0x000000a1,0x00050081,0x00000011,0x000000a3,0x0000009c,0x000000a2,0x0003003e,
-	0x00000095,0x000000a3,0x000a000c,0x00000005,0x000000a9,0x00000001,0x00000067,0x00000023,
-	0x000000a7,0x000000a7,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x000000a8,0x00000001,
-	0x0000001c,0x000000a5,0x000000a4,0x0000002c,0x0004003d,0x00000011,0x000000aa,0x0000007d,
-	0x0004003d,0x00000011,0x000000ab,0x0000005d,0x00050085,0x00000011,0x000000ac,0x000000aa,
-	0x000000ab,0x0006000c,0x00000011,0x000000ad,0x00000004,0x00000004,0x000000ac,0x0003003e,
-	0x000000a4,0x000000ad,0x000a000c,0x00000005,0x000000b7,0x00000001,0x00000067,0x00000023,
-	0x000000b5,0x000000b5,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x000000b6,0x00000001,
-	0x0000001c,0x000000b3,0x000000b2,0x0000002c,0x0004003d,0x00000011,0x000000b8,0x00000095,
-	0x0004003d,0x00000011,0x000000b9,0x000000a4,0x00050085,0x00000011,0x000000ba,0x00000059,
-	0x000000b9,0x00050081,0x00000011,0x000000bb,0x000000b8,0x000000ba,0x0004003d,0x00000011,
-	0x000000bc,0x00000095,0x0004003d,0x00000011,0x000000bd,0x000000a4,0x00050085,0x00000011,
-	0x000000be,0x00000059,0x000000bd,0x00050083,0x00000011,0x000000bf,0x000000bc,0x000000be,
-	0x0004003d,0x00000011,0x000000c0,0x00000095,0x00050083,0x00000011,0x000000c1,0x00000059,
-	0x000000c0,0x0004003d,0x00000011,0x000000c2,0x000000a4,0x00050088,0x00000011,0x000000c3,
-	0x000000c1,0x000000c2,0x0004003d,0x00000011,0x000000c4,0x00000095,0x00050083,0x00000011,
-	0x000000c5,0x00000058,0x000000c4,0x0004003d,0x00000011,0x000000c6,0x000000a4,0x00050088,
-	0x00000011,0x000000c7,0x000000c5,0x000000c6,0x00070050,0x000000ae,0x000000c8,0x000000bb,
-	0x000000bf,0x000000c3,0x000000c7,0x0003003e,0x000000b2,0x000000c8,0x000a000c,0x00000005,
-	0x000000ca,0x00000001,0x00000067,0x00000023,0x000000cb,0x000000cb,0x0000000d,0x0000000d,
-	0x0004003d,0x000000ae,0x000000c9,0x000000b2,0x00070050,0x000000ae,0x000000cc,0x00000059,
-	0x00000059,0x00000059,0x00000059,0x00050081,0x000000ae,0x000000cd,0x000000c9,0x000000cc,
-	0x00070050,0x000000ae,0x000000cf,0x00000075,0x00000075,0x00000075,0x00000075,0x00070050,
-	0x000000ae,0x000000d0,0x000000ce,0x000000ce,0x000000ce,0x000000ce,0x0008000c,0x000000ae,
-	0x000000d1,0x00000004,0x0000002b,0x000000cd,0x000000cf,0x000000d0,0x0003003e,0x000000b2,
-	0x000000d1,0x000a000c,0x00000005,0x000000d7,0x00000001,0x00000067,0x00000023,0x000000d5,
-	0x000000d5,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x000000d6,0x00000001,0x0000001c,
-	0x000000d3,0x000000d2,0x0000002c,0x00050041,0x00000051,0x000000d8,0x000000b2,0x00000015,
-	0x0004003d,0x00000011,0x000000d9,0x000000d8,0x00050041,0x00000051,0x000000da,0x000000b2,
-	0x00000015,0x0004003d,0x00000011,0x000000db,0x000000da,0x00050041,0x00000051,0x000000dc,
-	0x000000b2,0x00000027,0x0004003d,0x00000011,0x000000dd,0x000000dc,0x00050085,0x00000011,
-	0x000000de,0x000000db,0x000000dd,0x00050083,0x00000011,0x000000df,0x000000d9,0x000000de,
-	0x00050083,0x00000011,0x000000e0,0x000000df,0x000000ce,0x00050041,0x00000051,0x000000e1,
-	0x000000b2,0x0000000d,0x0004003d,0x00000011,0x000000e2,0x000000e1,0x00050083,0x00000011,
-	0x000000e3,0x000000e0,0x000000e2,0x00050041,0x00000051,0x000000e4,0x000000b2,0x0000000d,
-	0x0004003d,0x00000011,0x000000e5,0x000000e4,0x00050041,0x00000051,0x000000e6,0x000000b2,
-	0x0000000e,0x0004003d,0x00000011,0x000000e7,0x000000e6,0x00050085,0x00000011,0x000000e8,
-	0x000000e5,0x000000e7,0x00050081,0x00000011,0x000000e9,0x000000e3,0x000000e8,0x00050085,
-	0x00000011,0x000000ea,0x00000059,0x000000e9,0x0003003e,0x000000d2,0x000000ea,0x000a000c,
-	0x00000005,0x000000ec,0x00000001,0x00000067,0x00000023,0x000000ed,0x000000ed,0x0000000d,
-	0x0000000d,0x0004003d,0x00000011,0x000000eb,0x0000005d,0x000500b4,0x00000076,0x000000ee,
-	0x000000eb,0x00000075,0x000300f7,0x000000f1,0x00000000,0x000400fa,0x000000ee,0x000000f0,
-	0x000000f4,0x000200f8,0x000000f0,0x0006000c,0x00000005,0x000000f2,0x00000001,0x00000017,
-	0x0000007c,0x000a000c,0x00000005,0x000000f3,0x00000001,0x00000067,0x00000023,0x000000ed,
-	0x000000ed,0x0000000d,0x0000000d,0x0003003e,0x000000ef,0x00000075,0x000200f9,0x000000f1,
-	0x000200f8,0x000000f4,0x0006000c,0x00000005,0x000000f6,0x00000001,0x00000017,0x0000007c,
-	0x000a000c,0x00000005,0x000000f7,0x00000001,0x00000067,0x00000023,0x000000ed,0x000000ed,
-	0x0000000d,0x0000000d,0x0004003d,0x00000011,0x000000f5,0x000000d2,0x0004003d,0x00000011,
-	0x000000f8,0x0000005d,0x00050085,0x00000011,0x000000f9,0x000000f5,0x000000f8,0x0003003e,
-	0x000000ef,0x000000f9,0x000200f9,0x000000f1,0x000200f8,0x000000f1,0x0006000c,0x00000005,
-	0x000000fb,0x00000001,0x00000017,0x0000007c,0x000a000c,0x00000005,0x000000fc,0x00000001,
-	0x00000067,0x00000023,0x000000ed,0x000000ed,0x0000000d,0x0000000d,0x0004003d,0x00000011,
-	0x000000fa,0x000000ef,0x000200fe,0x000000fa,0x000200f8,0x0000007b,0x0006000c,0x00000005,
-	0x000000ff,0x00000001,0x00000017,0x00000022,0x000a000c,0x00000005,0x00000100,0x00000001,
-	0x00000067,0x00000023,0x00000101,0x00000101,0x0000000d,0x0000000d,0x00050041,0x00000051,
-	0x000000fe,0x00000039,0x00000027,0x0004003d,0x00000011,0x00000102,0x000000fe,0x00050081,
-	0x00000011,0x00000103,0x00000102,0x00000059,0x0008000c,0x00000011,0x00000104,0x00000004,
-	0x0000002b,0x00000103,0x00000075,0x000000ce,0x0004003d,0x00000011,0x00000105,0x0000005d,
-	0x00050085,0x00000011,0x00000106,0x00000104,0x00000105,0x000200fe,0x00000106,0x00010038
-};
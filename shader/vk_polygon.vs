@@ -9,12 +9,60 @@ layout(set = 0, binding = 0) readonly buffer VertexBuffer {
 
 layout(location = 0) out vec2 va;
 layout(location = 1) out vec2 vb;
+#ifdef IVG_CURVES
+layout(location = 2) flat out vec2 vc;
+#endif
+#ifdef IVG_BACKDROP
+layout(location = 3) flat out float first_row;
+#endif
+#ifdef IVG_BATCH
+layout(location = 4) flat out uint draw_id;
+
+#ifdef IVG_CURVES
+#define SEGMENT_BASE curve_base
+#else
+#define SEGMENT_BASE line_base
+#endif
+
+// Draw of the batch a segment belongs to, segment bases only grow within a batch
+uint find_draw(uint segment) {
+    uint lo = batch_first;
+    uint hi = batch_first + batch_count;
+    while (hi - lo > 1u) {
+        uint mid = (lo + hi) / 2u;
+        if (batch_draws[mid].SEGMENT_BASE <= segment) lo = mid; else hi = mid;
+    }
+    return lo;
+}
+#endif
 
 void main() {
-    uint instance = gl_VertexIndex / 6 + vtx_offset;
+#ifdef IVG_BATCH
+    // One instance per segment of the batch
+    draw_id = find_draw(gl_InstanceIndex);
+    load_draw(draw_id);
+    uint index = gl_VertexIndex;
+    uint segment = gl_InstanceIndex - batch_draws[draw_id].SEGMENT_BASE;
+#else
     uint index = gl_VertexIndex % 6;
-    vec2 v0 = vertex_input.points[instance];
-    vec2 v1 = vertex_input.points[instance + 1];
+    uint segment = gl_VertexIndex / 6;
+#endif
+#ifdef IVG_CURVES
+    // Quadratic segments share their end points, segment i is points[2i], points[2i + 1], points[2i + 2]
+    uint instance = segment * 2 + vtx_offset;
+    vec2 v0 = vertex_input.points[instance] + translation;
+    vec2 control = vertex_input.points[instance + 1] + translation;
+    vec2 v1 = vertex_input.points[instance + 2] + translation;
+    vc = control;
+    float min_y = min(min(v1.y, v0.y), control.y);
+    float max_y = max(max(v1.y, v0.y), control.y);
+#else
+    uint instance = segment + vtx_offset;
+    vec2 v0 = vertex_input.points[instance] + translation;
+    vec2 v1 = vertex_input.points[instance + 1] + translation;
+    float min_y = min(v1.y, v0.y);
+    float max_y = max(v1.y, v0.y);
+#endif
     vec2 window = vec2(v0.x, v1.x);
     va = v0;
     vb = v1;
@@ -25,8 +73,20 @@ void main() {
         v1 = tmp_v0;
     }
 
-    float x = (index & 1) == 1 ? ceil(v1.x) : floor(v0.x);
-    float y = ((index >> (index / 3 + 1)) & 1) == 1 ? ceil(max(v1.y, v0.y)) : floor(min_bb.y);
+    // Kept within the region, the batch shaders draw without the scissor of the clip rect
+    float x = clamp((index & 1) == 1 ? ceil(v1.x) : floor(v0.x), floor(min_bb.x), ceil(max_bb.x));
+#ifdef IVG_BACKDROP
+    // Only the rows the segment crosses and the row below it, where its backdrop starts. A segment above the region
+    // still covers the first row so its backdrop reaches the region, one below it covers nothing.
+    float top = floor(min_bb.y);
+    float bottom = ceil(max_bb.y);
+    float y0 = clamp(floor(min_y), top, bottom);
+    float y1 = max(min(ceil(max_y) + 1.0f, bottom), min(y0 + 1.0f, bottom));
+    float y = ((index >> (index / 3 + 1)) & 1) == 1 ? y1 : y0;
+    first_row = y0;
+#else
+    float y = ((index >> (index / 3 + 1)) & 1) == 1 ? min(ceil(max_y), ceil(max_bb.y)) : floor(min_bb.y);
+#endif
 
     gl_Position.x = x * inv_viewport.x - 1.0f;
     gl_Position.y = y * inv_viewport.y - 1.0f;
@@ -1,317 +0,0 @@
-	// 1115.0.0
-	 #pragma once
-const uint32_t __spirv_vulkan_polygon_vs[] = {
-	0x07230203,0x00010000,0x0008000b,0x00000125,0x00000000,0x00020011,0x00000001,0x0008000a,
-	0x5f565053,0x5f52484b,0x5f6e6f6e,0x616d6573,0x6369746e,0x666e695f,0x0000006f,0x000b000b,
-	0x00000001,0x536e6f4e,0x6e616d65,0x2e636974,0x64616853,0x442e7265,0x67756265,0x6f666e49,
-	0x3030312e,0x00000000,0x0006000b,0x00000004,0x4c534c47,0x6474732e,0x3035342e,0x00000000,
-	0x0003000e,0x00000000,0x00000001,0x0009000f,0x00000000,0x0000000f,0x6e69616d,0x00000000,
-	0x0000002c,0x00000090,0x00000096,0x00000109,0x00060007,0x00000002,0x705f6b76,0x67796c6f,
-	0x762e6e6f,0x00000073,0x00070007,0x00000003,0x6b762f2e,0x6d6f635f,0x2e6e6f6d,0x6c736c67,
-	0x00000069,0x00040007,0x00000009,0x746e6975,0x00000000,0x00040007,0x00000011,0x6e69616d,
-	0x00000000,0x01070007,0x00000014,0x4f202f2f,0x646f4d70,0x50656c75,0x65636f72,0x64657373,
-	0x696c6320,0x20746e65,0x6b6c7576,0x30316e61,0x2f2f0a30,0x4d704f20,0x6c75646f,0x6f725065,
-	0x73736563,0x74206465,0x65677261,0x6e652d74,0x75762076,0x6e616b6c,0x0a302e31,0x4f202f2f,
-	0x646f4d70,0x50656c75,0x65636f72,0x64657373,0x746e6520,0x702d7972,0x746e696f,0x69616d20,
-	0x6c230a6e,0x20656e69,0x76230a31,0x69737265,0x34206e6f,0x63203035,0x0a65726f,0x74786523,
-	0x69736e65,0x47206e6f,0x4f475f4c,0x454c474f,0x636e695f,0x6564756c,0x7269645f,0x69746365,
-	0x3a206576,0x71657220,0x65726975,0x69230a0a,0x756c636e,0x22206564,0x635f6b76,0x6f6d6d6f,
-	0x6c672e6e,0x22696c73,0x616c0a0a,0x74756f79,0x74657328,0x30203d20,0x6962202c,0x6e69646e,
-	0x203d2067,0x72202930,0x6f646165,0x20796c6e,0x66667562,0x56207265,0x65747265,0x66754278,
-	0x20726566,0x20200a7b,0x65762020,0x70203263,0x746e696f,0x3b5d5b73,0x76207d0a,0x65747265,
-	0x6e695f78,0x3b747570,0x616c0a0a,0x74756f79,0x636f6c28,0x6f697461,0x203d206e,0x6f202930,
-	0x76207475,0x20326365,0x0a3b6176,0x6f79616c,0x6c287475,0x7461636f,0x206e6f69,0x2931203d,
-	0x74756f20,0x63657620,0x62762032,0x760a0a3b,0x2064696f,0x6e69616d,0x7b202928,0x2020200a,
-	0x6e697520,0x6e692074,0x6e617473,0x3d206563,0x5f6c6720,0x74726556,0x6e497865,0x20786564,
-	0x2036202f,0x7476202b,0x666f5f78,0x74657366,0x20200a3b,0x69752020,0x6920746e,0x7865646e,
-	0x67203d20,0x65565f6c,0x78657472,0x65646e49,0x20252078,0x200a3b36,0x76202020,0x20326365,
-	0x3d203076,0x72657620,0x5f786574,0x75706e69,0x6f702e74,0x73746e69,0x736e695b,0x636e6174,
-	0x0a3b5d65,0x20202020,0x32636576,0x20317620,0x6576203d,0x78657472,0x706e695f,0x702e7475,
-	0x746e696f,0x6e695b73,0x6e617473,0x2b206563,0x3b5d3120,0x2020200a,0x63657620,0x69772032,
-	0x776f646e,0x76203d20,0x28326365,0x782e3076,0x3176202c,0x3b29782e,0x2020200a,0x20617620,
-	0x3076203d,0x20200a3b,0x62762020,0x76203d20,0x0a0a3b31,0x20202020,0x28206669,0x782e3176,
-	0x76203c20,0x29782e30,0x200a7b20,0x20202020,0x76202020,0x20326365,0x5f706d74,0x3d203076,
-	0x3b307620,0x2020200a,0x20202020,0x20307620,0x3176203d,0x20200a3b,0x20202020,0x31762020,
-	0x74203d20,0x765f706d,0x200a3b30,0x7d202020,0x20200a0a,0x6c662020,0x2074616f,0x203d2078,
-	0x646e6928,0x26207865,0x20293120,0x31203d3d,0x63203f20,0x286c6965,0x782e3176,0x203a2029,
-	0x6f6f6c66,0x30762872,0x3b29782e,0x2020200a,0x6f6c6620,0x79207461,0x28203d20,0x646e6928,
-	0x3e207865,0x6928203e,0x7865646e,0x33202f20,0x31202b20,0x26202929,0x20293120,0x31203d3d,
-	0x63203f20,0x286c6965,0x2878616d,0x792e3176,0x3076202c,0x2929792e,0x66203a20,0x726f6f6c,
-	0x6e696d28,0x2e62625f,0x0a3b2979,0x2020200a,0x5f6c6720,0x69736f50,0x6e6f6974,0x3d20782e,
-	0x2a207820,0x766e6920,0x6569765f,0x726f7077,0x20782e74,0x2e31202d,0x0a3b6630,0x20202020,
-	0x505f6c67,0x7469736f,0x2e6e6f69,0x203d2079,0x202a2079,0x5f766e69,0x77656976,0x74726f70,
-	0x2d20792e,0x302e3120,0x200a3b66,0x67202020,0x6f505f6c,0x69746973,0x7a2e6e6f,0x30203d20,
-	0x0a3b302e,0x20202020,0x505f6c67,0x7469736f,0x2e6e6f69,0x203d2077,0x3b302e31,0x000a7d0a,
-	0x00050007,0x00000022,0x74736e69,0x65636e61,0x00000000,0x00030007,0x00000028,0x00746e69,
-	0x00060007,0x0000002e,0x565f6c67,0x65747265,0x646e4978,0x00007865,0x00040007,0x00000035,
-	0x616f6c66,0x00000074,0x00040007,0x0000003b,0x5f78616d,0x00006262,0x00040007,0x00000040,
-	0x6f6c6f63,0x00000072,0x00040007,0x00000047,0x77617244,0x00646d43,0x00030007,0x0000004d,
-	0x00000000,0x00040007,0x00000056,0x65646e69,0x00000078,0x00030007,0x00000061,0x00003076,
-	0x00040007,0x00000069,0x6e696f70,0x00007374,0x00060007,0x0000006b,0x74726556,0x75427865,
-	0x72656666,0x00000000,0x00060007,0x00000070,0x74726576,0x695f7865,0x7475706e,0x00000000,
-	0x00030007,0x00000079,0x00003176,0x00040007,0x00000083,0x646e6977,0x0000776f,0x00030007,
-	0x00000092,0x00006176,0x00030007,0x00000098,0x00006276,0x00040007,0x000000a3,0x6c6f6f62,
-	0x00000000,0x00040007,0x000000ab,0x5f706d74,0x00003076,0x00030007,0x000000b9,0x00000078,
-	0x00030007,0x000000d4,0x00000079,0x00050007,0x000000fc,0x505f6c67,0x7469736f,0x006e6f69,
-	0x00060007,0x000000fe,0x505f6c67,0x746e696f,0x657a6953,0x00000000,0x00060007,0x00000101,
-	0x435f6c67,0x446c6c75,0x61747369,0x0065636e,0x00060007,0x00000105,0x505f6c67,0x65567265,
-	0x78657472,0x00000000,0x000a0004,0x475f4c47,0x4c474f4f,0x70635f45,0x74735f70,0x5f656c79,
-	0x656e696c,0x7269645f,0x69746365,0x00006576,0x00080004,0x475f4c47,0x4c474f4f,0x6e695f45,
-	0x64756c63,0x69645f65,0x74636572,0x00657669,0x00040005,0x0000000f,0x6e69616d,0x00000000,
-	0x00050005,0x00000020,0x74736e69,0x65636e61,0x00000000,0x00060005,0x0000002c,0x565f6c67,
-	0x65747265,0x646e4978,0x00007865,0x00040005,0x00000039,0x77617244,0x00646d43,0x00070006,
-	0x00000039,0x00000000,0x5f766e69,0x77656976,0x74726f70,0x00000000,0x00050006,0x00000039,
-	0x00000001,0x5f6e696d,0x00006262,0x00050006,0x00000039,0x00000002,0x5f78616d,0x00006262,
-	0x00060006,0x00000039,0x00000003,0x5f787476,0x7366666f,0x00007465,0x00070006,0x00000039,
-	0x00000004,0x646e6977,0x5f676e69,0x69727473,0x00006564,0x00070006,0x00000039,0x00000005,
-	0x646e6977,0x5f676e69,0x7366666f,0x00007465,0x00060006,0x00000039,0x00000006,0x6c6c6966,
-	0x646f6d5f,0x00000065,0x00060006,0x00000039,0x00000007,0x6e696170,0x79745f74,0x00006570,
-	0x00050006,0x00000039,0x00000008,0x6f6c6f63,0x00000072,0x00030005,0x0000004b,0x00000000,
-	0x00040005,0x00000054,0x65646e69,0x00000078,0x00030005,0x0000005f,0x00003076,0x00060005,
-	0x00000067,0x74726556,0x75427865,0x72656666,0x00000000,0x00050006,0x00000067,0x00000000,
-	0x6e696f70,0x00007374,0x00060005,0x0000006e,0x74726576,0x695f7865,0x7475706e,0x00000000,
-	0x00030005,0x00000077,0x00003176,0x00040005,0x00000081,0x646e6977,0x0000776f,0x00030005,
-	0x00000090,0x00006176,0x00030005,0x00000096,0x00006276,0x00040005,0x000000a9,0x5f706d74,
-	0x00003076,0x00030005,0x000000b7,0x00000078,0x00030005,0x000000d2,0x00000079,0x00060005,
-	0x000000fa,0x505f6c67,0x65567265,0x78657472,0x00000000,0x00060006,0x000000fa,0x00000000,
-	0x505f6c67,0x7469736f,0x006e6f69,0x00070006,0x000000fa,0x00000001,0x505f6c67,0x746e696f,
-	0x657a6953,0x00000000,0x00070006,0x000000fa,0x00000002,0x435f6c67,0x4470696c,0x61747369,
-	0x0065636e,0x00070006,0x000000fa,0x00000003,0x435f6c67,0x446c6c75,0x61747369,0x0065636e,
-	0x00030005,0x00000109,0x00000000,0x00040047,0x0000002c,0x0000000b,0x0000002a,0x00030047,
-	0x00000039,0x00000002,0x00050048,0x00000039,0x00000000,0x00000023,0x00000000,0x00050048,
-	0x00000039,0x00000001,0x00000023,0x00000008,0x00050048,0x00000039,0x00000002,0x00000023,
-	0x00000010,0x00050048,0x00000039,0x00000003,0x00000023,0x00000018,0x00050048,0x00000039,
-	0x00000004,0x00000023,0x0000001c,0x00050048,0x00000039,0x00000005,0x00000023,0x00000020,
-	0x00050048,0x00000039,0x00000006,0x00000023,0x00000024,0x00050048,0x00000039,0x00000007,
-	0x00000023,0x00000028,0x00050048,0x00000039,0x00000008,0x00000023,0x0000002c,0x00040047,
-	0x00000065,0x00000006,0x00000008,0x00030047,0x00000067,0x00000003,0x00040048,0x00000067,
-	0x00000000,0x00000018,0x00050048,0x00000067,0x00000000,0x00000023,0x00000000,0x00030047,
-	0x0000006e,0x00000018,0x00040047,0x0000006e,0x00000021,0x00000000,0x00040047,0x0000006e,
-	0x00000022,0x00000000,0x00040047,0x00000090,0x0000001e,0x00000000,0x00040047,0x00000096,
-	0x0000001e,0x00000001,0x00030047,0x000000fa,0x00000002,0x00050048,0x000000fa,0x00000000,
-	0x0000000b,0x00000000,0x00050048,0x000000fa,0x00000001,0x0000000b,0x00000001,0x00050048,
-	0x000000fa,0x00000002,0x0000000b,0x00000003,0x00050048,0x000000fa,0x00000003,0x0000000b,
-	0x00000004,0x00020013,0x00000005,0x00030021,0x00000006,0x00000005,0x00040015,0x00000008,
-	0x00000020,0x00000000,0x0004002b,0x00000008,0x0000000b,0x00000020,0x0004002b,0x00000008,
-	0x0000000c,0x00000006,0x0004002b,0x00000008,0x0000000d,0x00000000,0x0009000c,0x00000005,
-	0x0000000a,0x00000001,0x00000002,0x00000009,0x0000000b,0x0000000c,0x0000000d,0x0004002b,
-	0x00000008,0x0000000e,0x00000003,0x0007000c,0x00000005,0x00000007,0x00000001,0x00000008,
-	0x0000000e,0x00000005,0x0007000c,0x00000005,0x00000013,0x00000001,0x00000023,0x00000002,
-	0x00000014,0x0004002b,0x00000008,0x00000015,0x0000000d,0x0004002b,0x00000008,0x00000017,
-	0x00000001,0x0004002b,0x00000008,0x00000018,0x00000004,0x0004002b,0x00000008,0x00000019,
-	0x00000002,0x0009000c,0x00000005,0x00000016,0x00000001,0x00000001,0x00000017,0x00000018,
-	0x00000013,0x00000019,0x000e000c,0x00000005,0x00000012,0x00000001,0x00000014,0x00000011,
-	0x00000007,0x00000013,0x00000015,0x0000000d,0x00000016,0x00000011,0x0000000e,0x00000015,
-	0x00040020,0x0000001d,0x00000007,0x00000008,0x0004002b,0x00000008,0x0000001e,0x00000007,
-	0x0008000c,0x00000005,0x0000001f,0x00000001,0x00000003,0x0000000a,0x0000001e,0x0000000d,
-	0x0004002b,0x00000008,0x00000023,0x0000000e,0x000c000c,0x00000005,0x00000021,0x00000001,
-	0x0000001a,0x00000022,0x0000000a,0x00000013,0x00000023,0x0000000d,0x00000012,0x00000018,
-	0x0005000c,0x00000005,0x00000025,0x00000001,0x0000001f,0x00040015,0x00000027,0x00000020,
-	0x00000001,0x0009000c,0x00000005,0x00000029,0x00000001,0x00000002,0x00000028,0x0000000b,
-	0x00000018,0x0000000d,0x00040020,0x0000002a,0x00000001,0x00000027,0x0008000c,0x00000005,
-	0x0000002b,0x00000001,0x00000003,0x00000029,0x00000017,0x0000000d,0x0004003b,0x0000002a,
-	0x0000002c,0x00000001,0x0004002b,0x00000008,0x0000002f,0x00000008,0x000e000c,0x00000005,
-	0x0000002d,0x00000001,0x00000012,0x0000002e,0x00000029,0x00000013,0x00000023,0x0000000d,
-	0x00000016,0x0000002e,0x0000002c,0x0000002f,0x0004002b,0x00000027,0x00000031,0x00000006,
-	0x00030016,0x00000034,0x00000020,0x0009000c,0x00000005,0x00000036,0x00000001,0x00000002,
-	0x00000035,0x0000000b,0x0000000e,0x0000000d,0x00040017,0x00000037,0x00000034,0x00000002,
-	0x0007000c,0x00000005,0x00000038,0x00000001,0x00000006,0x00000036,0x00000019,0x000b001e,
-	0x00000039,0x00000037,0x00000037,0x00000037,0x00000008,0x00000008,0x00000008,0x00000008,
-	0x00000008,0x00000008,0x0004002b,0x00000008,0x0000003c,0x0000000a,0x000d000c,0x00000005,
-	0x0000003a,0x00000001,0x0000000b,0x0000003b,0x00000038,0x00000013,0x00000018,0x0000003c,
-	0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x0000003d,0x00000001,0x0000000b,
-	0x0000003b,0x00000038,0x00000013,0x00000018,0x0000003c,0x0000000d,0x0000000d,0x0000000e,
-	0x000d000c,0x00000005,0x0000003e,0x00000001,0x0000000b,0x0000003b,0x00000038,0x00000013,
-	0x00000018,0x0000003c,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x0000003f,
-	0x00000001,0x0000000b,0x00000040,0x0000000a,0x00000013,0x0000003c,0x0000003c,0x0000000d,
-	0x0000000d,0x0000000e,0x000d000c,0x00000005,0x00000041,0x00000001,0x0000000b,0x00000040,
-	0x0000000a,0x00000013,0x0000003c,0x0000003c,0x0000000d,0x0000000d,0x0000000e,0x000d000c,
-	0x00000005,0x00000042,0x00000001,0x0000000b,0x00000040,0x0000000a,0x00000013,0x0000003c,
-	0x0000003c,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,0x00000043,0x00000001,
-	0x0000000b,0x00000040,0x0000000a,0x00000013,0x0000003c,0x0000003c,0x0000000d,0x0000000d,
-	0x0000000e,0x000d000c,0x00000005,0x00000044,0x00000001,0x0000000b,0x00000040,0x0000000a,
-	0x00000013,0x0000003c,0x0000003c,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,
-	0x00000045,0x00000001,0x0000000b,0x00000040,0x0000000a,0x00000013,0x0000003c,0x0000003c,
-	0x0000000d,0x0000000d,0x0000000e,0x0017000c,0x00000005,0x00000046,0x00000001,0x0000000a,
-	0x00000047,0x00000017,0x00000013,0x00000023,0x0000000d,0x00000016,0x00000047,0x0000000d,
-	0x0000000e,0x0000003a,0x0000003d,0x0000003e,0x0000003f,0x00000041,0x00000042,0x00000043,
-	0x00000044,0x00000045,0x00040020,0x00000048,0x00000009,0x00000039,0x0004002b,0x00000008,
-	0x00000049,0x00000009,0x0008000c,0x00000005,0x0000004a,0x00000001,0x00000003,0x00000046,
-	0x00000049,0x0000000d,0x0004003b,0x00000048,0x0000004b,0x00000009,0x000e000c,0x00000005,
-	0x0000004c,0x00000001,0x00000012,0x0000004d,0x00000046,0x00000013,0x00000023,0x0000000d,
-	0x00000016,0x0000004d,0x0000004b,0x0000002f,0x0004002b,0x00000027,0x0000004e,0x00000003,
-	0x00040020,0x0000004f,0x00000009,0x00000008,0x0008000c,0x00000005,0x00000050,0x00000001,
-	0x00000003,0x0000000a,0x00000049,0x0000000d,0x0004002b,0x00000008,0x00000057,0x0000000f,
-	0x000c000c,0x00000005,0x00000055,0x00000001,0x0000001a,0x00000056,0x0000000a,0x00000013,
-	0x00000057,0x0000000d,0x00000012,0x00000018,0x00040020,0x0000005d,0x00000007,0x00000037,
-	0x0008000c,0x00000005,0x0000005e,0x00000001,0x00000003,0x00000038,0x0000001e,0x0000000d,
-	0x0004002b,0x00000008,0x00000062,0x00000010,0x000c000c,0x00000005,0x00000060,0x00000001,
-	0x0000001a,0x00000061,0x00000038,0x00000013,0x00000062,0x0000000d,0x00000012,0x00000018,
-	0x0003001d,0x00000065,0x00000037,0x0007000c,0x00000005,0x00000066,0x00000001,0x00000005,
-	0x00000038,0x0000000d,0x0003001e,0x00000067,0x00000065,0x000d000c,0x00000005,0x00000068,
-	0x00000001,0x0000000b,0x00000069,0x00000066,0x00000013,0x0000001e,0x0000003c,0x0000000d,
-	0x0000000d,0x0000000e,0x000f000c,0x00000005,0x0000006a,0x00000001,0x0000000a,0x0000006b,
-	0x00000017,0x00000013,0x00000062,0x0000000d,0x00000016,0x0000006b,0x0000000d,0x0000000e,
-	0x00000068,0x00040020,0x0000006c,0x00000002,0x00000067,0x0008000c,0x00000005,0x0000006d,
-	0x00000001,0x00000003,0x0000006a,0x00000019,0x0000000d,0x0004003b,0x0000006c,0x0000006e,
-	0x00000002,0x000e000c,0x00000005,0x0000006f,0x00000001,0x00000012,0x00000070,0x0000006a,
-	0x00000013,0x00000062,0x0000000d,0x00000016,0x00000070,0x0000006e,0x0000002f,0x0004002b,
-	0x00000027,0x00000071,0x00000000,0x00040020,0x00000073,0x00000002,0x00000037,0x0008000c,
-	0x00000005,0x00000074,0x00000001,0x00000003,0x00000038,0x00000019,0x0000000d,0x0004002b,
-	0x00000008,0x0000007a,0x00000011,0x000c000c,0x00000005,0x00000078,0x00000001,0x0000001a,
-	0x00000079,0x00000038,0x00000013,0x0000007a,0x0000000d,0x00000012,0x00000018,0x0004002b,
-	0x00000008,0x00000084,0x00000012,0x000c000c,0x00000005,0x00000082,0x00000001,0x0000001a,
-	0x00000083,0x00000038,0x00000013,0x00000084,0x0000000d,0x00000012,0x00000018,0x00040020,
-	0x00000087,0x00000007,0x00000034,0x0008000c,0x00000005,0x00000088,0x00000001,0x00000003,
-	0x00000036,0x0000001e,0x0000000d,0x00040020,0x0000008e,0x00000003,0x00000037,0x0008000c,
-	0x00000005,0x0000008f,0x00000001,0x00000003,0x00000038,0x0000000e,0x0000000d,0x0004003b,
-	0x0000008e,0x00000090,0x00000003,0x0004002b,0x00000008,0x00000093,0x00000013,0x000e000c,
-	0x00000005,0x00000091,0x00000001,0x00000012,0x00000092,0x00000038,0x00000013,0x00000093,
-	0x0000000d,0x00000016,0x00000092,0x00000090,0x0000002f,0x0004003b,0x0000008e,0x00000096,
-	0x00000003,0x0004002b,0x00000008,0x00000099,0x00000014,0x000e000c,0x00000005,0x00000097,
-	0x00000001,0x00000012,0x00000098,0x00000038,0x00000013,0x00000099,0x0000000d,0x00000016,
-	0x00000098,0x00000096,0x0000002f,0x0004002b,0x00000008,0x0000009e,0x00000016,0x00020014,
-	0x000000a2,0x0009000c,0x00000005,0x000000a4,0x00000001,0x00000002,0x000000a3,0x0000000b,
-	0x00000019,0x0000000d,0x0009000c,0x00000005,0x000000a8,0x00000001,0x00000015,0x00000013,
-	0x0000000d,0x0000000d,0x00000012,0x0004002b,0x00000008,0x000000ac,0x00000017,0x000c000c,
-	0x00000005,0x000000aa,0x00000001,0x0000001a,0x000000ab,0x00000038,0x00000013,0x000000ac,
-	0x0000000d,0x000000a8,0x00000018,0x0004002b,0x00000008,0x000000b3,0x00000018,0x0004002b,
-	0x00000008,0x000000b6,0x00000019,0x0004002b,0x00000008,0x000000ba,0x0000001c,0x000c000c,
-	0x00000005,0x000000b8,0x00000001,0x0000001a,0x000000b9,0x00000036,0x00000013,0x000000ba,
-	0x0000000d,0x00000012,0x00000018,0x0004002b,0x00000008,0x000000d5,0x0000001d,0x000c000c,
-	0x00000005,0x000000d3,0x00000001,0x0000001a,0x000000d4,0x00000036,0x00000013,0x000000d5,
-	0x0000000d,0x00000012,0x00000018,0x0004002b,0x00000027,0x000000eb,0x00000001,0x00040020,
-	0x000000ec,0x00000009,0x00000034,0x0008000c,0x00000005,0x000000ed,0x00000001,0x00000003,
-	0x00000036,0x00000049,0x0000000d,0x00040017,0x000000f6,0x00000034,0x00000004,0x0007000c,
-	0x00000005,0x000000f7,0x00000001,0x00000006,0x00000036,0x00000018,0x0004001c,0x000000f8,
-	0x00000034,0x00000017,0x0007000c,0x00000005,0x000000f9,0x00000001,0x00000005,0x00000036,
-	0x00000017,0x0006001e,0x000000fa,0x000000f6,0x00000034,0x000000f8,0x000000f8,0x000d000c,
-	0x00000005,0x000000fb,0x00000001,0x0000000b,0x000000fc,0x000000f7,0x00000013,0x00000017,
-	0x000000b3,0x0000000d,0x0000000d,0x0000000e,0x0004002b,0x00000008,0x000000ff,0x0000002a,
-	0x000d000c,0x00000005,0x000000fd,0x00000001,0x0000000b,0x000000fe,0x00000036,0x00000013,
-	0x00000017,0x000000ff,0x0000000d,0x0000000d,0x0000000e,0x0004002b,0x00000008,0x00000102,
-	0x00000055,0x000d000c,0x00000005,0x00000100,0x00000001,0x0000000b,0x00000101,0x000000f9,
-	0x00000013,0x00000017,0x00000102,0x0000000d,0x0000000d,0x0000000e,0x000d000c,0x00000005,
-	0x00000103,0x00000001,0x0000000b,0x00000101,0x000000f9,0x00000013,0x00000017,0x00000102,
-	0x0000000d,0x0000000d,0x0000000e,0x0004002b,0x00000008,0x00000106,0x0000001f,0x0012000c,
-	0x00000005,0x00000104,0x00000001,0x0000000a,0x00000105,0x00000017,0x00000013,0x00000106,
-	0x0000000d,0x00000016,0x00000105,0x0000000d,0x0000000e,0x000000fb,0x000000fd,0x00000100,
-	0x00000103,0x00040020,0x00000107,0x00000003,0x000000fa,0x0008000c,0x00000005,0x00000108,
-	0x00000001,0x00000003,0x00000104,0x0000000e,0x0000000d,0x0004003b,0x00000107,0x00000109,
-	0x00000003,0x000e000c,0x00000005,0x0000010a,0x00000001,0x00000012,0x0000004d,0x00000104,
-	0x00000013,0x00000106,0x0000000d,0x00000016,0x0000004d,0x00000109,0x0000002f,0x0004002b,
-	0x00000034,0x00000110,0x3f800000,0x00040020,0x00000112,0x00000003,0x00000034,0x0008000c,
-	0x00000005,0x00000113,0x00000001,0x00000003,0x00000036,0x0000000e,0x0000000d,0x0004002b,
-	0x00000034,0x0000011c,0x00000000,0x0004002b,0x00000008,0x0000011f,0x00000021,0x0004002b,
-	0x00000008,0x00000122,0x00000022,0x0004002b,0x00000008,0x00000124,0x00000023,0x00050036,
-	0x00000005,0x0000000f,0x00000000,0x00000006,0x000200f8,0x00000010,0x0004003b,0x0000001d,
-	0x00000020,0x00000007,0x0004003b,0x0000001d,0x00000054,0x00000007,0x0004003b,0x0000005d,
-	0x0000005f,0x00000007,0x0004003b,0x0000005d,0x00000077,0x00000007,0x0004003b,0x0000005d,
-	0x00000081,0x00000007,0x0004003b,0x0000005d,0x000000a9,0x00000007,0x0004003b,0x00000087,
-	0x000000b7,0x00000007,0x0004003b,0x00000087,0x000000c1,0x00000007,0x0004003b,0x00000087,
-	0x000000d2,0x00000007,0x0004003b,0x00000087,0x000000df,0x00000007,0x0006000c,0x00000005,
-	0x0000001b,0x00000001,0x00000017,0x00000012,0x000a000c,0x00000005,0x0000001c,0x00000001,
-	0x00000067,0x00000013,0x00000015,0x00000015,0x0000000d,0x0000000d,0x0007000c,0x00000005,
-	0x0000001a,0x00000001,0x00000065,0x00000012,0x0000000f,0x000a000c,0x00000005,0x00000026,
-	0x00000001,0x00000067,0x00000013,0x00000023,0x00000023,0x0000000d,0x0000000d,0x0008000c,
-	0x00000005,0x00000024,0x00000001,0x0000001c,0x00000021,0x00000020,0x00000025,0x0004003d,
-	0x00000027,0x00000030,0x0000002c,0x00050087,0x00000027,0x00000032,0x00000030,0x00000031,
-	0x0004007c,0x00000008,0x00000033,0x00000032,0x00050041,0x0000004f,0x00000051,0x0000004b,
-	0x0000004e,0x0004003d,0x00000008,0x00000052,0x00000051,0x00050080,0x00000008,0x00000053,
-	0x00000033,0x00000052,0x0003003e,0x00000020,0x00000053,0x000a000c,0x00000005,0x00000059,
-	0x00000001,0x00000067,0x00000013,0x00000057,0x00000057,0x0000000d,0x0000000d,0x0008000c,
-	0x00000005,0x00000058,0x00000001,0x0000001c,0x00000055,0x00000054,0x00000025,0x0004003d,
-	0x00000027,0x0000005a,0x0000002c,0x0005008b,0x00000027,0x0000005b,0x0000005a,0x00000031,
-	0x0004007c,0x00000008,0x0000005c,0x0000005b,0x0003003e,0x00000054,0x0000005c,0x000a000c,
-	0x00000005,0x00000064,0x00000001,0x00000067,0x00000013,0x00000062,0x00000062,0x0000000d,
-	0x0000000d,0x0008000c,0x00000005,0x00000063,0x00000001,0x0000001c,0x00000060,0x0000005f,
-	0x00000025,0x0004003d,0x00000008,0x00000072,0x00000020,0x00060041,0x00000073,0x00000075,
-	0x0000006e,0x00000071,0x00000072,0x0004003d,0x00000037,0x00000076,0x00000075,0x0003003e,
-	0x0000005f,0x00000076,0x000a000c,0x00000005,0x0000007c,0x00000001,0x00000067,0x00000013,
-	0x0000007a,0x0000007a,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x0000007b,0x00000001,
-	0x0000001c,0x00000078,0x00000077,0x00000025,0x0004003d,0x00000008,0x0000007d,0x00000020,
-	0x00050080,0x00000008,0x0000007e,0x0000007d,0x00000017,0x00060041,0x00000073,0x0000007f,
-	0x0000006e,0x00000071,0x0000007e,0x0004003d,0x00000037,0x00000080,0x0000007f,0x0003003e,
-	0x00000077,0x00000080,0x000a000c,0x00000005,0x00000086,0x00000001,0x00000067,0x00000013,
-	0x00000084,0x00000084,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x00000085,0x00000001,
-	0x0000001c,0x00000082,0x00000081,0x00000025,0x00050041,0x00000087,0x00000089,0x0000005f,
-	0x0000000d,0x0004003d,0x00000034,0x0000008a,0x00000089,0x00050041,0x00000087,0x0000008b,
-	0x00000077,0x0000000d,0x0004003d,0x00000034,0x0000008c,0x0000008b,0x00050050,0x00000037,
-	0x0000008d,0x0000008a,0x0000008c,0x0003003e,0x00000081,0x0000008d,0x000a000c,0x00000005,
-	0x00000095,0x00000001,0x00000067,0x00000013,0x00000093,0x00000093,0x0000000d,0x0000000d,
-	0x0004003d,0x00000037,0x00000094,0x0000005f,0x0003003e,0x00000090,0x00000094,0x000a000c,
-	0x00000005,0x0000009b,0x00000001,0x00000067,0x00000013,0x00000099,0x00000099,0x0000000d,
-	0x0000000d,0x0004003d,0x00000037,0x0000009a,0x00000077,0x0003003e,0x00000096,0x0000009a,
-	0x000a000c,0x00000005,0x0000009d,0x00000001,0x00000067,0x00000013,0x0000009e,0x0000009e,
-	0x0000000d,0x0000000d,0x00050041,0x00000087,0x0000009c,0x00000077,0x0000000d,0x0004003d,
-	0x00000034,0x0000009f,0x0000009c,0x00050041,0x00000087,0x000000a0,0x0000005f,0x0000000d,
-	0x0004003d,0x00000034,0x000000a1,0x000000a0,0x000500b8,0x000000a2,0x000000a5,0x0000009f,
-	0x000000a1,0x000300f7,0x000000a7,0x00000000,0x000400fa,0x000000a5,0x000000a6,0x000000a7,
-	0x000200f8,0x000000a6,0x0006000c,0x00000005,0x000000ae,0x00000001,0x00000017,0x000000a8,
-	0x000a000c,0x00000005,0x000000af,0x00000001,0x00000067,0x00000013,0x000000ac,0x000000ac,
-	0x0000000d,0x0000000d,0x0008000c,0x00000005,0x000000ad,0x00000001,0x0000001c,0x000000aa,
-	0x000000a9,0x00000025,0x0004003d,0x00000037,0x000000b0,0x0000005f,0x0003003e,0x000000a9,
-	0x000000b0,0x000a000c,0x00000005,0x000000b2,0x00000001,0x00000067,0x00000013,0x000000b3,
-	0x000000b3,0x0000000d,0x0000000d,0x0004003d,0x00000037,0x000000b1,0x00000077,0x0003003e,
-	0x0000005f,0x000000b1,0x000a000c,0x00000005,0x000000b5,0x00000001,0x00000067,0x00000013,
-	0x000000b6,0x000000b6,0x0000000d,0x0000000d,0x0004003d,0x00000037,0x000000b4,0x000000a9,
-	0x0003003e,0x00000077,0x000000b4,0x000200f9,0x000000a7,0x000200f8,0x000000a7,0x0006000c,
-	0x00000005,0x000000bc,0x00000001,0x00000017,0x00000012,0x000a000c,0x00000005,0x000000bd,
-	0x00000001,0x00000067,0x00000013,0x000000ba,0x000000ba,0x0000000d,0x0000000d,0x0008000c,
-	0x00000005,0x000000bb,0x00000001,0x0000001c,0x000000b8,0x000000b7,0x00000025,0x0004003d,
-	0x00000008,0x000000be,0x00000054,0x000500c7,0x00000008,0x000000bf,0x000000be,0x00000017,
-	0x000500aa,0x000000a2,0x000000c0,0x000000bf,0x00000017,0x000300f7,0x000000c3,0x00000000,
-	0x000400fa,0x000000c0,0x000000c2,0x000000c9,0x000200f8,0x000000c2,0x0006000c,0x00000005,
-	0x000000c5,0x00000001,0x00000017,0x00000012,0x000a000c,0x00000005,0x000000c6,0x00000001,
-	0x00000067,0x00000013,0x000000ba,0x000000ba,0x0000000d,0x0000000d,0x00050041,0x00000087,
-	0x000000c4,0x00000077,0x0000000d,0x0004003d,0x00000034,0x000000c7,0x000000c4,0x0006000c,
-	0x00000034,0x000000c8,0x00000004,0x00000009,0x000000c7,0x0003003e,0x000000c1,0x000000c8,
-	0x000200f9,0x000000c3,0x000200f8,0x000000c9,0x0006000c,0x00000005,0x000000cb,0x00000001,
-	0x00000017,0x00000012,0x000a000c,0x00000005,0x000000cc,0x00000001,0x00000067,0x00000013,
-	0x000000ba,0x000000ba,0x0000000d,0x0000000d,0x00050041,0x00000087,0x000000ca,0x0000005f,
-	0x0000000d,0x0004003d,0x00000034,0x000000cd,0x000000ca,0x0006000c,0x00000034,0x000000ce,
-	0x00000004,0x00000008,0x000000cd,0x0003003e,0x000000c1,0x000000ce,0x000200f9,0x000000c3,
-	0x000200f8,0x000000c3,0x0006000c,0x00000005,0x000000d0,0x00000001,0x00000017,0x00000012,
-	0x000a000c,0x00000005,0x000000d1,0x00000001,0x00000067,0x00000013,0x000000ba,0x000000ba,
-	0x0000000d,0x0000000d,0x0004003d,0x00000034,0x000000cf,0x000000c1,0x0003003e,0x000000b7,
-	0x000000cf,0x000a000c,0x00000005,0x000000d7,0x00000001,0x00000067,0x00000013,0x000000d5,
-	0x000000d5,0x0000000d,0x0000000d,0x0008000c,0x00000005,0x000000d6,0x00000001,0x0000001c,
-	0x000000d3,0x000000d2,0x00000025,0x0004003d,0x00000008,0x000000d8,0x00000054,0x0004003d,
-	0x00000008,0x000000d9,0x00000054,0x00050086,0x00000008,0x000000da,0x000000d9,0x0000000e,
-	0x00050080,0x00000008,0x000000db,0x000000da,0x00000017,0x000500c2,0x00000008,0x000000dc,
-	0x000000d8,0x000000db,0x000500c7,0x00000008,0x000000dd,0x000000dc,0x00000017,0x000500aa,
-	0x000000a2,0x000000de,0x000000dd,0x00000017,0x000300f7,0x000000e1,0x00000000,0x000400fa,
-	0x000000de,0x000000e0,0x000000ea,0x000200f8,0x000000e0,0x0006000c,0x00000005,0x000000e3,
-	0x00000001,0x00000017,0x00000012,0x000a000c,0x00000005,0x000000e4,0x00000001,0x00000067,
-	0x00000013,0x000000d5,0x000000d5,0x0000000d,0x0000000d,0x00050041,0x00000087,0x000000e2,
-	0x00000077,0x00000017,0x0004003d,0x00000034,0x000000e5,0x000000e2,0x00050041,0x00000087,
-	0x000000e6,0x0000005f,0x00000017,0x0004003d,0x00000034,0x000000e7,0x000000e6,0x0007000c,
-	0x00000034,0x000000e8,0x00000004,0x00000028,0x000000e5,0x000000e7,0x0006000c,0x00000034,
-	0x000000e9,0x00000004,0x00000009,0x000000e8,0x0003003e,0x000000df,0x000000e9,0x000200f9,
-	0x000000e1,0x000200f8,0x000000ea,0x0006000c,0x00000005,0x000000ef,0x00000001,0x00000017,
-	0x00000012,0x000a000c,0x00000005,0x000000f0,0x00000001,0x00000067,0x00000013,0x000000d5,
-	0x000000d5,0x0000000d,0x0000000d,0x00060041,0x000000ec,0x000000ee,0x0000004b,0x000000eb,
-	0x00000017,0x0004003d,0x00000034,0x000000f1,0x000000ee,0x0006000c,0x00000034,0x000000f2,
-	0x00000004,0x00000008,0x000000f1,0x0003003e,0x000000df,0x000000f2,0x000200f9,0x000000e1,
-	0x000200f8,0x000000e1,0x0006000c,0x00000005,0x000000f4,0x00000001,0x00000017,0x00000012,
-	0x000a000c,0x00000005,0x000000f5,0x00000001,0x00000067,0x00000013,0x000000d5,0x000000d5,
-	0x0000000d,0x0000000d,0x0004003d,0x00000034,0x000000f3,0x000000df,0x0003003e,0x000000d2,
-	0x000000f3,0x000a000c,0x00000005,0x0000010c,0x00000001,0x00000067,0x00000013,0x00000106,
-	0x00000106,0x0000000d,0x0000000d,0x0004003d,0x00000034,0x0000010b,0x000000b7,0x00060041,
-	0x000000ec,0x0000010d,0x0000004b,0x00000071,0x0000000d,0x0004003d,0x00000034,0x0000010e,
-	0x0000010d,0x00050085,0x00000034,0x0000010f,0x0000010b,0x0000010e,0x00050083,0x00000034,
-	0x00000111,0x0000010f,0x00000110,0x00060041,0x00000112,0x00000114,0x00000109,0x00000071,
-	0x0000000d,0x0003003e,0x00000114,0x00000111,0x000a000c,0x00000005,0x00000116,0x00000001,
-	0x00000067,0x00000013,0x0000000b,0x0000000b,0x0000000d,0x0000000d,0x0004003d,0x00000034,
-	0x00000115,0x000000d2,0x00060041,0x000000ec,0x00000117,0x0000004b,0x00000071,0x00000017,
-	0x0004003d,0x00000034,0x00000118,0x00000117,0x00050085,0x00000034,0x00000119,0x00000115,
-	0x00000118,0x00050083,0x00000034,0x0000011a,0x00000119,0x00000110,0x00060041,0x00000112,
-	0x0000011b,0x00000109,0x00000071,0x00000017,0x0003003e,0x0000011b,0x0000011a,0x000a000c,
-	0x00000005,0x0000011e,0x00000001,0x00000067,0x00000013,0x0000011f,0x0000011f,0x0000000d,
-	0x0000000d,0x00060041,0x00000112,0x0000011d,0x00000109,0x00000071,0x00000019,0x0003003e,
-	0x0000011d,0x0000011c,0x000a000c,0x00000005,0x00000121,0x00000001,0x00000067,0x00000013,
-	0x00000122,0x00000122,0x0000000d,0x0000000d,0x00060041,0x00000112,0x00000120,0x00000109,
-	0x00000071,0x0000000e,0x0003003e,0x00000120,0x00000110,0x000a000c,0x00000005,0x00000123,
-	0x00000001,0x00000067,0x00000013,0x00000124,0x00000124,0x0000000d,0x0000000d,0x000100fd,
-	0x00010038
-};
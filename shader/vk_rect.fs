@@ -0,0 +1,15 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+layout(location = 0) flat in vec4 rect;
+layout(location = 1) flat in uint rect_color;
+
+layout(location = 0) out vec4 out_color;
+
+// Coverage of the pixel is the product of the overlap of its extent with the rect on both axes
+void main() {
+    vec2 p = gl_FragCoord.xy;
+    vec2 overlap = clamp(min(p + 0.5, rect.zw) - max(p - 0.5, rect.xy), 0.0, 1.0);
+    out_color = unpackUnorm4x8(rect_color);
+    out_color.a *= overlap.x * overlap.y;
+}
@@ -0,0 +1,30 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+// Only built with IVG_BATCH, the rects of a run are read from the batch buffer
+#include "vk_common.glsli"
+
+layout(set = 0, binding = 0) readonly buffer VertexBuffer {
+    vec2 points[];
+} vertex_input;
+
+layout(location = 0) flat out vec4 rect;
+layout(location = 1) flat out uint rect_color;
+
+void main() {
+    // One instance per rect, the quad covers its clipped pixel region
+    load_draw(batch_first + gl_InstanceIndex);
+    uint index = gl_VertexIndex;
+    float x = (index & 1) == 1 ? ceil(max_bb.x) : floor(min_bb.x);
+    float y = ((index >> (index / 3 + 1)) & 1) == 1 ? ceil(max_bb.y) : floor(min_bb.y);
+
+    // Opposite corners of the unclipped rect, the transform may have swapped them
+    vec2 v0 = vertex_input.points[vtx_offset] + translation;
+    vec2 v2 = vertex_input.points[vtx_offset + 2] + translation;
+    rect = vec4(min(v0, v2), max(v0, v2));
+    rect_color = color;
+    gl_Position.x = x * inv_viewport.x - 1.0f;
+    gl_Position.y = y * inv_viewport.y - 1.0f;
+    gl_Position.z = 0.0;
+    gl_Position.w = 1.0;
+}
@@ -0,0 +1,31 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+#include "vk_common.glsli"
+#include "vk_winding.glsli"
+
+#ifdef IVG_BATCH
+layout(location = 4) flat in uint draw_id;
+#endif
+
+// Turns the row differences written by the backdrop coverage pass into coverage by summing down the column
+void main() {
+#ifdef IVG_BATCH
+    load_draw(draw_id);
+#endif
+    uint column = uint(gl_FragCoord.x - floor(min_bb.x));
+    // Rows past the framebuffer are never filled, they stay cleared as long as they are not touched here
+    uint rows = uint(min(ceil(max_bb.y), 2.0f / inv_viewport.y) - floor(min_bb.y));
+    uint winding_idx = column;
+    int sum = 0;
+    for (uint row = 0; row < rows; row++) {
+        int difference = load_coverage(winding_idx);
+        sum += difference;
+        // Neighbouring columns share 16 bit entries, their halves are only updated by adding to them
+        if (winding_format == WINDING_FORMAT_16)
+            add_coverage(winding_idx, sum - difference);
+        else
+            coverage[winding_offset + winding_idx] = sum;
+        winding_idx += winding_stride;
+    }
+}
@@ -0,0 +1,24 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+#include "vk_common.glsli"
+
+#ifdef IVG_BATCH
+layout(location = 4) flat out uint draw_id;
+#endif
+
+// One fragment per column of the draw region, on its first row
+void main() {
+#ifdef IVG_BATCH
+    // One instance per draw of the batch
+    draw_id = batch_first + gl_InstanceIndex;
+    load_draw(draw_id);
+#endif
+    uint index = gl_VertexIndex;
+    float x = (index & 1) == 1 ? ceil(max_bb.x) : floor(min_bb.x);
+    float y = ((index >> (index / 3 + 1)) & 1) == 1 ? floor(min_bb.y) + 1.0f : floor(min_bb.y);
+    gl_Position.x = x * inv_viewport.x - 1.0f;
+    gl_Position.y = y * inv_viewport.y - 1.0f;
+    gl_Position.z = 0.0;
+    gl_Position.w = 1.0;
+}
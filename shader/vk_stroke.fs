@@ -0,0 +1,100 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+#include "vk_common.glsli"
+
+layout(location = 0) flat in vec4 segment;
+layout(location = 1) flat in vec4 neighbors;
+layout(location = 2) flat in uint flags;
+
+layout(location = 0) out vec4 out_color;
+
+// Distance to the segment ab. End points are used exactly so both segments of a joint agree on ties.
+float segment_distance(vec2 p, vec2 a, vec2 b) {
+    vec2 ab = b - a;
+    float t = dot(p - a, ab) / dot(ab, ab);
+    vec2 q = t <= 0.0 ? a : (t >= 1.0 ? b : a + ab * t);
+    return length(p - q);
+}
+
+// Signed distance to the cap at an end of the polyline. s is the distance past the end along the segment and v
+// the distance from the segment axis.
+float cap_distance(float s, float v, float hw) {
+    uint cap = (stroke_style >> 8) & 0xFFu;
+    if (cap == STROKE_CAP_ROUND)
+        return length(vec2(s, v)) - hw;
+    if (cap == STROKE_CAP_SQUARE)
+        return max(s, v) - hw;
+    if (cap == STROKE_CAP_TRIANGLE)
+        return (s + v - hw) * 0.70710678;
+    return max(s, v - hw);
+}
+
+// Signed distance to the join at p1. Only used for pixels past the end of p0-p1 and before the start of p1-p2,
+// which is the wedge on the outer side of the turn.
+float join_distance(vec2 p, vec2 p0, vec2 p1, vec2 p2, float hw) {
+    uint join = stroke_style & 0xFFu;
+    vec2 d = p - p1;
+    float round_distance = length(d) - hw;
+    if (join == STROKE_JOIN_ROUND)
+        return round_distance;
+
+    vec2 t0 = normalize(p1 - p0);
+    vec2 t1 = normalize(p2 - p1);
+    if (join == STROKE_JOIN_NONE) {
+        float end0 = max(dot(d, t0), abs(dot(d, vec2(-t0.y, t0.x))) - hw);
+        float end1 = max(-dot(d, t1), abs(dot(d, vec2(-t1.y, t1.x))) - hw);
+        return max(min(end0, end1), round_distance);
+    }
+
+    // Normals on the outer side, |a + b| is 2 * cos(theta / 2)
+    float s = t0.x * t1.y - t0.y * t1.x > 0.0 ? -1.0 : 1.0;
+    vec2 a = vec2(-t0.y, t0.x) * s;
+    vec2 b = vec2(-t1.y, t1.x) * s;
+    vec2 m = a + b;
+    float cos_half = length(m) * 0.5;
+    if (join == STROKE_JOIN_MITER && cos_half * miter_limit >= 1.0)
+        return max(max(dot(d, a), dot(d, b)) - hw, length(d) - hw / cos_half);
+
+    // Bevel, U-turns are cut flat through the joint
+    vec2 bisector = cos_half > 1e-6 ? m / (2.0 * cos_half) : t0;
+    return max(dot(d, bisector) - hw * cos_half, round_distance);
+}
+
+void main() {
+    vec2 p = gl_FragCoord.xy;
+    vec2 a = segment.xy;
+    vec2 b = segment.zw;
+    bool has_prev = (flags & 1u) != 0u;
+    bool has_next = (flags & 2u) != 0u;
+
+    // Every pixel is shaded by its closest segment only, so joints are never blended twice
+    float dist = segment_distance(p, a, b);
+    if (has_prev) {
+        float d = segment_distance(p, neighbors.xy, a);
+        if (d < dist || (d == dist && (flags & 4u) != 0u))
+            discard;
+    }
+    if (has_next) {
+        float d = segment_distance(p, b, neighbors.zw);
+        if (d < dist || (d == dist && (flags & 8u) != 0u))
+            discard;
+    }
+
+    float hw = max(stroke_width, 1.0) * 0.5;
+    vec2 ab = b - a;
+    float len = length(ab);
+    vec2 t = ab / len;
+    float u = dot(p - a, t);
+    float v = abs(dot(p - a, vec2(-t.y, t.x)));
+    float sd;
+    if (u < 0.0)
+        sd = has_prev ? join_distance(p, neighbors.xy, a, b, hw) : cap_distance(-u, v, hw);
+    else if (u > len)
+        sd = has_next ? join_distance(p, a, b, neighbors.zw, hw) : cap_distance(u - len, v, hw);
+    else
+        sd = v - hw;
+
+    out_color = unpackUnorm4x8(color);
+    out_color.a *= clamp(0.5 - sd, 0.0, 1.0) * min(stroke_width, 1.0);
+}
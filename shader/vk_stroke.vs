@@ -0,0 +1,65 @@
+#version 450 core
+#extension GL_GOOGLE_include_directive : require
+
+#include "vk_common.glsli"
+
+layout(set = 0, binding = 0) readonly buffer VertexBuffer {
+    vec2 points[];
+} vertex_input;
+
+// The segment, its neighbouring points and which of them exist (bits 0-1) and win ties (bits 2-3)
+layout(location = 0) flat out vec4 segment;
+layout(location = 1) flat out vec4 neighbors;
+layout(location = 2) flat out uint flags;
+
+vec2 load_point(uint index) {
+    return vertex_input.points[vtx_offset + index] + translation;
+}
+
+// How far the join at p1 reaches beyond p1
+float join_reach(vec2 p0, vec2 p1, vec2 p2, float hw) {
+    if ((stroke_style & 0xFFu) != STROKE_JOIN_MITER)
+        return hw;
+    vec2 t0 = normalize(p1 - p0);
+    vec2 t1 = normalize(p2 - p1);
+    float cos_half = length(vec2(-t0.y, t0.x) + vec2(-t1.y, t1.x)) * 0.5;
+    return cos_half * miter_limit >= 1.0 ? hw / cos_half : hw;
+}
+
+void main() {
+    bool closed = (stroke_style & STROKE_CLOSED) != 0u;
+    uint num_segments = closed ? vtx_count : vtx_count - 1u;
+    uint seg = gl_VertexIndex / 6;
+    uint index = gl_VertexIndex % 6;
+    uint i1 = seg + 1u == vtx_count ? 0u : seg + 1u;
+    uint i2 = i1 + 1u == vtx_count ? 0u : i1 + 1u;
+    bool has_prev = closed || seg > 0u;
+    bool has_next = closed || seg + 1u < num_segments;
+    vec2 p0 = load_point(seg);
+    vec2 p1 = load_point(i1);
+    vec2 prev = has_prev ? load_point(seg == 0u ? vtx_count - 1u : seg - 1u) : p0;
+    vec2 next = has_next ? load_point(i2) : p1;
+
+    // Lines thinner than a pixel are drawn one pixel wide with reduced opacity
+    float hw = max(stroke_width, 1.0) * 0.5;
+    float cap_reach = ((stroke_style >> 8) & 0xFFu) == STROKE_CAP_BUTT ? 0.0 : hw;
+    float reach0 = has_prev ? join_reach(prev, p0, p1, hw) : cap_reach;
+    float reach1 = has_next ? join_reach(p0, p1, next, hw) : cap_reach;
+
+    // Quad around the segment with one pixel of margin for antialiasing
+    vec2 t = normalize(p1 - p0);
+    vec2 n = vec2(-t.y, t.x);
+    vec2 along = (index & 1) == 1 ? p1 + t * (reach1 + 1.0) : p0 - t * (reach0 + 1.0);
+    float side = ((index >> (index / 3 + 1)) & 1) == 1 ? 1.0 : -1.0;
+    vec2 pos = along + n * (side * (hw + 1.0));
+
+    // Pixels at the same distance from two segments belong to the one with the lower index
+    segment = vec4(p0, p1);
+    neighbors = vec4(prev, next);
+    flags = (has_prev ? 1u : 0u) | (has_next ? 2u : 0u) | (seg > 0u ? 4u : 0u) | (seg + 1u == num_segments ? 8u : 0u);
+
+    gl_Position.x = pos.x * inv_viewport.x - 1.0f;
+    gl_Position.y = pos.y * inv_viewport.y - 1.0f;
+    gl_Position.z = 0.0;
+    gl_Position.w = 1.0;
+}